@@ -0,0 +1,204 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <riscv_vector.h>
+
+#include "batched.h"
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+//////////
+// GEMM //
+//////////
+
+// Up to 4x4 elements of C per block, one LMUL=1 accumulator each. Every k
+// step loads a column of A and a row of B of the block, 8 vectors for 16
+// FMAs. Called with constant rb = cb = 4 for the inner blocks, so that the
+// guards fold away.
+
+#define BGEMM_ROW(r)                                                           \
+  do {                                                                         \
+    if (rb > r) {                                                              \
+      vfloat64m1_t va = __riscv_vle64_v_f64m1(a + (r * n + k) * stride, vl);   \
+      c##r##0 = __riscv_vfmacc_vv_f64m1(c##r##0, va, b0, vl);                  \
+      if (cb > 1)                                                              \
+        c##r##1 = __riscv_vfmacc_vv_f64m1(c##r##1, va, b1, vl);                \
+      if (cb > 2)                                                              \
+        c##r##2 = __riscv_vfmacc_vv_f64m1(c##r##2, va, b2, vl);                \
+      if (cb > 3)                                                              \
+        c##r##3 = __riscv_vfmacc_vv_f64m1(c##r##3, va, b3, vl);                \
+    }                                                                          \
+  } while (0)
+
+#define BGEMM_STORE(r, j)                                                      \
+  do {                                                                         \
+    if (rb > r && cb > j)                                                      \
+      __riscv_vse64_v_f64m1(c + (r * p + j) * stride, c##r##j, vl);            \
+  } while (0)
+
+#define BGEMM_STORE_ROW(r)                                                     \
+  do {                                                                         \
+    BGEMM_STORE(r, 0);                                                         \
+    BGEMM_STORE(r, 1);                                                         \
+    BGEMM_STORE(r, 2);                                                         \
+    BGEMM_STORE(r, 3);                                                         \
+  } while (0)
+
+static inline void bgemm_block(double *c, const double *a, const double *b,
+                               size_t n, size_t p, size_t stride, size_t rb,
+                               size_t cb, size_t vl) {
+  vfloat64m1_t zero = __riscv_vfmv_v_f_f64m1(0, vl);
+  vfloat64m1_t c00 = zero, c01 = zero, c02 = zero, c03 = zero;
+  vfloat64m1_t c10 = zero, c11 = zero, c12 = zero, c13 = zero;
+  vfloat64m1_t c20 = zero, c21 = zero, c22 = zero, c23 = zero;
+  vfloat64m1_t c30 = zero, c31 = zero, c32 = zero, c33 = zero;
+
+  for (size_t k = 0; k < n; ++k) {
+    const double *b_ = b + k * p * stride;
+    vfloat64m1_t b0 = __riscv_vle64_v_f64m1(b_, vl);
+    vfloat64m1_t b1 = cb > 1 ? __riscv_vle64_v_f64m1(b_ + stride, vl) : b0;
+    vfloat64m1_t b2 = cb > 2 ? __riscv_vle64_v_f64m1(b_ + 2 * stride, vl) : b0;
+    vfloat64m1_t b3 = cb > 3 ? __riscv_vle64_v_f64m1(b_ + 3 * stride, vl) : b0;
+    BGEMM_ROW(0);
+    BGEMM_ROW(1);
+    BGEMM_ROW(2);
+    BGEMM_ROW(3);
+  }
+
+  BGEMM_STORE_ROW(0);
+  BGEMM_STORE_ROW(1);
+  BGEMM_STORE_ROW(2);
+  BGEMM_STORE_ROW(3);
+}
+
+void bgemm(double *c, const double *a, const double *b, size_t m, size_t n,
+           size_t p, size_t batch) {
+  size_t vl;
+  for (size_t s = 0; s < batch; s += vl) {
+    vl = __riscv_vsetvl_e64m1(batch - s);
+    for (size_t i = 0; i < m; i += 4) {
+      const size_t rb = MIN(m - i, 4);
+      for (size_t j = 0; j < p; j += 4) {
+        const size_t cb = MIN(p - j, 4);
+        double *c_ = c + (i * p + j) * batch + s;
+        const double *a_ = a + i * n * batch + s;
+        const double *b_ = b + j * batch + s;
+        if (rb == 4 && cb == 4)
+          bgemm_block(c_, a_, b_, n, p, batch, 4, 4, vl);
+        else
+          bgemm_block(c_, a_, b_, n, p, batch, rb, cb, vl);
+      }
+    }
+  }
+}
+
+//////////
+// GEMV //
+//////////
+
+// Up to 8 elements of y per block: every k step loads one element of x and a
+// column of A of the block, 9 vectors for 8 FMAs
+
+#define BGEMV_ROW(r)                                                           \
+  do {                                                                         \
+    if (rb > r)                                                                \
+      y##r = __riscv_vfmacc_vv_f64m1(                                          \
+          y##r, __riscv_vle64_v_f64m1(a + (r * n + k) * stride, vl), vx, vl);  \
+  } while (0)
+
+#define BGEMV_STORE(r)                                                         \
+  do {                                                                         \
+    if (rb > r)                                                                \
+      __riscv_vse64_v_f64m1(y + r * stride, y##r, vl);                         \
+  } while (0)
+
+static inline void bgemv_block(double *y, const double *a, const double *x,
+                               size_t n, size_t stride, size_t rb, size_t vl) {
+  vfloat64m1_t zero = __riscv_vfmv_v_f_f64m1(0, vl);
+  vfloat64m1_t y0 = zero, y1 = zero, y2 = zero, y3 = zero;
+  vfloat64m1_t y4 = zero, y5 = zero, y6 = zero, y7 = zero;
+
+  for (size_t k = 0; k < n; ++k) {
+    vfloat64m1_t vx = __riscv_vle64_v_f64m1(x + k * stride, vl);
+    BGEMV_ROW(0);
+    BGEMV_ROW(1);
+    BGEMV_ROW(2);
+    BGEMV_ROW(3);
+    BGEMV_ROW(4);
+    BGEMV_ROW(5);
+    BGEMV_ROW(6);
+    BGEMV_ROW(7);
+  }
+
+  BGEMV_STORE(0);
+  BGEMV_STORE(1);
+  BGEMV_STORE(2);
+  BGEMV_STORE(3);
+  BGEMV_STORE(4);
+  BGEMV_STORE(5);
+  BGEMV_STORE(6);
+  BGEMV_STORE(7);
+}
+
+void bgemv(double *y, const double *a, const double *x, size_t m, size_t n,
+           size_t batch) {
+  size_t vl;
+  for (size_t s = 0; s < batch; s += vl) {
+    vl = __riscv_vsetvl_e64m1(batch - s);
+    for (size_t i = 0; i < m; i += 8) {
+      const size_t rb = MIN(m - i, 8);
+      double *y_ = y + i * batch + s;
+      const double *a_ = a + i * n * batch + s;
+      if (rb == 8)
+        bgemv_block(y_, a_, x + s, n, batch, 8, vl);
+      else
+        bgemv_block(y_, a_, x + s, n, batch, rb, vl);
+    }
+  }
+}
+
+////////////
+// Layout //
+////////////
+
+// One strided access per matrix element, across the batch
+
+void batch_pack(double *dst, const double *src, size_t rows, size_t cols,
+                size_t batch) {
+  const size_t size = rows * cols;
+  size_t vl;
+  for (size_t s = 0; s < batch; s += vl) {
+    vl = __riscv_vsetvl_e64m8(batch - s);
+    for (size_t e = 0; e < size; ++e) {
+      vfloat64m8_t v = __riscv_vlse64_v_f64m8(src + s * size + e,
+                                              size * sizeof(double), vl);
+      __riscv_vse64_v_f64m8(dst + e * batch + s, v, vl);
+    }
+  }
+}
+
+void batch_unpack(double *dst, const double *src, size_t rows, size_t cols,
+                  size_t batch) {
+  const size_t size = rows * cols;
+  size_t vl;
+  for (size_t s = 0; s < batch; s += vl) {
+    vl = __riscv_vsetvl_e64m8(batch - s);
+    for (size_t e = 0; e < size; ++e) {
+      vfloat64m8_t v = __riscv_vle64_v_f64m8(src + e * batch + s, vl);
+      __riscv_vsse64_v_f64m8(dst + s * size + e, size * sizeof(double), v, vl);
+    }
+  }
+}
@@ -0,0 +1,47 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Batched small-matrix GEMM and GEMV (double precision)
+//
+// A batch of small problems of the same shape is stored interleaved: element
+// (i, j) of the batch of rows x cols matrices is a contiguous array of batch
+// values, at x[(i * cols + j) * batch]. Every vector element then belongs to
+// a different problem, so a single instruction advances vl problems at once,
+// whatever their size, and no reduction or slide is needed.
+
+#ifndef _BATCHED_H_
+#define _BATCHED_H_
+
+#include <stddef.h>
+
+// C = A * B for every problem of the batch. A is m x n, B is n x p, all
+// interleaved.
+void bgemm(double *c, const double *a, const double *b, size_t m, size_t n,
+           size_t p, size_t batch);
+
+// y = A * x for every problem of the batch. A is m x n, x has n elements and
+// y has m elements, all interleaved.
+void bgemv(double *y, const double *a, const double *x, size_t m, size_t n,
+           size_t batch);
+
+// Convert batch consecutive row-major rows x cols matrices to the interleaved
+// layout, and back
+void batch_pack(double *dst, const double *src, size_t rows, size_t cols,
+                size_t batch);
+void batch_unpack(double *dst, const double *src, size_t rows, size_t cols,
+                  size_t batch);
+
+#endif
@@ -0,0 +1 @@
+../../fmatmul/kernel/fmatmul.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../gemv/kernel/gemv.c
\ No newline at end of file
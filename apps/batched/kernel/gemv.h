@@ -0,0 +1 @@
+../../gemv/kernel/gemv.h
\ No newline at end of file
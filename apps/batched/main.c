@@ -0,0 +1,164 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Batched small-matrix benchmark. For every size, multiply BATCH pairs of
+// square matrices, and BATCH matrices by vectors, once by looping over
+// fmatmul() and gemv_rowwise(), once with the interleaved batched kernels.
+// Check the results and print the FLOP/cycle of both.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel/batched.h"
+#include "kernel/fmatmul.h"
+#include "kernel/gemv.h"
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Number of problems of every batch
+#ifndef BATCH
+#define BATCH 128
+#endif
+
+#define MAX_SIZE 32
+#define MAX_ELEMS (BATCH * MAX_SIZE * MAX_SIZE)
+
+// Row-major problems, one after the other
+double A[MAX_ELEMS] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+double B[MAX_ELEMS] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+double C[MAX_ELEMS] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+double X[BATCH * MAX_SIZE]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+double Y[BATCH * MAX_SIZE]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+// Interleaved problems
+double PA[MAX_ELEMS] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+double PB[MAX_ELEMS] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+double PC[MAX_ELEMS] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+double PX[BATCH * MAX_SIZE]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+double PY[BATCH * MAX_SIZE]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+
+// Small integers, so that every kernel computes the exact result
+static void init_data(size_t s) {
+  for (size_t b = 0; b < BATCH; ++b) {
+    for (size_t i = 0; i < s; ++i) {
+      for (size_t j = 0; j < s; ++j) {
+        A[(b * s + i) * s + j] = (double)((b + 3 * i + 5 * j) % 7) - 3;
+        B[(b * s + i) * s + j] = (double)((2 * b + i + 7 * j) % 5) - 2;
+      }
+      X[b * s + i] = (double)((b + 3 * i) % 9) - 4;
+    }
+  }
+}
+
+static void print_row(size_t s, const char *kernel, int64_t runtime,
+                      uint64_t flop, int64_t base) {
+  printf("%4d  %-13s  %9d  %10f  %7f\n", s, kernel, runtime,
+         (float)flop / runtime, (float)base / runtime);
+}
+
+int main() {
+  printf("\n");
+  printf("=============\n");
+  printf("=  BATCHED  =\n");
+  printf("=============\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+  int64_t runtime, base;
+
+  printf("%d problems per batch.\n", BATCH);
+  printf("size  kernel            cycles  FLOP/cycle  speedup\n");
+
+  for (size_t s = 4; s <= MAX_SIZE; s *= 2) {
+    const size_t size = s * s;
+    const uint64_t gemm_flop = 2ull * BATCH * s * s * s;
+    const uint64_t gemv_flop = 2ull * BATCH * s * s;
+    init_data(s);
+
+    // GEMM
+    start_timer();
+    for (size_t b = 0; b < BATCH; ++b)
+      fmatmul(C + b * size, A + b * size, B + b * size, s, s, s);
+    stop_timer();
+    base = get_timer();
+    print_row(s, "fmatmul loop", base, gemm_flop, base);
+
+    start_timer();
+    batch_pack(PA, A, s, s, BATCH);
+    batch_pack(PB, B, s, s, BATCH);
+    stop_timer();
+    runtime = get_timer();
+    printf("%4d  %-13s  %9d\n", s, "pack A, B", runtime);
+
+    start_timer();
+    bgemm(PC, PA, PB, s, s, s, BATCH);
+    stop_timer();
+    runtime = get_timer();
+    print_row(s, "bgemm", runtime, gemm_flop, base);
+
+    // Check the round trip through the interleaved layout as well
+    batch_unpack(PB, PC, s, s, BATCH);
+    for (size_t i = 0; i < BATCH * size; ++i)
+      if (PB[i] != C[i]) {
+        if (!error)
+          printf("Error: bgemm, problem %d, element %d: %f != %f\n", i / size,
+                 i % size, PB[i], C[i]);
+        error++;
+      }
+
+    // GEMV
+    start_timer();
+    for (size_t b = 0; b < BATCH; ++b)
+      gemv_rowwise(s, s, A + b * size, X + b * s, Y + b * s);
+    stop_timer();
+    base = get_timer();
+    print_row(s, "gemv loop", base, gemv_flop, base);
+
+    batch_pack(PX, X, 1, s, BATCH);
+    start_timer();
+    bgemv(PY, PA, PX, s, s, BATCH);
+    stop_timer();
+    runtime = get_timer();
+    print_row(s, "bgemv", runtime, gemv_flop, base);
+
+    for (size_t b = 0; b < BATCH; ++b)
+      for (size_t i = 0; i < s; ++i)
+        if (PY[i * BATCH + b] != Y[b * s + i]) {
+          if (!error)
+            printf("Error: bgemv, problem %d, element %d: %f != %f\n", b, i,
+                   PY[i * BATCH + b], Y[b * s + i]);
+          error++;
+        }
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
@@ -0,0 +1,276 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "bench.h"
+#include "mt.h"
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+#ifndef WARM_CACHES_ITER
+#define WARM_CACHES_ITER 1
+#endif
+
+#ifndef BENCH_SEED
+#define BENCH_SEED 42
+#endif
+
+// Default list of points, separated by spaces. "name" runs the default size,
+// "name:n1,n2" the listed sizes, "all" every kernel at its default size.
+#ifndef BENCH_POINTS
+#define BENCH_POINTS "all"
+#endif
+#define BENCH_POINTS_SIZE 512
+
+char bench_points[BENCH_POINTS_SIZE]
+    __attribute__((section(".bench_points"))) = BENCH_POINTS;
+
+extern const bench_t __start_bench_registry[];
+extern const bench_t __stop_bench_registry[];
+
+///////////////
+// Allocator //
+///////////////
+
+#define BENCH_ALIGN (32 * NR_LANES)
+
+#if defined(SPIKE) || defined(ARA_LINUX)
+#ifndef BENCH_POOL_SIZE
+#define BENCH_POOL_SIZE (4 << 20)
+#endif
+static uint8_t bench_pool[BENCH_POOL_SIZE]
+    __attribute__((aligned(BENCH_ALIGN)));
+#define BENCH_POOL_BASE ((uintptr_t)bench_pool)
+#define BENCH_POOL_END ((uintptr_t)bench_pool + BENCH_POOL_SIZE)
+#else
+// Defined by the linker script. The L2 of ara_soc is 16 MiB, and its top
+// holds the stacks of the harts (see crt0.S): the end of the DRAM region
+// aliases to it.
+extern uint8_t l2_alloc_base[];
+#ifndef BENCH_L2_END
+#define BENCH_L2_END (0x81000000 - NR_CORES * HART_STACK_SIZE)
+#endif
+#define BENCH_POOL_BASE ((uintptr_t)l2_alloc_base)
+#define BENCH_POOL_END ((uintptr_t)BENCH_L2_END)
+#endif
+
+static uintptr_t bench_brk;
+
+void *bench_alloc(size_t size) {
+  uintptr_t p = (bench_brk + BENCH_ALIGN - 1) & ~(uintptr_t)(BENCH_ALIGN - 1);
+  if (p + size > BENCH_POOL_END)
+    return NULL;
+  bench_brk = p + size;
+  return (void *)p;
+}
+
+//////////
+// PRNG //
+//////////
+
+// splitmix64: cheap, and good enough for benchmark inputs
+static uint64_t bench_state;
+
+uint64_t bench_rand(void) {
+  uint64_t z = (bench_state += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+double bench_rand_double(void) {
+  return (double)(bench_rand() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+int64_t bench_rand_int(int64_t lo, int64_t hi) {
+  return lo + (int64_t)(bench_rand() % (uint64_t)(hi - lo + 1));
+}
+
+void bench_fill_double(double *x, size_t n) {
+  for (size_t i = 0; i < n; ++i)
+    x[i] = bench_rand_double();
+}
+
+void bench_fill_float(float *x, size_t n) {
+  for (size_t i = 0; i < n; ++i)
+    x[i] = (float)bench_rand_double();
+}
+
+void bench_fill_int64(int64_t *x, size_t n, int64_t lo, int64_t hi) {
+  for (size_t i = 0; i < n; ++i)
+    x[i] = bench_rand_int(lo, hi);
+}
+
+int bench_close(double a, double b, double tolerance) {
+  double diff = a > b ? a - b : b - a;
+  double mag = b < 0 ? -b : b;
+  return diff <= tolerance * (mag > 1.0 ? mag : 1.0);
+}
+
+////////////
+// Runner //
+////////////
+
+static const bench_t *bench_find(const char *name, size_t len) {
+  for (const bench_t *b = __start_bench_registry; b < __stop_bench_registry;
+       ++b)
+    if (strlen(b->name) == len && !strncmp(b->name, name, len))
+      return b;
+  return NULL;
+}
+
+#ifdef BENCH_PERF
+static const char *bench_vfu_names[PERF_NR_VFUS] = {"valu", "vmfpu", "sldu",
+                                                   "masku", "vldu", "vstu"};
+
+// Where the cycles of the timed run went, from Ara's performance counters
+static void bench_print_perf(const perf_cnt_t *p) {
+  printf("  busy:");
+  for (int i = 0; i < PERF_NR_VFUS; ++i)
+    printf(" %s=%d", bench_vfu_names[i], p->busy[i]);
+  printf("\n  stall:");
+  for (int i = 0; i < PERF_NR_VFUS; ++i)
+    printf(" %s=%d", bench_vfu_names[i], p->stall[i]);
+  printf(" hazard=%d opreq=%d opqueue=%d\n", p->hazard_stall, p->opreq_stall,
+         p->opqueue_stall);
+  printf("  vrf_conflicts=%d axi_r_bytes=%d axi_w_bytes=%d reshuffles=%d\n",
+         p->vrf_bank_conflict, p->axi_r_bytes, p->axi_w_bytes, p->reshuffles);
+  printf("  l1_inval=%d skipped=%d aw_stall=%d vsetvl=%d\n", p->inval_reqs,
+         p->inval_skipped, p->inval_aw_stall, p->vsetvl_cycles);
+  printf("  pf_hits=%d pf_misses=%d l2_accesses=%d l2_conflicts=%d\n",
+         p->pf_hits, p->pf_misses, p->l2_accesses, p->l2_conflicts);
+  printf("  vinsn_issues=%d ooo_issues=%d\n", p->vinsn_issues, p->ooo_issues);
+}
+#endif
+
+static int bench_run_point(const bench_t *b, uint64_t n) {
+  int64_t runtime;
+  int errors;
+#ifdef BENCH_PERF
+  perf_cnt_t perf_start, perf_end;
+#endif
+
+  bench_brk = BENCH_POOL_BASE;
+  bench_state = BENCH_SEED;
+
+  if (b->setup(n)) {
+    printf("%-12s  %6d  unsupported size\n", b->name, n);
+    return 1;
+  }
+
+#ifndef SPIKE
+  for (int i = 0; i < WARM_CACHES_ITER; ++i)
+    b->run(n);
+#endif
+
+  HW_CNT_READY;
+#ifdef BENCH_PERF
+  perf_snapshot(&perf_start);
+#endif
+  start_timer();
+  b->run(n);
+  stop_timer();
+#ifdef BENCH_PERF
+  perf_snapshot(&perf_end);
+#endif
+  HW_CNT_NOT_READY;
+  runtime = get_timer();
+
+  errors = b->verify(n);
+  if (runtime <= 0)
+    runtime = 1;
+  printf("%-12s  %6d  %10d  %10f  %10f  %s\n", b->name, n, runtime,
+         (float)b->flop(n) / runtime, (float)b->bytes(n) / runtime,
+         errors ? "FAIL" : "ok");
+#ifdef BENCH_PERF
+  perf_diff(&perf_end, &perf_end, &perf_start);
+  bench_print_perf(&perf_end);
+#endif
+  return errors != 0;
+}
+
+int bench_main(void) {
+  printf("\n");
+  printf("================\n");
+  printf("=  BENCHMARKS  =\n");
+  printf("================\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+  const char *p = bench_points;
+  const char *end = bench_points + BENCH_POINTS_SIZE;
+
+  printf("Points: %s\n", bench_points);
+  printf("kernel          size      cycles  FLOP/cycle     B/cycle  check\n");
+
+  while (p < end && *p) {
+    // Next token: name[:n1[,n2...]]
+    if (*p == ' ' || *p == '\n' || *p == '\t') {
+      ++p;
+      continue;
+    }
+    const char *name = p;
+    while (p < end && *p && *p != ':' && *p != ' ' && *p != '\n' &&
+           *p != '\t')
+      ++p;
+    const size_t len = p - name;
+
+    if (len == 3 && !strncmp(name, "all", 3)) {
+      for (const bench_t *b = __start_bench_registry;
+           b < __stop_bench_registry; ++b)
+        error += bench_run_point(b, b->default_size);
+      continue;
+    }
+
+    const bench_t *b = bench_find(name, len);
+    if (!b) {
+      printf("Error: unknown kernel %.*s\n", len, name);
+      error++;
+    }
+
+    if (p == end || *p != ':') {
+      if (b)
+        error += bench_run_point(b, b->default_size);
+      continue;
+    }
+
+    // Sizes
+    do {
+      uint64_t n = 0;
+      for (++p; p < end && *p >= '0' && *p <= '9'; ++p)
+        n = 10 * n + (*p - '0');
+      if (b)
+        error += bench_run_point(b, n);
+    } while (p < end && *p == ',');
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
@@ -0,0 +1,76 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Benchmark registry
+//
+// Every kernel registers itself with BENCH_REGISTER in its own file under
+// bench/. The registered benchmarks end up in the bench_registry section,
+// and bench_main() runs the kernel:size points listed in the bench_points
+// section, which can be rewritten in the compiled binary (see the README),
+// so that one binary covers a whole sweep.
+//
+// For every point, the inputs are allocated from L2 and filled on-target
+// from a seeded PRNG, the kernel is run once to warm the caches and once
+// timed, and its output is checked.
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+  const char *name;
+  // Size of the point "name" without an explicit size
+  uint64_t default_size;
+  // Allocate and initialize the inputs of size n. Return 0, or -1 if the
+  // kernel does not support n.
+  int (*setup)(uint64_t n);
+  // The measured kernel. It is called more than once per point.
+  void (*run)(uint64_t n);
+  // Check the output of the last run, return the number of errors
+  int (*verify)(uint64_t n);
+  // Operations and compulsory memory traffic, in bytes, of one run
+  uint64_t (*flop)(uint64_t n);
+  uint64_t (*bytes)(uint64_t n);
+} bench_t;
+
+#define BENCH_REGISTER(id)                                                     \
+  static const bench_t __bench_##id                                            \
+      __attribute__((used, section("bench_registry"), aligned(8)))
+
+// Bump allocator on the L2 after the program. bench_main() frees everything
+// before every point. Return NULL if the L2 is full.
+void *bench_alloc(size_t size);
+
+// PRNG, reseeded before every point
+uint64_t bench_rand(void);
+// Uniform in [0, 1)
+double bench_rand_double(void);
+// Uniform in [lo, hi]
+int64_t bench_rand_int(int64_t lo, int64_t hi);
+
+void bench_fill_double(double *x, size_t n);
+void bench_fill_float(float *x, size_t n);
+void bench_fill_int64(int64_t *x, size_t n, int64_t lo, int64_t hi);
+
+// Relative comparison, for the kernels whose order of operations differs
+// from the scalar reference
+int bench_close(double a, double b, double tolerance);
+
+int bench_main(void);
+
+#endif
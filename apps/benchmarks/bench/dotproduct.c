@@ -0,0 +1,48 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../kernel/dotproduct.h"
+#include "bench.h"
+
+static int64_t *a, *b;
+static int64_t res;
+
+static int dotproduct_setup(uint64_t n) {
+  a = bench_alloc(n * sizeof(int64_t));
+  b = bench_alloc(n * sizeof(int64_t));
+  if (!n || !a || !b)
+    return -1;
+  bench_fill_int64(a, n, -1000, 1000);
+  bench_fill_int64(b, n, -1000, 1000);
+  return 0;
+}
+
+static void dotproduct_run(uint64_t n) { res = dotp_v64b(a, b, n); }
+
+static int dotproduct_verify(uint64_t n) { return res != dotp_s64b(a, b, n); }
+
+static uint64_t dotproduct_flop(uint64_t n) { return 2 * n; }
+static uint64_t dotproduct_bytes(uint64_t n) { return 2 * n * sizeof(int64_t); }
+
+BENCH_REGISTER(dotproduct) = {
+    .name = "dotproduct",
+    .default_size = 512,
+    .setup = dotproduct_setup,
+    .run = dotproduct_run,
+    .verify = dotproduct_verify,
+    .flop = dotproduct_flop,
+    .bytes = dotproduct_bytes,
+};
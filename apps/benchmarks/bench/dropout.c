@@ -0,0 +1,59 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../kernel/dropout.h"
+#include "bench.h"
+
+static float *i, *o;
+static uint8_t *sel;
+static float scale;
+
+static int dropout_setup(uint64_t n) {
+  i = bench_alloc(n * sizeof(float));
+  o = bench_alloc(n * sizeof(float));
+  sel = bench_alloc((n + 7) / 8);
+  if (!n || !i || !o || !sel)
+    return -1;
+  bench_fill_float(i, n);
+  for (uint64_t k = 0; k < (n + 7) / 8; ++k)
+    sel[k] = (uint8_t)bench_rand();
+  scale = (float)bench_rand_double();
+  return 0;
+}
+
+static void dropout_run(uint64_t n) { dropout_vec(n, i, scale, sel, o); }
+
+static int dropout_verify(uint64_t n) {
+  int errors = 0;
+  for (uint64_t k = 0; k < n; ++k)
+    errors += o[k] != ((sel[k >> 3] >> (k & 7)) & 1 ? i[k] * scale : 0);
+  return errors;
+}
+
+static uint64_t dropout_flop(uint64_t n) { return n; }
+static uint64_t dropout_bytes(uint64_t n) {
+  return 2 * n * sizeof(float) + n / 8;
+}
+
+BENCH_REGISTER(dropout) = {
+    .name = "dropout",
+    .default_size = 1024,
+    .setup = dropout_setup,
+    .run = dropout_run,
+    .verify = dropout_verify,
+    .flop = dropout_flop,
+    .bytes = dropout_bytes,
+};
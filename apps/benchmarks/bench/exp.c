@@ -0,0 +1,55 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <math.h>
+
+#include "../kernel/exp.h"
+#include "bench.h"
+
+static double *x, *y;
+
+static int exp_setup(uint64_t n) {
+  x = bench_alloc(n * sizeof(double));
+  y = bench_alloc(n * sizeof(double));
+  if (!n || !x || !y)
+    return -1;
+  bench_fill_double(x, n);
+  return 0;
+}
+
+static void exp_run(uint64_t n) { exp_1xf64_asm_bmark(x, y, n); }
+
+// The kernel is a polynomial approximation
+static int exp_verify(uint64_t n) {
+  int errors = 0;
+  for (uint64_t i = 0; i < n; ++i)
+    errors += !bench_close(y[i], exp(x[i]), 1e-5);
+  return errors;
+}
+
+// Range reduction, degree-5 polynomial and scaling
+static uint64_t exp_flop(uint64_t n) { return 24 * n; }
+static uint64_t exp_bytes(uint64_t n) { return 2 * n * sizeof(double); }
+
+BENCH_REGISTER(exp) = {
+    .name = "exp",
+    .default_size = 128,
+    .setup = exp_setup,
+    .run = exp_run,
+    .verify = exp_verify,
+    .flop = exp_flop,
+    .bytes = exp_bytes,
+};
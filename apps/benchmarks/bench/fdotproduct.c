@@ -0,0 +1,53 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../kernel/fdotproduct.h"
+#include "bench.h"
+
+static double *a, *b;
+static double res;
+
+static int fdotproduct_setup(uint64_t n) {
+  a = bench_alloc(n * sizeof(double));
+  b = bench_alloc(n * sizeof(double));
+  if (!n || !a || !b)
+    return -1;
+  bench_fill_double(a, n);
+  bench_fill_double(b, n);
+  return 0;
+}
+
+static void fdotproduct_run(uint64_t n) { res = fdotp_v64b(a, b, n); }
+
+// The vector reduction sums in a different order
+static int fdotproduct_verify(uint64_t n) {
+  return !bench_close(res, fdotp_s64b(a, b, n), 1e-12);
+}
+
+static uint64_t fdotproduct_flop(uint64_t n) { return 2 * n; }
+static uint64_t fdotproduct_bytes(uint64_t n) {
+  return 2 * n * sizeof(double);
+}
+
+BENCH_REGISTER(fdotproduct) = {
+    .name = "fdotproduct",
+    .default_size = 512,
+    .setup = fdotproduct_setup,
+    .run = fdotproduct_run,
+    .verify = fdotproduct_verify,
+    .flop = fdotproduct_flop,
+    .bytes = fdotproduct_bytes,
+};
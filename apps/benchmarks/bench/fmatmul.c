@@ -0,0 +1,77 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../kernel/fmatmul.h"
+#include "bench.h"
+
+static double *a, *b, *c;
+
+// fmatmul() picks its block of rows from the size
+static uint64_t fmatmul_block(uint64_t n) {
+  if (n <= 4)
+    return 4;
+  if (n <= 8)
+    return 8;
+  if (n <= 64)
+    return 16;
+  if (n <= 128)
+    return 8;
+  return 4;
+}
+
+static int fmatmul_setup(uint64_t n) {
+  if (!n || n % fmatmul_block(n))
+    return -1;
+  a = bench_alloc(n * n * sizeof(double));
+  b = bench_alloc(n * n * sizeof(double));
+  c = bench_alloc(n * n * sizeof(double));
+  if (!a || !b || !c)
+    return -1;
+  bench_fill_double(a, n * n);
+  bench_fill_double(b, n * n);
+  return 0;
+}
+
+static void fmatmul_run(uint64_t n) { fmatmul(c, a, b, n, n, n); }
+
+// Check 8 rows against a scalar product
+static int fmatmul_verify(uint64_t n) {
+  const uint64_t step = n > 8 ? n / 8 : 1;
+  int errors = 0;
+  for (uint64_t i = 0; i < n; i += step)
+    for (uint64_t j = 0; j < n; ++j) {
+      double ref = 0;
+      for (uint64_t k = 0; k < n; ++k)
+        ref += a[i * n + k] * b[k * n + j];
+      errors += !bench_close(c[i * n + j], ref, 1e-10);
+    }
+  return errors;
+}
+
+static uint64_t fmatmul_flop(uint64_t n) { return 2 * n * n * n; }
+static uint64_t fmatmul_bytes(uint64_t n) {
+  return 3 * n * n * sizeof(double);
+}
+
+BENCH_REGISTER(fmatmul) = {
+    .name = "fmatmul",
+    .default_size = 128,
+    .setup = fmatmul_setup,
+    .run = fmatmul_run,
+    .verify = fmatmul_verify,
+    .flop = fmatmul_flop,
+    .bytes = fmatmul_bytes,
+};
@@ -0,0 +1,71 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../kernel/iconv2d.h"
+#include "bench.h"
+
+// 7x7 filter on an n x n image, with the padding in the input
+#define F 7
+
+static int64_t *i, *f, *o;
+
+static int iconv2d_setup(uint64_t n) {
+  const uint64_t np = n + F - 1;
+  // The kernel works on blocks of 4 rows, and on a whole row per vector
+  if (!n || n % 4 || n > 128)
+    return -1;
+  i = bench_alloc(np * np * sizeof(int64_t));
+  f = bench_alloc(F * F * sizeof(int64_t));
+  o = bench_alloc(n * n * sizeof(int64_t));
+  if (!i || !f || !o)
+    return -1;
+  bench_fill_int64(i, np * np, -100, 100);
+  bench_fill_int64(f, F * F, -100, 100);
+  return 0;
+}
+
+static void iconv2d_run(uint64_t n) { iconv2d_7x7(o, i, f, n, n, F); }
+
+// Check 8 rows against a scalar convolution
+static int iconv2d_verify(uint64_t n) {
+  const uint64_t np = n + F - 1;
+  const uint64_t step = n > 8 ? n / 8 : 1;
+  int errors = 0;
+  for (uint64_t r = 0; r < n; r += step)
+    for (uint64_t c = 0; c < n; ++c) {
+      int64_t ref = 0;
+      for (uint64_t kr = 0; kr < F; ++kr)
+        for (uint64_t kc = 0; kc < F; ++kc)
+          ref += f[kr * F + kc] * i[(r + kr) * np + c + kc];
+      errors += o[r * n + c] != ref;
+    }
+  return errors;
+}
+
+static uint64_t iconv2d_flop(uint64_t n) { return 2 * F * F * n * n; }
+static uint64_t iconv2d_bytes(uint64_t n) {
+  return ((n + F - 1) * (n + F - 1) + F * F + n * n) * sizeof(int64_t);
+}
+
+BENCH_REGISTER(iconv2d) = {
+    .name = "iconv2d",
+    .default_size = 112,
+    .setup = iconv2d_setup,
+    .run = iconv2d_run,
+    .verify = iconv2d_verify,
+    .flop = iconv2d_flop,
+    .bytes = iconv2d_bytes,
+};
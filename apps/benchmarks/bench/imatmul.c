@@ -0,0 +1,73 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../kernel/imatmul.h"
+#include "bench.h"
+
+static int64_t *a, *b, *c;
+
+// imatmul() picks its block of rows from the size
+static uint64_t imatmul_block(uint64_t n) {
+  if (n <= 4)
+    return 4;
+  if (n <= 128)
+    return 8;
+  return 4;
+}
+
+static int imatmul_setup(uint64_t n) {
+  if (!n || n % imatmul_block(n))
+    return -1;
+  a = bench_alloc(n * n * sizeof(int64_t));
+  b = bench_alloc(n * n * sizeof(int64_t));
+  c = bench_alloc(n * n * sizeof(int64_t));
+  if (!a || !b || !c)
+    return -1;
+  bench_fill_int64(a, n * n, -100, 100);
+  bench_fill_int64(b, n * n, -100, 100);
+  return 0;
+}
+
+static void imatmul_run(uint64_t n) { imatmul(c, a, b, n, n, n); }
+
+// Check 8 rows against a scalar product
+static int imatmul_verify(uint64_t n) {
+  const uint64_t step = n > 8 ? n / 8 : 1;
+  int errors = 0;
+  for (uint64_t i = 0; i < n; i += step)
+    for (uint64_t j = 0; j < n; ++j) {
+      int64_t ref = 0;
+      for (uint64_t k = 0; k < n; ++k)
+        ref += a[i * n + k] * b[k * n + j];
+      errors += c[i * n + j] != ref;
+    }
+  return errors;
+}
+
+static uint64_t imatmul_flop(uint64_t n) { return 2 * n * n * n; }
+static uint64_t imatmul_bytes(uint64_t n) {
+  return 3 * n * n * sizeof(int64_t);
+}
+
+BENCH_REGISTER(imatmul) = {
+    .name = "imatmul",
+    .default_size = 128,
+    .setup = imatmul_setup,
+    .run = imatmul_run,
+    .verify = imatmul_verify,
+    .flop = imatmul_flop,
+    .bytes = imatmul_bytes,
+};
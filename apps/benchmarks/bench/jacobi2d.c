@@ -0,0 +1,87 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+
+#include "../kernel/jacobi2d.h"
+#include "bench.h"
+
+// n x n grids, borders included. Like in the jacobi2d app, the grids are
+// shifted so that the first inner element of every row is aligned, and have
+// spare rows and columns for the lookahead of the vector kernel.
+#define PAD (4 * NR_LANES / sizeof(DATA_TYPE))
+
+static DATA_TYPE *a_v, *b_v, *a_s, *b_s;
+// The vector kernel updates the grids in place, so the reference replays
+// all its runs
+static uint64_t runs;
+
+static DATA_TYPE *jacobi2d_grid(uint64_t n) {
+  DATA_TYPE *g = bench_alloc((n + PAD) * (n + PAD) * sizeof(DATA_TYPE));
+  return g ? g + PAD - 1 : NULL;
+}
+
+static int jacobi2d_setup(uint64_t n) {
+  const size_t size = (n + PAD) * (n + PAD) - PAD + 1;
+  if (n < 3)
+    return -1;
+  a_v = jacobi2d_grid(n);
+  b_v = jacobi2d_grid(n);
+  a_s = jacobi2d_grid(n);
+  b_s = jacobi2d_grid(n);
+  if (!a_v || !b_v || !a_s || !b_s)
+    return -1;
+  bench_fill_double(a_v, size);
+  memset(b_v, 0, size * sizeof(DATA_TYPE));
+  memcpy(a_s, a_v, size * sizeof(DATA_TYPE));
+  memset(b_s, 0, size * sizeof(DATA_TYPE));
+  runs = 0;
+  return 0;
+}
+
+static void jacobi2d_run(uint64_t n) {
+  j2d_v(n, n, a_v, b_v, 1);
+  runs++;
+}
+
+// Check the inner points of both grids
+static int jacobi2d_verify(uint64_t n) {
+  int errors = 0;
+  j2d_s(n, n, a_s, b_s, runs);
+  runs = 0;
+  for (uint64_t i = 1; i < n - 1; ++i)
+    for (uint64_t j = 1; j < n - 1; ++j) {
+      errors += !bench_close(a_v[i * n + j], a_s[i * n + j], THRESHOLD);
+      errors += !bench_close(b_v[i * n + j], b_s[i * n + j], THRESHOLD);
+    }
+  return errors;
+}
+
+// One sweep from A to B and one back
+static uint64_t jacobi2d_flop(uint64_t n) { return 2 * 5 * (n - 2) * (n - 2); }
+static uint64_t jacobi2d_bytes(uint64_t n) {
+  return 2 * n * n * sizeof(DATA_TYPE);
+}
+
+BENCH_REGISTER(jacobi2d) = {
+    .name = "jacobi2d",
+    .default_size = 130,
+    .setup = jacobi2d_setup,
+    .run = jacobi2d_run,
+    .verify = jacobi2d_verify,
+    .flop = jacobi2d_flop,
+    .bytes = jacobi2d_bytes,
+};
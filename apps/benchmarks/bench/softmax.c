@@ -0,0 +1,62 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+
+#include "../kernel/softmax.h"
+#include "bench.h"
+
+// Softmax over CHANNELS channels of n elements
+#define CHANNELS 3
+
+static float *i, *o_v, *o_s, *buf;
+
+static int softmax_setup(uint64_t n) {
+  i = bench_alloc(CHANNELS * n * sizeof(float));
+  o_v = bench_alloc(CHANNELS * n * sizeof(float));
+  o_s = bench_alloc(CHANNELS * n * sizeof(float));
+  buf = bench_alloc(CHANNELS * n * sizeof(float));
+  if (!n || !i || !o_v || !o_s || !buf)
+    return -1;
+  bench_fill_float(i, CHANNELS * n);
+  return 0;
+}
+
+static void softmax_run(uint64_t n) { softmax_vec(i, o_v, CHANNELS, n); }
+
+static int softmax_verify(uint64_t n) {
+  int errors = 0;
+  softmax(i, o_s, buf, CHANNELS, n);
+  for (uint64_t k = 0; k < CHANNELS * n; ++k)
+    errors += !bench_close(o_v[k], o_s[k], 1e-4);
+  return errors;
+}
+
+// Max, subtraction, exponential, sum and division per element
+static uint64_t softmax_flop(uint64_t n) { return 28 * CHANNELS * n; }
+static uint64_t softmax_bytes(uint64_t n) {
+  return 2 * CHANNELS * n * sizeof(float);
+}
+
+BENCH_REGISTER(softmax) = {
+    .name = "softmax",
+    .default_size = 256,
+    .setup = softmax_setup,
+    .run = softmax_run,
+    .verify = softmax_verify,
+    .flop = softmax_flop,
+    .bytes = softmax_bytes,
+};
@@ -0,0 +1,83 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../kernel/spmv.h"
+#include "bench.h"
+
+// Non-zeros of every row of the n x n matrix
+#ifndef SPMV_NNZ_ROW
+#define SPMV_NNZ_ROW 32
+#endif
+
+static int32_t *prow, *col;
+static double *data, *x, *y;
+
+static uint64_t spmv_csr_nnz(uint64_t n) {
+  return n * (n < SPMV_NNZ_ROW ? n : SPMV_NNZ_ROW);
+}
+
+static int spmv_csr_setup(uint64_t n) {
+  const uint64_t nnz = spmv_csr_nnz(n);
+  if (!n)
+    return -1;
+  prow = bench_alloc((n + 1) * sizeof(int32_t));
+  col = bench_alloc(nnz * sizeof(int32_t));
+  data = bench_alloc(nnz * sizeof(double));
+  x = bench_alloc(n * sizeof(double));
+  y = bench_alloc(n * sizeof(double));
+  if (!prow || !col || !data || !x || !y)
+    return -1;
+  // The indices are byte offsets into x
+  for (uint64_t i = 0; i <= n; ++i)
+    prow[i] = i * (nnz / n);
+  for (uint64_t k = 0; k < nnz; ++k)
+    col[k] = bench_rand_int(0, n - 1) * sizeof(double);
+  bench_fill_double(data, nnz);
+  bench_fill_double(x, n);
+  return 0;
+}
+
+static void spmv_csr_run(uint64_t n) {
+  spmv_csr_idx32(n, prow, col, data, x, y);
+}
+
+// The vector reduction sums in a different order
+static int spmv_csr_verify(uint64_t n) {
+  int errors = 0;
+  for (uint64_t i = 0; i < n; ++i) {
+    double ref = 0;
+    for (int32_t k = prow[i]; k < prow[i + 1]; ++k)
+      ref += data[k] * x[col[k] / sizeof(double)];
+    errors += !bench_close(y[i], ref, 1e-12);
+  }
+  return errors;
+}
+
+static uint64_t spmv_csr_flop(uint64_t n) { return 2 * spmv_csr_nnz(n); }
+static uint64_t spmv_csr_bytes(uint64_t n) {
+  return spmv_csr_nnz(n) * (sizeof(double) + sizeof(int32_t)) +
+         (n + 1) * sizeof(int32_t) + 2 * n * sizeof(double);
+}
+
+BENCH_REGISTER(spmv) = {
+    .name = "spmv",
+    .default_size = 256,
+    .setup = spmv_csr_setup,
+    .run = spmv_csr_run,
+    .verify = spmv_csr_verify,
+    .flop = spmv_csr_flop,
+    .bytes = spmv_csr_bytes,
+};
@@ -77,7 +77,10 @@
 #include "benchmark/lavamd.bmark"
 
 #else
-#error                                                                         \
-    "Error, no kernel was specified. Please, run 'make bin/benchmarks ENV_DEFINES=-D${KERNEL}', where KERNEL contains the kernel to benchmark. For example: 'make bin/benchmarks ENV_DEFINES=-DIMATMUL'."
+// No kernel selected: run the kernel:size points of the benchmark registry,
+// see bench/bench.h
+#include "bench/bench.h"
+
+int main() { return bench_main(); }
 
 #endif
@@ -0,0 +1,77 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Inline-assembly macros for Ara's vendor vector instructions, which the
+// compiler does not know. They are emitted with .insn in the OP-V major
+// opcode. Vector registers are passed by name (e.g., v8). The BF16 vtype is
+// set with the helpers below, for the same reason.
+
+#ifndef __ARA_INSN_H__
+#define __ARA_INSN_H__
+
+#include <stdint.h>
+
+#define ARA_STR_(x) #x
+#define ARA_STR(x) ARA_STR_(x)
+
+#define ARA_OPV 0x57
+#define ARA_OPFVV 0x1
+#define ARA_OPFVF 0x5
+
+// vfwdotp (funct6 = 111001, unmasked): widening dot product with
+// accumulation. SEW is the width of the accumulator. Each source element
+// holds a pair of floats of SEW/2 bits: FP16 at SEW = 32, FP8 at SEW = 16.
+//   vd[i] += vs2[i].lo * vs1[i].lo + vs2[i].hi * vs1[i].hi
+// The .vf form reads the pair from the low SEW bits of an FP register, e.g.
+// loaded with flw at SEW = 32.
+#define ARA_VFWDOTP_FUNCT7 0x73
+
+#define VFWDOTP_VV(vd, vs2, vs1)                                               \
+  asm volatile(".insn r " ARA_STR(ARA_OPV) ", " ARA_STR(ARA_OPFVV) ", "       \
+               ARA_STR(ARA_VFWDOTP_FUNCT7) ", " #vd ", " #vs1 ", " #vs2)
+#define VFWDOTP_VF(vd, rs1, vs2)                                               \
+  asm volatile(".insn r " ARA_STR(ARA_OPV) ", " ARA_STR(ARA_OPFVF) ", "       \
+               ARA_STR(ARA_VFWDOTP_FUNCT7) ", " #vd ", %0, " #vs2 ::"f"(rs1))
+
+// vtype.altfmt (bit 8, as in Zvfbfa): at SEW = 16, the FP instructions operate
+// on BF16 instead of FP16. The widening instructions read BF16 sources, the
+// narrowing ones write a BF16 destination. The compiler does not know the bit,
+// so the vtype is set with vsetvl.
+#define ARA_VTYPE_ALTFMT (1 << 8)
+#define ARA_VTYPE_MA (1 << 7)
+#define ARA_VTYPE_TA (1 << 6)
+// e16 with altfmt, tail and mask agnostic, LMUL = 1 << lmul_log2
+#define ARA_VTYPE_BF16(lmul_log2)                                              \
+  (ARA_VTYPE_ALTFMT | ARA_VTYPE_MA | ARA_VTYPE_TA | (1 << 3) | (lmul_log2))
+
+#define VSETVL_BF16(vl, avl, lmul_log2)                                        \
+  asm volatile("vsetvl %0, %1, %2"                                             \
+               : "=r"(vl)                                                      \
+               : "r"(avl), "r"(ARA_VTYPE_BF16(lmul_log2)))
+
+// BF16 values are handled as their bit patterns, which are the upper half of
+// an FP32
+typedef uint16_t bf16_t;
+
+static inline float bf16_to_float(bf16_t x) {
+  union {
+    uint32_t u;
+    float f;
+  } v = {.u = (uint32_t)x << 16};
+  return v.f;
+}
+
+#endif
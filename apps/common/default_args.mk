@@ -10,22 +10,32 @@ def_args_iconv2d     ?= "112 7"
 def_args_fconv2d     ?= "112 7"
 def_args_fconv3d     ?= "112 7"
 def_args_dtype-conv3d?= "112 7 float64"
+# Image size, input channels, output channels, data type
+def_args_conv        ?= "32 3 4 float64"
+# SEWs, LMULs and instruction classes (or all)
+def_args_rvv-perf    ?= "64 1 all"
 # Vector size
 def_args_fdotproduct ?= "512"
 # Vector size
 def_args_dotproduct  ?= "512"
 # Matrix padded size 0, matrix padded size 1, onlyvec
 def_args_jacobi2d    ?= "130 130"
+# 2D rows and columns, 3D planes, rows and columns, time steps
+def_args_stencil     ?= "66 130 18 18 18 4"
 # Vector size
 def_args_dropout     ?= "1024"
 # Vector size, data-type
 def_args_fft         ?= "64 float32"
+# FFT sizes
+def_args_fft-stockham?= "64 256 1024 4096"
 # Vector size
 def_args_dwt         ?= "512"
 # Vector size
 def_args_exp         ?= "128"
 def_args_cos         ?= "512"
 def_args_log         ?= "512"
+# Elements per function and data type
+def_args_vmath       ?= "256"
 # Channels and Inner size
 def_args_softmax     ?= "3 256"
 # Number of steps and width of the vector
@@ -0,0 +1,128 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Driver of the DMA engine of Ara's SoC (soc_dma), header-only. The engine
+// copies 2D blocks: reps rows of len bytes, the rows src_stride bytes apart in
+// the source, and dst_stride bytes apart in the destination. The addresses,
+// lengths, and strides must be multiples of 8 bytes.
+//
+// dma_start_2d() queues a copy and returns its ID, without waiting for it.
+// dma_done() tells whether the copy of an ID is over, dma_wait() waits for it.
+// The copies are executed in order, so waiting for an ID also waits for the
+// copies started before it.
+//
+// The lines written by the DMA are invalidated in CVA6's L1 data caches, so the
+// copied data can be read with scalar and vector loads after dma_wait(). Do not
+// read the destination of a copy before.
+// The DMA is shared by all the cores of the SoC: drive it from a single hart.
+// On Spike, the copies are done by the core in dma_start_2d().
+
+#ifndef __DMA_H__
+#define __DMA_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint64_t dma_id_t;
+
+#if !defined(SPIKE) && !defined(ARA_LINUX)
+
+// Descriptor registers, in the order of the memory map
+typedef struct {
+  uint64_t src;
+  uint64_t dst;
+  uint64_t len;
+  uint64_t src_stride;
+  uint64_t dst_stride;
+  uint64_t reps;
+  // A write queues the descriptor
+  uint64_t start;
+  // Read-only: queued and executed descriptors
+  uint64_t issued;
+  uint64_t status;
+  uint64_t done;
+} dma_regs_t;
+
+#define DMA_STATUS_BUSY (1 << 0)
+#define DMA_STATUS_FULL (1 << 1)
+
+extern dma_regs_t dma_reg;
+
+#define DMA_REGS ((volatile dma_regs_t *)&dma_reg)
+
+static inline dma_id_t dma_start_2d(void *dst, const void *src, size_t len,
+                                    size_t dst_stride, size_t src_stride,
+                                    size_t reps) {
+  volatile dma_regs_t *dma = DMA_REGS;
+  // The source must be in memory: drain the scalar and vector stores
+  asm volatile("fence" ::: "memory");
+  dma->src = (uint64_t)src;
+  dma->dst = (uint64_t)dst;
+  dma->len = len;
+  dma->src_stride = src_stride;
+  dma->dst_stride = dst_stride;
+  dma->reps = reps;
+  // A start on a full queue is dropped, and the status lags by a few cycles:
+  // retry until the descriptor is counted. A retry can queue the descriptor a
+  // second time, which copies the same data again.
+  const dma_id_t id = dma->issued + 1;
+  do {
+    while (dma->status & DMA_STATUS_FULL)
+      ;
+    dma->start = 1;
+  } while ((int64_t)(dma->issued - id) < 0);
+  return id;
+}
+
+// The counters wrap around: compare their distance
+static inline int dma_done(dma_id_t id) {
+  return (int64_t)(DMA_REGS->done - id) >= 0;
+}
+
+static inline void dma_wait(dma_id_t id) {
+  while (!dma_done(id))
+    ;
+  asm volatile("" ::: "memory");
+}
+
+#else
+
+static dma_id_t dma_last_id;
+
+static inline dma_id_t dma_start_2d(void *dst, const void *src, size_t len,
+                                    size_t dst_stride, size_t src_stride,
+                                    size_t reps) {
+  for (size_t r = 0; r < reps; ++r) {
+    uint64_t *d = (uint64_t *)((uint8_t *)dst + r * dst_stride);
+    const uint64_t *s = (const uint64_t *)((const uint8_t *)src + r * src_stride);
+    for (size_t i = 0; i < len / sizeof(uint64_t); ++i)
+      d[i] = s[i];
+  }
+  return ++dma_last_id;
+}
+
+static inline int dma_done(dma_id_t id) { return id <= dma_last_id; }
+
+static inline void dma_wait(dma_id_t id) { (void)id; }
+
+#endif
+
+// 1D copy of len bytes
+static inline dma_id_t dma_start(void *dst, const void *src, size_t len) {
+  return dma_start_2d(dst, src, len, 0, 0, 1);
+}
+
+#endif
@@ -0,0 +1,101 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Fork-join runtime for the multi-core configurations of Ara's SoC (see mt.h)
+
+#include "mt.h"
+
+// Shared state, only accessed through the uncached alias. Every field is
+// written by a single hart. It is in .data, since .bss is not cleared.
+typedef struct {
+  mt_fn_t fn;
+  void *arg;
+  uint64_t nr_harts;
+  // Incremented by hart 0 to start a fork
+  uint64_t fork_id;
+  // Last fork completed by every hart
+  uint64_t joined[MT_MAX_HARTS];
+  // Barriers passed by every hart in the current fork
+  uint64_t barriers[MT_MAX_HARTS];
+} mt_state_t;
+
+static mt_state_t mt_state __attribute__((aligned(64), section(".data")));
+
+#define MT_STATE ((volatile mt_state_t *)mt_uncached(&mt_state))
+
+void mt_fork(unsigned int nr_harts, mt_fn_t fn, void *arg) {
+  volatile mt_state_t *st = MT_STATE;
+
+  if (nr_harts == 0 || nr_harts > NR_CORES)
+    nr_harts = NR_CORES;
+
+  // All the harts joined the previous fork: no barrier is pending
+  for (unsigned int h = 0; h < NR_CORES; ++h)
+    st->barriers[h] = 0;
+  st->fn = fn;
+  st->arg = arg;
+  st->nr_harts = nr_harts;
+  // Publish the fork after its arguments, and after the data written so far
+  asm volatile("fence" ::: "memory");
+  const uint64_t id = st->fork_id + 1;
+  st->fork_id = id;
+
+  fn(0, nr_harts, arg);
+
+  // Wait for all the harts, also the idle ones, which acknowledge the fork
+  asm volatile("fence" ::: "memory");
+  for (unsigned int h = 1; h < NR_CORES; ++h)
+    while (st->joined[h] != id)
+      ;
+  asm volatile("" ::: "memory");
+}
+
+void mt_barrier(void) {
+  volatile mt_state_t *st = MT_STATE;
+  const unsigned int hart = mt_hart_id();
+  const unsigned int nr_harts = st->nr_harts;
+
+  // The scalar and vector stores before the barrier must reach the L2
+  asm volatile("fence" ::: "memory");
+  const uint64_t b = st->barriers[hart] + 1;
+  st->barriers[hart] = b;
+  // The other harts may already be past it
+  for (unsigned int h = 0; h < nr_harts; ++h)
+    while (st->barriers[h] < b)
+      ;
+  asm volatile("" ::: "memory");
+}
+
+// Harts 1 to NR_CORES-1 start here, and never return
+void mt_worker(void) {
+  volatile mt_state_t *st = MT_STATE;
+  const unsigned int hart = mt_hart_id();
+  // Hart 0 may fork before this hart boots: fork 1 is the first one
+  uint64_t id = 0;
+
+  while (1) {
+    while (st->fork_id == id)
+      ;
+    id = st->fork_id;
+    asm volatile("fence" ::: "memory");
+
+    if (hart < st->nr_harts)
+      st->fn(hart, st->nr_harts, st->arg);
+
+    asm volatile("fence" ::: "memory");
+    st->joined[hart] = id;
+  }
+}
@@ -0,0 +1,97 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Fork-join runtime for the multi-core configurations of Ara's SoC, with
+// NR_CORES CVA6+Ara cores sharing the L2. Hart 0 runs main(), the other harts
+// wait for work in mt_worker(), from crt0.S. Every hart has its own stack.
+//
+// mt_fork(n, fn, arg) runs fn(hart, n, arg) on the harts 0 to n-1, hart 0
+// included, and returns when all of them are done. mt_barrier() synchronizes
+// the harts of the current fork.
+//
+// The cores do not snoop the writes of each other. After a barrier or a join,
+// the data written by another hart can be read with vector loads, which do not
+// go through CVA6's L1, or with scalar loads through mt_uncached(). The data
+// that nobody writes during the forks, e.g., the inputs, is read as usual.
+// The runtime itself synchronizes with plain loads and stores to the uncached
+// alias of the DRAM, since the L2 does not support atomics.
+// On Spike and Linux, there is a single hart.
+//
+// crt0.S includes this header for HART_STACK_SIZE.
+
+#ifndef __MT_H__
+#define __MT_H__
+
+#ifndef NR_CORES
+#define NR_CORES 1
+#endif
+
+#define MT_MAX_HARTS 8
+
+// Stack of each hart, below the one of the previous hart, from the end of the
+// DRAM region down
+#define HART_STACK_SIZE 0x100000
+
+#ifndef __ASSEMBLER__
+
+#include <stdint.h>
+
+// Task of a hart, out of nr_harts
+typedef void (*mt_fn_t)(unsigned int hart, unsigned int nr_harts, void *arg);
+
+#if !defined(SPIKE) && !defined(ARA_LINUX)
+
+// The uncached alias of the DRAM (see ara_soc) is 256 MiB above it
+#define MT_UNCACHED_OFFSET 0x10000000UL
+
+// The hart ID is kept in tp by crt0.S
+static inline unsigned int mt_hart_id(void) {
+  unsigned long int id;
+  asm volatile("mv %0, tp" : "=r"(id));
+  return id;
+}
+
+static inline unsigned int mt_nr_harts(void) { return NR_CORES; }
+
+// Uncached address of a static object
+static inline void *mt_uncached(const void *p) {
+  return (void *)((uintptr_t)p + MT_UNCACHED_OFFSET);
+}
+
+void mt_fork(unsigned int nr_harts, mt_fn_t fn, void *arg);
+void mt_barrier(void);
+void mt_worker(void);
+
+#else
+
+static inline unsigned int mt_hart_id(void) { return 0; }
+
+static inline unsigned int mt_nr_harts(void) { return 1; }
+
+static inline void *mt_uncached(const void *p) { return (void *)p; }
+
+static inline void mt_fork(unsigned int nr_harts, mt_fn_t fn, void *arg) {
+  (void)nr_harts;
+  fn(0, 1, arg);
+}
+
+static inline void mt_barrier(void) {}
+
+#endif
+
+#endif // __ASSEMBLER__
+
+#endif
@@ -428,8 +428,8 @@
 
 #ifndef _MM_EXP
 #define _MM_EXP
-#define _MM_EXP_f64 __exp_1xf64
-#define _MM_EXP_f32 __exp_2xf32
+#define _MM_EXP_f64 vmath_exp_fast_f64m1
+#define _MM_EXP_f32 vmath_exp_fast_f32m1
 #endif
 
 #ifndef _MM_COS
@@ -11,6 +11,53 @@ extern int64_t event_trigger;
 extern int64_t timer;
 // SoC-level CSR
 extern uint64_t hw_cnt_en_reg;
+// Ara's performance counters, read-only
+extern uint64_t perf_cnt_reg[];
+
+// Snapshot of Ara's performance counters, in the order of the memory map.
+// The L2 counters are raised by the SoC, for all the cores.
+// The busy and stall counters are indexed VALU, VMFPU, SLDU, MASKU, VLDU, VSTU.
+#define PERF_NR_VFUS 6
+typedef struct {
+  uint64_t cycles;
+  // Cycles with at least one instruction in flight in the unit
+  uint64_t busy[PERF_NR_VFUS];
+  // Cycles the sequencer waited for the instruction queue of the unit
+  uint64_t stall[PERF_NR_VFUS];
+  // Cycles the sequencer held an instruction back because of a hazard
+  uint64_t hazard_stall;
+  // Cycles the sequencer waited for the operand requesters
+  uint64_t opreq_stall;
+  // Operand requesters waiting for a full operand queue, summed over cycles
+  uint64_t opqueue_stall;
+  // VRF banks requested by more than one master, summed over cycles
+  uint64_t vrf_bank_conflict;
+  // Bytes on Ara's AXI R and W channels
+  uint64_t axi_r_bytes;
+  uint64_t axi_w_bytes;
+  // Reshuffle micro-operations injected by the dispatcher
+  uint64_t reshuffles;
+  // CVA6 L1 invalidations: accepted by the L1, skipped because the line is not
+  // in the L1, and cycles Ara's AW channel waited for the invalidation filter
+  uint64_t inval_reqs;
+  uint64_t inval_skipped;
+  uint64_t inval_aw_stall;
+  // Dispatcher cycles spent decoding vsetvl, or draining the backend after one
+  uint64_t vsetvl_cycles;
+  // Load beats answered from the VLSU's prefetch buffer, or by the memory
+  uint64_t pf_hits;
+  uint64_t pf_misses;
+  // Requests served by the banks of the L2, and requests waiting for a bank
+  // served to another requester, summed over cycles
+  uint64_t l2_accesses;
+  uint64_t l2_conflicts;
+  // Instructions issued by the sequencer, and the ones issued past an older
+  // instruction parked on a full unit queue
+  uint64_t vinsn_issues;
+  uint64_t ooo_issues;
+} perf_cnt_t;
+
+#define PERF_NR_COUNTERS (sizeof(perf_cnt_t) / sizeof(uint64_t))
 
 // Return the current value of the cycle counter
 inline int64_t get_cycle_count() {
@@ -36,6 +83,17 @@ inline void stop_timer() { timer += get_cycle_count(); }
 
 // Get the value of the timer
 inline int64_t get_timer() { return timer; }
+
+// Read all the performance counters. The counters run freely: take a snapshot
+// before and after a region and subtract them with perf_diff().
+inline void perf_snapshot(perf_cnt_t *s) {
+  volatile uint64_t *cnt = perf_cnt_reg;
+  uint64_t *dst = (uint64_t *)s;
+  // Let the previous vector instructions raise their events first
+  asm volatile("fence" ::: "memory");
+  for (unsigned i = 0; i < PERF_NR_COUNTERS; ++i)
+    dst[i] = cnt[i];
+}
 #else
 #define HW_CNT_READY ;
 #define HW_CNT_NOT_READY ;
@@ -51,6 +109,23 @@ inline void stop_timer() {
 
 // Get the value of the timer
 inline int64_t get_timer() { return 0; }
+
+// No performance counters
+inline void perf_snapshot(perf_cnt_t *s) {
+  uint64_t *dst = (uint64_t *)s;
+  for (unsigned i = 0; i < PERF_NR_COUNTERS; ++i)
+    dst[i] = 0;
+}
 #endif
 
+// d = end - start, counter by counter. d can alias end or start.
+inline void perf_diff(perf_cnt_t *d, const perf_cnt_t *end,
+                      const perf_cnt_t *start) {
+  uint64_t *dst = (uint64_t *)d;
+  const uint64_t *e = (const uint64_t *)end;
+  const uint64_t *b = (const uint64_t *)start;
+  for (unsigned i = 0; i < PERF_NR_COUNTERS; ++i)
+    dst[i] = e[i] - b[i];
+}
+
 #endif // _RUNTIME_H_
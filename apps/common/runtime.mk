@@ -32,6 +32,8 @@ endif
 
 # Include configuration
 include $(ARA_DIR)/config/$(config).mk
+# Number of CVA6+Ara cores, if the configuration does not set it
+nr_cores ?= 1
 
 INSTALL_DIR             ?= $(ARA_DIR)/install
 GCC_INSTALL_DIR         ?= $(INSTALL_DIR)/riscv-gcc
@@ -93,7 +95,7 @@ endif
 ifeq ($(vcd_dump),1)
 ENV_DEFINES += -DVCD_DUMP=1
 endif
-MAKE_DEFINES = -DNR_LANES=$(nr_lanes) -DVLEN=$(vlen)
+MAKE_DEFINES = -DNR_LANES=$(nr_lanes) -DVLEN=$(vlen) -DNR_CORES=$(nr_cores)
 DEFINES += $(ENV_DEFINES) $(MAKE_DEFINES)
 
 # Common flags
@@ -129,12 +131,22 @@ ifneq ($(LINUX),1)
 endif
 endif
 
+# Link the vector memcpy/memset/memcmp/strlen/strcmp of vstring.c, which
+# override the weak scalar ones of string.c (opt-in). Force-build (-B) when
+# changing it.
+RUNTIME_VSTRING ?= 0
+ifeq ($(RUNTIME_VSTRING),1)
+VSTRING_GCC   := common/vstring-gcc.c.o
+VSTRING_LLVM  := common/vstring-llvm.c.o
+MAKE_DEFINES  += -DRUNTIME_VSTRING=1
+endif
+
 # Compile two different versions of the runtime, since we cannot link code compiled with two different toolchains
-RUNTIME_GCC   ?= common/crt0-gcc.S.o common/printf-gcc.c.o common/string-gcc.c.o common/serial-gcc.c.o common/util-gcc.c.o
+RUNTIME_GCC   ?= common/crt0-gcc.S.o common/printf-gcc.c.o common/string-gcc.c.o $(VSTRING_GCC) common/serial-gcc.c.o common/util-gcc.c.o common/mt-gcc.c.o
 ifeq ($(LINUX),1)
 RUNTIME_LLVM  ?= common/util-llvm.c.o
 else
-RUNTIME_LLVM  ?= common/crt0-llvm.S.o common/printf-llvm.c.o common/string-llvm.c.o common/serial-llvm.c.o common/util-llvm.c.o
+RUNTIME_LLVM  ?= common/crt0-llvm.S.o common/printf-llvm.c.o common/string-llvm.c.o $(VSTRING_LLVM) common/serial-llvm.c.o common/util-llvm.c.o common/mt-llvm.c.o
 endif
 RUNTIME_SPIKE ?= $(spike_env_dir)/benchmarks/common/crt.S.o.spike $(spike_env_dir)/benchmarks/common/syscalls.c.o.spike common/util.c.o.spike
 
@@ -2,7 +2,10 @@
 #include <stdint.h>
 #include <string.h>
 
-void *memcpy(void *dest, const void *src, size_t len) {
+// memcpy, memset, strlen, strcmp and memcmp are weak, so that the vector
+// versions of vstring.c replace them when linked in
+
+__attribute__((weak)) void *memcpy(void *dest, const void *src, size_t len) {
   if ((((uintptr_t)dest | (uintptr_t)src | len) & (sizeof(uintptr_t) - 1)) ==
       0) {
     const uintptr_t *s = src;
@@ -18,7 +21,7 @@ void *memcpy(void *dest, const void *src, size_t len) {
   return dest;
 }
 
-void *memset(void *dest, int byte, size_t len) {
+__attribute__((weak)) void *memset(void *dest, int byte, size_t len) {
   if ((((uintptr_t)dest | len) & (sizeof(uintptr_t) - 1)) == 0) {
     uintptr_t word = byte & 0xFF;
     word |= word << 8;
@@ -36,14 +39,14 @@ void *memset(void *dest, int byte, size_t len) {
   return dest;
 }
 
-size_t strlen(const char *s) {
+__attribute__((weak)) size_t strlen(const char *s) {
   const char *p = s;
   while (*p)
     p++;
   return (size_t)(p - s);
 }
 
-int strcmp(const char *s1, const char *s2) {
+__attribute__((weak)) int strcmp(const char *s1, const char *s2) {
   unsigned char c1, c2;
 
   do {
@@ -54,7 +57,7 @@ int strcmp(const char *s1, const char *s2) {
   return c1 - c2;
 }
 
-int memcmp(const void *s1, const void *s2, size_t n) {
+__attribute__((weak)) int memcmp(const void *s1, const void *s2, size_t n) {
   if ((((uintptr_t)s1 | (uintptr_t)s2) & (sizeof(uintptr_t) - 1)) == 0) {
     const uintptr_t *u1 = s1;
     const uintptr_t *u2 = s2;
@@ -0,0 +1,227 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Vector math library for Ara (header-only)
+//
+// Every function is available for f16, f32 and f64 and for LMUL in
+// {m1, m2, m4, m8}, in two accuracy tiers:
+//
+//   vmath_<fn>_fast_<f><sew><lmul>(x, vl)   fast polynomial, Cephes-like
+//                                           accuracy (single-precision
+//                                           quality also at f64)
+//   vmath_<fn>_<f><sew><lmul>(x, vl)        ULP-bounded: extended-precision
+//                                           range reduction and full-width
+//                                           polynomials
+//
+// with <fn> in {exp, log, sin, cos, tanh, sigmoid}. E.g.:
+//   vfloat32m4_t y = vmath_exp_fast_f32m4(x, vl);
+//
+// Strip-mined array versions are available as vmath_<fn>[_fast]_array_...:
+//   vmath_log_array_f64m2(const double *x, double *y, size_t n);
+//
+// The measured cycles/element and max ULP error of each function are
+// reported by the apps/vmath benchmark.
+//
+// Limitations:
+// - exp flushes results in the subnormal range to zero
+// - log treats subnormal inputs as the smallest normal number
+// - sin/cos: the reduction is accurate for |x| < 2^20 (f64), 2^13 (f32)
+//   and 100 (f16)
+
+#ifndef _VMATH_H_
+#define _VMATH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "riscv_vector.h"
+
+// Token pasting helpers
+#define VM_CAT_(a, b) a##b
+#define VM_CAT(a, b) VM_CAT_(a, b)
+#define VM_CAT3(a, b, c) VM_CAT(VM_CAT(a, b), c)
+#define VM_CAT4(a, b, c, d) VM_CAT(VM_CAT3(a, b, c), d)
+
+// Number of elements of a coefficient table
+#define VM_LEN(tab) (sizeof(tab) / sizeof(tab[0]))
+
+/////////////////////////
+// Coefficient tables  //
+/////////////////////////
+
+// Polynomial coefficients are stored from the highest degree down, and are
+// evaluated with Horner's scheme.
+
+// exp(r), |r| <= ln2/2
+// Fast: Cephes minimax coefficients, p(r) = P(r) * r^2 + r + 1
+// Accurate: Taylor series, truncated below 0.5 ULP
+static const double __vmath_exp_fast_p64[] = {
+    1.9875691500E-4, 1.3981999507E-3, 8.3334519073E-3, 4.1665795894E-2,
+    1.6666665459E-1, 5.0000001201E-1, 1.0,             1.0};
+static const float __vmath_exp_fast_p32[] = {
+    1.9875691500E-4, 1.3981999507E-3, 8.3334519073E-3, 4.1665795894E-2,
+    1.6666665459E-1, 5.0000001201E-1, 1.0,             1.0};
+static const _Float16 __vmath_exp_fast_p16[] = {1.0 / 6, 1.0 / 2, 1.0, 1.0};
+static const double __vmath_exp_p64[] = {
+    1.0 / 6227020800, 1.0 / 479001600, 1.0 / 39916800, 1.0 / 3628800,
+    1.0 / 362880,     1.0 / 40320,     1.0 / 5040,     1.0 / 720,
+    1.0 / 120,        1.0 / 24,        1.0 / 6,        1.0 / 2,
+    1.0,              1.0};
+static const float __vmath_exp_p32[] = {
+    1.0 / 5040, 1.0 / 720, 1.0 / 120, 1.0 / 24, 1.0 / 6, 1.0 / 2, 1.0, 1.0};
+static const _Float16 __vmath_exp_p16[] = {1.0 / 24, 1.0 / 6, 1.0 / 2, 1.0,
+                                           1.0};
+
+// log(1 + f), f in [sqrt(2)/2 - 1, sqrt(2) - 1]
+// Fast: Cephes, log(1 + f) = f - f^2/2 + f^3 * P(f)
+// Accurate: fdlibm, log(1 + f) = f - hfsq + s * (hfsq + z * R(z)), with
+// s = f / (2 + f), z = s^2 and hfsq = f^2/2
+static const double __vmath_log_fast_p64[] = {
+    7.0376836292E-2,  -1.1514610310E-1, 1.1676998740E-1,
+    -1.2420140846E-1, 1.4249322787E-1,  -1.6668057665E-1,
+    2.0000714765E-1,  -2.4999993993E-1, 3.3333331174E-1};
+static const float __vmath_log_fast_p32[] = {
+    7.0376836292E-2,  -1.1514610310E-1, 1.1676998740E-1,
+    -1.2420140846E-1, 1.4249322787E-1,  -1.6668057665E-1,
+    2.0000714765E-1,  -2.4999993993E-1, 3.3333331174E-1};
+static const _Float16 __vmath_log_fast_p16[] = {
+    7.0376836292E-2,  -1.1514610310E-1, 1.1676998740E-1,
+    -1.2420140846E-1, 1.4249322787E-1,  -1.6668057665E-1,
+    2.0000714765E-1,  -2.4999993993E-1, 3.3333331174E-1};
+static const double __vmath_log_p64[] = {
+    1.479819860511658591e-01, 1.531383769920937332e-01,
+    1.818357216161805012e-01, 2.222219843214978396e-01,
+    2.857142874366239149e-01, 3.999999999940941908e-01,
+    6.666666666666735130e-01};
+static const float __vmath_log_p32[] = {2.0 / 11, 2.0 / 9, 2.0 / 7, 2.0 / 5,
+                                        2.0 / 3};
+static const _Float16 __vmath_log_p16[] = {2.0 / 5, 2.0 / 3};
+
+// sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2/2 + r^4 * C(r^2), |r| <= pi/4
+// Fast: Cephes coefficients
+// Accurate: fdlibm (f64), Taylor series (f32, f16)
+static const double __vmath_sin_fast_p64[] = {
+    -1.9515295891E-4, 8.3321608736E-3, -1.6666654611E-1};
+static const float __vmath_sin_fast_p32[] = {-1.9515295891E-4, 8.3321608736E-3,
+                                             -1.6666654611E-1};
+static const _Float16 __vmath_sin_fast_p16[] = {-1.0 / 6};
+static const double __vmath_cos_fast_p64[] = {
+    2.443315711809948E-005, -1.388731625493765E-003, 4.166664568298827E-002};
+static const float __vmath_cos_fast_p32[] = {
+    2.443315711809948E-005, -1.388731625493765E-003, 4.166664568298827E-002};
+static const _Float16 __vmath_cos_fast_p16[] = {1.0 / 24};
+static const double __vmath_sin_p64[] = {
+    1.58969099521155010221e-10,  -2.50507602534068634195e-08,
+    2.75573137070700676789e-06,  -1.98412698298579493134e-04,
+    8.33333333332248946124e-03,  -1.66666666666666324348e-01};
+static const float __vmath_sin_p32[] = {1.0 / 362880, -1.0 / 5040, 1.0 / 120,
+                                        -1.0 / 6};
+static const _Float16 __vmath_sin_p16[] = {1.0 / 120, -1.0 / 6};
+static const double __vmath_cos_p64[] = {
+    -1.13596475577881948265e-11, 2.08757232129817482790e-09,
+    -2.75573143513906633035e-07, 2.48015872894767294178e-05,
+    -1.38888888888741095749e-03, 4.16666666666666019037e-02};
+static const float __vmath_cos_p32[] = {-1.0 / 3628800, 1.0 / 40320,
+                                        -1.0 / 720, 1.0 / 24};
+static const _Float16 __vmath_cos_p16[] = {-1.0 / 720, 1.0 / 24};
+
+// tanh(x) = x + x^3 * T(x^2), |x| < VM_TANH_SMALL (Taylor series)
+// Larger inputs use tanh(|x|) = 1 - 2 / (exp(2|x|) + 1)
+static const double __vmath_tanh_fast_p64[] = {
+    -1.45583438705131833039e-03, 3.59212803657248114231e-03,
+    -8.86323552990219733216e-03, 2.18694885361552029956e-02,
+    -5.39682539682539708092e-02, 1.33333333333333331483e-01,
+    -3.33333333333333314830e-01};
+static const float __vmath_tanh_fast_p32[] = {
+    -8.86323552990219733216e-03, 2.18694885361552029956e-02,
+    -5.39682539682539708092e-02, 1.33333333333333331483e-01,
+    -3.33333333333333314830e-01};
+static const _Float16 __vmath_tanh_fast_p16[] = {2.0 / 15, -1.0 / 3};
+static const double __vmath_tanh_p64[] = {
+    -1.05972683201046543272e-06, 2.61477115129075464740e-06,
+    -6.45168921565543064799e-06, 1.59189050693289636980e-05,
+    -3.92783238833168326797e-05, 9.69153795692945094946e-05,
+    -2.39129114243552477921e-04, 5.90027440945585946591e-04,
+    -1.45583438705131833039e-03, 3.59212803657248114231e-03,
+    -8.86323552990219733216e-03, 2.18694885361552029956e-02,
+    -5.39682539682539708092e-02, 1.33333333333333331483e-01,
+    -3.33333333333333314830e-01};
+static const float __vmath_tanh_p32[] = {
+    -1.45583438705131833039e-03, 3.59212803657248114231e-03,
+    -8.86323552990219733216e-03, 2.18694885361552029956e-02,
+    -5.39682539682539708092e-02, 1.33333333333333331483e-01,
+    -3.33333333333333314830e-01};
+static const _Float16 __vmath_tanh_p16[] = {-17.0 / 315, 2.0 / 15, -1.0 / 3};
+
+///////////////////////////
+// Template instantiation //
+///////////////////////////
+
+// Each inclusion of vmath_impl.h defines the whole library for one
+// (SEW, LMUL) pair. VM_MLEN is the ratio SEW/LMUL of the mask type.
+
+#define VM_SEW 16
+#define VM_LMUL m1
+#define VM_MLEN 16
+#include "vmath_impl.h"
+#define VM_SEW 16
+#define VM_LMUL m2
+#define VM_MLEN 8
+#include "vmath_impl.h"
+#define VM_SEW 16
+#define VM_LMUL m4
+#define VM_MLEN 4
+#include "vmath_impl.h"
+#define VM_SEW 16
+#define VM_LMUL m8
+#define VM_MLEN 2
+#include "vmath_impl.h"
+
+#define VM_SEW 32
+#define VM_LMUL m1
+#define VM_MLEN 32
+#include "vmath_impl.h"
+#define VM_SEW 32
+#define VM_LMUL m2
+#define VM_MLEN 16
+#include "vmath_impl.h"
+#define VM_SEW 32
+#define VM_LMUL m4
+#define VM_MLEN 8
+#include "vmath_impl.h"
+#define VM_SEW 32
+#define VM_LMUL m8
+#define VM_MLEN 4
+#include "vmath_impl.h"
+
+#define VM_SEW 64
+#define VM_LMUL m1
+#define VM_MLEN 64
+#include "vmath_impl.h"
+#define VM_SEW 64
+#define VM_LMUL m2
+#define VM_MLEN 32
+#include "vmath_impl.h"
+#define VM_SEW 64
+#define VM_LMUL m4
+#define VM_MLEN 16
+#include "vmath_impl.h"
+#define VM_SEW 64
+#define VM_LMUL m8
+#define VM_MLEN 8
+#include "vmath_impl.h"
+
+#endif // _VMATH_H_
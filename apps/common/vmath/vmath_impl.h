@@ -0,0 +1,366 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Vector math library body, instantiated by vmath.h once per (SEW, LMUL).
+// Do not include this file directly.
+//
+// Expects VM_SEW (16, 32, 64), VM_LMUL (m1, m2, m4, m8) and VM_MLEN
+// (SEW/LMUL) to be defined. They are undefined at the end of the file.
+
+#if !defined(VM_SEW) || !defined(VM_LMUL) || !defined(VM_MLEN)
+#error "vmath_impl.h must be included through vmath.h"
+#endif
+
+// Per-SEW scalar types and constants
+#if VM_SEW == 64
+#define VM_T double
+#define VM_IT int64_t
+#define VM_MANT 52
+#define VM_BIAS 1023
+#define VM_MANT_MASK 0x000FFFFFFFFFFFFFLL
+#define VM_ONE_BITS 0x3FF0000000000000LL
+#define VM_MIN_NORMAL 2.2250738585072014e-308
+// exp(x) is computed as 2^(n-1) * 2 * p(r), with n - 1 in [-1022, 1023]
+#define VM_EXP_HI 709.782712893384
+#define VM_EXP_LO -707.7032713517042
+#define VM_LN2_HI 6.93147180369123816490e-01
+#define VM_LN2_LO 1.90821492927058770002e-10
+#define VM_PIO2_HI 1.57079632673412561417e+00
+#define VM_PIO2_MID 6.07710050630396597660e-11
+#define VM_PIO2_LO 2.02226624879595063154e-21
+// Two-constant pi/2 split used by the fast tier
+#define VM_PIO2_MID_FAST 6.07710050650619224932e-11
+#elif VM_SEW == 32
+#define VM_T float
+#define VM_IT int32_t
+#define VM_MANT 23
+#define VM_BIAS 127
+#define VM_MANT_MASK 0x007FFFFF
+#define VM_ONE_BITS 0x3F800000
+#define VM_MIN_NORMAL 1.17549435e-38
+#define VM_EXP_HI 88.72283905206835
+#define VM_EXP_LO -86.64339756999316
+#define VM_LN2_HI 0.693359375
+#define VM_LN2_LO -2.12194440e-4
+#define VM_PIO2_HI 1.5703125
+#define VM_PIO2_MID 4.837512969970703125e-4
+#define VM_PIO2_LO 7.54978995489188216e-8
+#define VM_PIO2_MID_FAST 4.8382679e-4
+#elif VM_SEW == 16
+#define VM_T _Float16
+#define VM_IT int16_t
+#define VM_MANT 10
+#define VM_BIAS 15
+#define VM_MANT_MASK 0x03FF
+#define VM_ONE_BITS 0x3C00
+#define VM_MIN_NORMAL 6.103515625e-05
+#define VM_EXP_HI 11.089866488461016
+#define VM_EXP_LO -9.010913347279288
+#define VM_LN2_HI 0.6875
+#define VM_LN2_LO 0.005647180559945286
+#define VM_PIO2_HI 1.5625
+#define VM_PIO2_MID 0.00830078125
+#define VM_PIO2_LO -4.454455103442001e-06
+#define VM_PIO2_MID_FAST 0.008296326794896558
+#else
+#error "vmath: unsupported VM_SEW"
+#endif
+
+#define VM_LOG2E 1.4426950408889634
+#define VM_2OPI 0.6366197723675814
+#define VM_SQRT2 1.4142135623730951
+// Below this threshold tanh uses its odd series
+#define VM_TANH_SMALL 0.4
+
+// Type and intrinsic name builders, e.g. with VM_SEW=64, VM_LMUL=m2:
+//   VM_VF            -> vfloat64m2_t
+//   VM_F(vfadd_vv)   -> __riscv_vfadd_vv_f64m2
+//   VM_I(vadd_vx)    -> __riscv_vadd_vx_i64m2
+//   VM_FB(vmflt_vf)  -> __riscv_vmflt_vf_f64m2_b32
+//   VM_NAME(vmath_exp) -> vmath_exp_f64m2
+#define VM_TAG VM_CAT(VM_SEW, VM_LMUL)
+#define VM_VF VM_CAT3(vfloat, VM_TAG, _t)
+#define VM_VI VM_CAT3(vint, VM_TAG, _t)
+#define VM_VB VM_CAT3(vbool, VM_MLEN, _t)
+#define VM_F(op) VM_CAT3(__riscv_, op, VM_CAT(_f, VM_TAG))
+#define VM_I(op) VM_CAT3(__riscv_, op, VM_CAT(_i, VM_TAG))
+#define VM_FB(op) VM_CAT(VM_F(op), VM_CAT(_b, VM_MLEN))
+#define VM_IB(op) VM_CAT(VM_I(op), VM_CAT(_b, VM_MLEN))
+#define VM_F2I(v)                                                              \
+  VM_CAT4(__riscv_vreinterpret_v_f, VM_TAG, _i, VM_TAG)(v)
+#define VM_I2F(v)                                                              \
+  VM_CAT4(__riscv_vreinterpret_v_i, VM_TAG, _f, VM_TAG)(v)
+#define VM_LOAD VM_CAT4(__riscv_vle, VM_SEW, _v_f, VM_TAG)
+#define VM_STORE VM_CAT4(__riscv_vse, VM_SEW, _v_f, VM_TAG)
+#define VM_VSETVL VM_CAT(__riscv_vsetvl_e, VM_TAG)
+#define VM_NAME(fn) VM_CAT(fn, VM_CAT(_f, VM_TAG))
+#define VM_POLY(x, tab)                                                        \
+  VM_NAME(__vmath_horner)(x, VM_CAT(tab, VM_SEW), VM_LEN(VM_CAT(tab, VM_SEW)), \
+                          vl)
+
+/////////////
+// Helpers //
+/////////////
+
+// Horner's scheme, c[0] is the highest-degree coefficient
+static inline VM_VF VM_NAME(__vmath_horner)(VM_VF x, const VM_T *c, size_t n,
+                                            size_t vl) {
+  VM_VF y = VM_F(vfmv_v_f)(c[0], vl);
+  for (size_t i = 1; i < n; ++i)
+    y = VM_F(vfmadd_vv)(y, x, VM_F(vfmv_v_f)(c[i], vl), vl);
+  return y;
+}
+
+/////////
+// exp //
+/////////
+
+static inline VM_VF VM_NAME(__vmath_exp)(VM_VF x, int accurate, size_t vl) {
+  VM_VB ovf = VM_FB(vmfgt_vf)(x, VM_EXP_HI, vl);
+  VM_VB unf = VM_FB(vmflt_vf)(x, VM_EXP_LO, vl);
+  VM_VB nan = VM_FB(vmfne_vv)(x, x, vl);
+  VM_VF x_in = x;
+
+  x = VM_F(vfmin_vf)(x, VM_EXP_HI, vl);
+  x = VM_F(vfmax_vf)(x, VM_EXP_LO, vl);
+
+  // n = round(x / ln2), r = x - n * ln2 (Cody-Waite)
+  VM_VI n_i = VM_I(vfcvt_x_f_v)(VM_F(vfmul_vf)(x, VM_LOG2E, vl), vl);
+  VM_VF n = VM_F(vfcvt_f_x_v)(n_i, vl);
+  VM_VF r = VM_F(vfnmsac_vf)(x, VM_LN2_HI, n, vl);
+  r = VM_F(vfnmsac_vf)(r, VM_LN2_LO, n, vl);
+
+  VM_VF y = accurate ? VM_POLY(r, __vmath_exp_p) : VM_POLY(r, __vmath_exp_fast_p);
+
+  // Scale by 2^(n-1) and double, so that n = emax + 1 does not overflow the
+  // exponent field
+  n_i = VM_I(vadd_vx)(n_i, VM_BIAS - 1, vl);
+  n_i = VM_I(vsll_vx)(n_i, VM_MANT, vl);
+  y = VM_F(vfmul_vv)(y, VM_I2F(n_i), vl);
+  y = VM_F(vfadd_vv)(y, y, vl);
+
+  y = VM_F(vfmerge_vfm)(y, __builtin_inf(), ovf, vl);
+  y = VM_F(vfmerge_vfm)(y, 0, unf, vl);
+  if (accurate)
+    y = VM_F(vmerge_vvm)(y, x_in, nan, vl);
+  return y;
+}
+
+/////////
+// log //
+/////////
+
+static inline VM_VF VM_NAME(__vmath_log)(VM_VF x, int accurate, size_t vl) {
+  VM_VB neg = VM_FB(vmflt_vf)(x, 0, vl);
+  VM_VB zero = VM_FB(vmfeq_vf)(x, 0, vl);
+  VM_VB inf = VM_FB(vmfeq_vf)(x, __builtin_inf(), vl);
+  VM_VB nan = VM_FB(vmfne_vv)(x, x, vl);
+
+  // x = m * 2^e, m in (sqrt(2)/2, sqrt(2)]
+  VM_VI x_i = VM_F2I(VM_F(vfmax_vf)(x, VM_MIN_NORMAL, vl));
+  VM_VI e_i = VM_I(vsub_vx)(VM_I(vsra_vx)(x_i, VM_MANT, vl), VM_BIAS, vl);
+  x_i = VM_I(vand_vx)(x_i, VM_MANT_MASK, vl);
+  x_i = VM_I(vor_vx)(x_i, VM_ONE_BITS, vl);
+  VM_VF m = VM_I2F(x_i);
+  VM_VB big = VM_FB(vmfgt_vf)(m, VM_SQRT2, vl);
+  m = VM_F(vmerge_vvm)(m, VM_F(vfmul_vf)(m, 0.5, vl), big, vl);
+  e_i = VM_I(vmerge_vvm)(e_i, VM_I(vadd_vx)(e_i, 1, vl), big, vl);
+  VM_VF k = VM_F(vfcvt_f_x_v)(e_i, vl);
+  VM_VF f = VM_F(vfsub_vf)(m, 1.0, vl);
+  VM_VF y;
+
+  if (accurate) {
+    // log(x) = k*ln2_hi - ((hfsq - (s*(hfsq + R) + k*ln2_lo)) - f)
+    VM_VF s = VM_F(vfdiv_vv)(f, VM_F(vfadd_vf)(f, 2.0, vl), vl);
+    VM_VF z = VM_F(vfmul_vv)(s, s, vl);
+    VM_VF R = VM_F(vfmul_vv)(z, VM_POLY(z, __vmath_log_p), vl);
+    VM_VF hfsq = VM_F(vfmul_vf)(VM_F(vfmul_vv)(f, f, vl), 0.5, vl);
+    VM_VF t = VM_F(vfmul_vv)(s, VM_F(vfadd_vv)(hfsq, R, vl), vl);
+    t = VM_F(vfmacc_vf)(t, VM_LN2_LO, k, vl);
+    t = VM_F(vfsub_vv)(VM_F(vfsub_vv)(hfsq, t, vl), f, vl);
+    y = VM_F(vfmsac_vf)(t, VM_LN2_HI, k, vl);
+  } else {
+    // log(x) = f - f^2/2 + f^3 * P(f) + k*ln2
+    VM_VF z = VM_F(vfmul_vv)(f, f, vl);
+    y = VM_F(vfmul_vv)(VM_POLY(f, __vmath_log_fast_p), z, vl);
+    y = VM_F(vfmul_vv)(y, f, vl);
+    y = VM_F(vfmacc_vf)(y, VM_LN2_LO, k, vl);
+    y = VM_F(vfnmsac_vf)(y, 0.5, z, vl);
+    y = VM_F(vfadd_vv)(y, f, vl);
+    y = VM_F(vfmacc_vf)(y, VM_LN2_HI, k, vl);
+  }
+
+  y = VM_F(vfmerge_vfm)(y, __builtin_nan(""), neg, vl);
+  y = VM_F(vfmerge_vfm)(y, -__builtin_inf(), zero, vl);
+  y = VM_F(vfmerge_vfm)(y, __builtin_inf(), inf, vl);
+  if (accurate)
+    y = VM_F(vmerge_vvm)(y, x, nan, vl);
+  return y;
+}
+
+/////////////
+// sin/cos //
+/////////////
+
+// sin(x + q * pi/2), with q = 0 for sin and q = 1 for cos
+static inline VM_VF VM_NAME(__vmath_sincos)(VM_VF x, int q, int accurate,
+                                            size_t vl) {
+  // n = round(x * 2/pi), r = x - n * pi/2 in two or three parts
+  VM_VI n_i = VM_I(vfcvt_x_f_v)(VM_F(vfmul_vf)(x, VM_2OPI, vl), vl);
+  VM_VF n = VM_F(vfcvt_f_x_v)(n_i, vl);
+  VM_VF r = VM_F(vfnmsac_vf)(x, VM_PIO2_HI, n, vl);
+  if (accurate) {
+    r = VM_F(vfnmsac_vf)(r, VM_PIO2_MID, n, vl);
+    r = VM_F(vfnmsac_vf)(r, VM_PIO2_LO, n, vl);
+  } else {
+    r = VM_F(vfnmsac_vf)(r, VM_PIO2_MID_FAST, n, vl);
+  }
+  VM_VF z = VM_F(vfmul_vv)(r, r, vl);
+
+  // sin(r) = r + r * z * S(z)
+  VM_VF s = accurate ? VM_POLY(z, __vmath_sin_p) : VM_POLY(z, __vmath_sin_fast_p);
+  s = VM_F(vfmul_vv)(s, z, vl);
+  s = VM_F(vfmadd_vv)(s, r, r, vl);
+
+  // cos(r) = (1 - z/2) + z * z * C(z)
+  VM_VF c = accurate ? VM_POLY(z, __vmath_cos_p) : VM_POLY(z, __vmath_cos_fast_p);
+  VM_VF w = VM_F(vfrsub_vf)(VM_F(vfmul_vf)(z, 0.5, vl), 1.0, vl);
+  c = VM_F(vfmul_vv)(c, z, vl);
+  c = VM_F(vfmadd_vv)(c, z, w, vl);
+
+  // Quadrant selection: odd quadrants use cos(r), quadrants 2 and 3 negate
+  n_i = VM_I(vadd_vx)(n_i, q, vl);
+  VM_VB swap = VM_IB(vmsne_vx)(VM_I(vand_vx)(n_i, 1, vl), 0, vl);
+  VM_VB flip = VM_IB(vmsne_vx)(VM_I(vand_vx)(n_i, 2, vl), 0, vl);
+  VM_VF y = VM_F(vmerge_vvm)(s, c, swap, vl);
+  y = VM_F(vmerge_vvm)(y, VM_F(vfneg_v)(y, vl), flip, vl);
+  return y;
+}
+
+//////////
+// tanh //
+//////////
+
+static inline VM_VF VM_NAME(__vmath_tanh)(VM_VF x, int accurate, size_t vl) {
+  VM_VF a = VM_F(vfabs_v)(x, vl);
+
+  // Large |x|: 1 - 2 / (exp(2|x|) + 1)
+  VM_VF e = VM_NAME(__vmath_exp)(VM_F(vfadd_vv)(a, a, vl), accurate, vl);
+  VM_VF y = VM_F(vfrdiv_vf)(VM_F(vfadd_vf)(e, 1.0, vl), 2.0, vl);
+  y = VM_F(vfrsub_vf)(y, 1.0, vl);
+
+  // Small |x|: a + a * z * T(z), avoids the cancellation above
+  VM_VF z = VM_F(vfmul_vv)(a, a, vl);
+  VM_VF p =
+      accurate ? VM_POLY(z, __vmath_tanh_p) : VM_POLY(z, __vmath_tanh_fast_p);
+  p = VM_F(vfmul_vv)(p, z, vl);
+  p = VM_F(vfmadd_vv)(p, a, a, vl);
+  VM_VB small = VM_FB(vmflt_vf)(a, VM_TANH_SMALL, vl);
+  y = VM_F(vmerge_vvm)(y, p, small, vl);
+
+  return VM_F(vfsgnj_vv)(y, x, vl);
+}
+
+/////////////
+// sigmoid //
+/////////////
+
+static inline VM_VF VM_NAME(__vmath_sigmoid)(VM_VF x, int accurate,
+                                             size_t vl) {
+  // 1 / (1 + exp(-x)), saturates to 0 when exp(-x) overflows
+  VM_VF e = VM_NAME(__vmath_exp)(VM_F(vfneg_v)(x, vl), accurate, vl);
+  return VM_F(vfrdiv_vf)(VM_F(vfadd_vf)(e, 1.0, vl), 1.0, vl);
+}
+
+////////////////
+// Public API //
+////////////////
+
+// Register-level and strip-mined array functions, for both tiers
+#define VM_DEFINE(fn, body)                                                    \
+  static inline VM_VF VM_NAME(vmath_##fn)(VM_VF x, size_t vl) {                \
+    return body(x, 1, vl);                                                     \
+  }                                                                            \
+  static inline VM_VF VM_NAME(vmath_##fn##_fast)(VM_VF x, size_t vl) {         \
+    return body(x, 0, vl);                                                     \
+  }                                                                            \
+  static inline void VM_NAME(vmath_##fn##_array)(const VM_T *x, VM_T *y,       \
+                                                 size_t n) {                   \
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {                        \
+      vl = VM_VSETVL(n);                                                       \
+      VM_STORE(y, body(VM_LOAD(x, vl), 1, vl), vl);                            \
+    }                                                                          \
+  }                                                                            \
+  static inline void VM_NAME(vmath_##fn##_fast_array)(const VM_T *x, VM_T *y,  \
+                                                      size_t n) {              \
+    for (size_t vl; n > 0; n -= vl, x += vl, y += vl) {                        \
+      vl = VM_VSETVL(n);                                                       \
+      VM_STORE(y, body(VM_LOAD(x, vl), 0, vl), vl);                            \
+    }                                                                          \
+  }
+
+#define VM_SIN(x, accurate, vl) VM_NAME(__vmath_sincos)(x, 0, accurate, vl)
+#define VM_COS(x, accurate, vl) VM_NAME(__vmath_sincos)(x, 1, accurate, vl)
+
+VM_DEFINE(exp, VM_NAME(__vmath_exp))
+VM_DEFINE(log, VM_NAME(__vmath_log))
+VM_DEFINE(sin, VM_SIN)
+VM_DEFINE(cos, VM_COS)
+VM_DEFINE(tanh, VM_NAME(__vmath_tanh))
+VM_DEFINE(sigmoid, VM_NAME(__vmath_sigmoid))
+
+#undef VM_DEFINE
+#undef VM_SIN
+#undef VM_COS
+
+#undef VM_T
+#undef VM_IT
+#undef VM_MANT
+#undef VM_BIAS
+#undef VM_MANT_MASK
+#undef VM_ONE_BITS
+#undef VM_MIN_NORMAL
+#undef VM_EXP_HI
+#undef VM_EXP_LO
+#undef VM_LN2_HI
+#undef VM_LN2_LO
+#undef VM_PIO2_HI
+#undef VM_PIO2_MID
+#undef VM_PIO2_LO
+#undef VM_PIO2_MID_FAST
+#undef VM_LOG2E
+#undef VM_2OPI
+#undef VM_SQRT2
+#undef VM_TANH_SMALL
+#undef VM_TAG
+#undef VM_VF
+#undef VM_VI
+#undef VM_VB
+#undef VM_F
+#undef VM_I
+#undef VM_FB
+#undef VM_IB
+#undef VM_F2I
+#undef VM_I2F
+#undef VM_LOAD
+#undef VM_STORE
+#undef VM_VSETVL
+#undef VM_NAME
+#undef VM_POLY
+
+#undef VM_SEW
+#undef VM_LMUL
+#undef VM_MLEN
@@ -0,0 +1,139 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Vector string.h routines. They override the weak scalar ones of string.c
+// when linked into the runtime (RUNTIME_VSTRING=1, see runtime.mk).
+//
+// Every loop works on e8, LMUL=8 chunks. Below VSTRING_SCALAR_MAX bytes, the
+// vector setup costs more than it saves, and a scalar loop is used instead.
+// strlen and strcmp do not know the length in advance: they check the first
+// VSTRING_SCALAR_MAX bytes with scalar code, and continue with
+// fault-only-first loads, so that they never fault past the terminator.
+//
+// The routines use v0, v1 and v8-v23, which are caller-saved.
+
+#include <stdint.h>
+#include <string.h>
+
+#define VSTRING_SCALAR_MAX 32
+
+void *memcpy(void *dest, const void *src, size_t len) {
+  unsigned char *d = dest;
+  const unsigned char *s = src;
+  size_t vl;
+
+  if (len < VSTRING_SCALAR_MAX) {
+    while (len--)
+      *d++ = *s++;
+    return dest;
+  }
+
+  for (; len > 0; len -= vl, s += vl, d += vl) {
+    asm volatile("vsetvli %0, %1, e8, m8, ta, ma" : "=r"(vl) : "r"(len));
+    asm volatile("vle8.v v8, (%0)" ::"r"(s) : "memory");
+    asm volatile("vse8.v v8, (%0)" ::"r"(d) : "memory");
+  }
+  return dest;
+}
+
+void *memset(void *dest, int byte, size_t len) {
+  unsigned char *d = dest;
+  size_t vl;
+
+  if (len < VSTRING_SCALAR_MAX) {
+    while (len--)
+      *d++ = (unsigned char)byte;
+    return dest;
+  }
+
+  asm volatile("vsetvli %0, %1, e8, m8, ta, ma" : "=r"(vl) : "r"(len));
+  asm volatile("vmv.v.x v8, %0" ::"r"(byte));
+  for (; len > 0; len -= vl, d += vl) {
+    asm volatile("vsetvli %0, %1, e8, m8, ta, ma" : "=r"(vl) : "r"(len));
+    asm volatile("vse8.v v8, (%0)" ::"r"(d) : "memory");
+  }
+  return dest;
+}
+
+int memcmp(const void *s1, const void *s2, size_t n) {
+  const unsigned char *p1 = s1;
+  const unsigned char *p2 = s2;
+  size_t vl;
+  long idx;
+
+  if (n < VSTRING_SCALAR_MAX) {
+    for (; n > 0; n--, p1++, p2++)
+      if (*p1 != *p2)
+        return *p1 - *p2;
+    return 0;
+  }
+
+  for (; n > 0; n -= vl, p1 += vl, p2 += vl) {
+    asm volatile("vsetvli %0, %1, e8, m8, ta, ma" : "=r"(vl) : "r"(n));
+    asm volatile("vle8.v v8, (%0)" ::"r"(p1) : "memory");
+    asm volatile("vle8.v v16, (%0)" ::"r"(p2) : "memory");
+    asm volatile("vmsne.vv v0, v8, v16");
+    asm volatile("vfirst.m %0, v0" : "=r"(idx));
+    if (idx >= 0)
+      return p1[idx] - p2[idx];
+  }
+  return 0;
+}
+
+size_t strlen(const char *s) {
+  const unsigned char *p = (const unsigned char *)s;
+  size_t vl;
+  long idx;
+
+  for (; p < (const unsigned char *)s + VSTRING_SCALAR_MAX; ++p)
+    if (!*p)
+      return (size_t)(p - (const unsigned char *)s);
+
+  for (;; p += vl) {
+    asm volatile("vsetvli zero, %0, e8, m8, ta, ma" ::"r"(-1));
+    asm volatile("vle8ff.v v8, (%0)" ::"r"(p) : "memory");
+    asm volatile("csrr %0, vl" : "=r"(vl));
+    asm volatile("vmseq.vi v0, v8, 0");
+    asm volatile("vfirst.m %0, v0" : "=r"(idx));
+    if (idx >= 0)
+      return (size_t)(p - (const unsigned char *)s) + idx;
+  }
+}
+
+int strcmp(const char *s1, const char *s2) {
+  const unsigned char *p1 = (const unsigned char *)s1;
+  const unsigned char *p2 = (const unsigned char *)s2;
+  size_t vl;
+  long idx;
+
+  for (int i = 0; i < VSTRING_SCALAR_MAX; ++i, ++p1, ++p2)
+    if (*p1 == 0 || *p1 != *p2)
+      return *p1 - *p2;
+
+  for (;; p1 += vl, p2 += vl) {
+    // The second load can only shorten vl further
+    asm volatile("vsetvli zero, %0, e8, m8, ta, ma" ::"r"(-1));
+    asm volatile("vle8ff.v v8, (%0)" ::"r"(p1) : "memory");
+    asm volatile("vle8ff.v v16, (%0)" ::"r"(p2) : "memory");
+    asm volatile("csrr %0, vl" : "=r"(vl));
+    asm volatile("vmsne.vv v0, v8, v16");
+    asm volatile("vmseq.vi v1, v8, 0");
+    asm volatile("vmor.mm v0, v0, v1");
+    asm volatile("vfirst.m %0, v0" : "=r"(idx));
+    if (idx >= 0)
+      return p1[idx] - p2[idx];
+  }
+}
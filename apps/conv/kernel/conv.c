@@ -0,0 +1,108 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <riscv_vector.h>
+
+#include "conv.h"
+
+#define CV_CAT_(a, b) a##b
+#define CV_CAT(a, b) CV_CAT_(a, b)
+#define CV_CAT3(a, b, c) CV_CAT(CV_CAT(a, b), c)
+#define CV_CAT4(a, b, c, d) CV_CAT(CV_CAT3(a, b, c), d)
+
+// Winograd transform matrices (Lavin and Gray), row-major:
+// B^T is a x a, G is a x 3, A^T is m x a
+typedef struct {
+  size_t a;
+  const double *bt;
+  const double *g;
+  const double *at;
+} conv_wino_t;
+
+static const double conv_bt2[] = {1, 0, -1, 0, 0, 1, 1, 0,
+                                  0, -1, 1, 0, 0, 1, 0, -1};
+static const double conv_g2[] = {1, 0, 0, 0.5, 0.5, 0.5, 0.5, -0.5, 0.5,
+                                 0, 0, 1};
+static const double conv_at2[] = {1, 1, 1, 0, 0, 1, -1, -1};
+
+static const double conv_bt4[] = {
+    4, 0, -5, 0,  1, 0, 0, -4, -4, 1,  1, 0, 0, 4, -4, -1, 1, 0,
+    0, -2, -1, 2, 1, 0, 0, 2,  -1, -2, 1, 0, 0, 4, 0,  -5, 0, 1};
+static const double conv_g4[] = {1.0 / 4,   0,          0,
+                                 -1.0 / 6,  -1.0 / 6,   -1.0 / 6,
+                                 -1.0 / 6,  1.0 / 6,    -1.0 / 6,
+                                 1.0 / 24,  1.0 / 12,   1.0 / 6,
+                                 1.0 / 24,  -1.0 / 12,  1.0 / 6,
+                                 0,         0,          1};
+static const double conv_at4[] = {1, 1, 1, 1, 1, 0, 0, 1, -1, 2, -2, 0,
+                                  0, 1, 1, 4, 4, 0, 0, 1, -1, 8, -8, 1};
+
+static const conv_wino_t conv_wino2 = {4, conv_bt2, conv_g2, conv_at2};
+static const conv_wino_t conv_wino4 = {6, conv_bt4, conv_g4, conv_at4};
+
+static const conv_wino_t *conv_wino(int m) {
+  return m == 2 ? &conv_wino2 : m == 4 ? &conv_wino4 : NULL;
+}
+
+// Tiles processed per vector: a row of tiles, up to VLMAX at LMUL=4
+static size_t conv_wino_chunk(const conv_shape_t *s, int m, size_t esize) {
+  const size_t ow = conv_out_dim(s->w, 3, 1, s->pw);
+  const size_t tw = (ow + m - 1) / m;
+  size_t vlmax;
+  switch (esize) {
+  case 8:
+    vlmax = __riscv_vsetvlmax_e64m4();
+    break;
+  case 4:
+    vlmax = __riscv_vsetvlmax_e32m4();
+    break;
+  default:
+    vlmax = __riscv_vsetvlmax_e16m4();
+  }
+  return tw < vlmax ? tw : vlmax;
+}
+
+size_t conv2d_winograd_workspace(const conv_shape_t *s, int m, size_t esize) {
+  const conv_wino_t *t = conv_wino(m);
+  if (!t)
+    return 0;
+  const size_t a2 = t->a * t->a;
+  const size_t nt = conv_wino_chunk(s, m, esize);
+  return esize *
+         (s->c_out * s->c_in * a2 + (s->c_in + 5) * a2 * nt + t->a * nt);
+}
+
+#define CV_KIND f
+#define CV_SEW 64
+#include "conv_impl.h"
+#define CV_KIND f
+#define CV_SEW 32
+#include "conv_impl.h"
+#define CV_KIND f
+#define CV_SEW 16
+#include "conv_impl.h"
+#define CV_KIND i
+#define CV_SEW 64
+#include "conv_impl.h"
+#define CV_KIND i
+#define CV_SEW 32
+#include "conv_impl.h"
+#define CV_KIND i
+#define CV_SEW 16
+#include "conv_impl.h"
+#define CV_KIND i
+#define CV_SEW 8
+#include "conv_impl.h"
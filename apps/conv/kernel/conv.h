@@ -0,0 +1,84 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Convolution library
+//
+// Direct convolution, for any filter size, stride, zero padding and number
+// of channels, without im2col buffers:
+//
+//   int conv2d_<sfx>(const conv_shape_t *s, const T *in, const T *w, T *out);
+//   int conv3d_<sfx>(const conv_shape_t *s, const T *in, const T *w, T *out);
+//
+// with <sfx> in {f64, f32, f16, i64, i32, i16, i8}. Integer convolutions
+// accumulate in the element type and wrap around on overflow.
+//
+// Winograd F(2x2, 3x3) and F(4x4, 3x3) fast path for 3x3 filters with unit
+// stride, for the floating-point types. The transformed filters and inputs
+// are kept in a caller-provided workspace of
+// conv2d_winograd_workspace(s, m, sizeof(T)) bytes:
+//
+//   int conv2d_winograd_<sfx>(const conv_shape_t *s, int m, const T *in,
+//                             const T *w, T *out, void *ws);
+//
+// Layouts: in[c_in][d][h][w], w[c_out][c_in][kd][kh][kw] and
+// out[c_out][od][oh][ow]. The 2D functions ignore d, kd, sd and pd.
+// All functions return 0, or -1 if the shape is not supported.
+
+#ifndef _CONV_H_
+#define _CONV_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+  // Input channels and size
+  size_t c_in, d, h, w;
+  // Output channels and filter size
+  size_t c_out, kd, kh, kw;
+  // Strides and zero padding
+  size_t sd, sh, sw;
+  size_t pd, ph, pw;
+} conv_shape_t;
+
+// Output size along one dimension
+static inline size_t conv_out_dim(size_t in, size_t k, size_t s, size_t p) {
+  return (in + 2 * p - k) / s + 1;
+}
+
+size_t conv2d_winograd_workspace(const conv_shape_t *s, int m, size_t esize);
+
+#define CONV_DECLARE(T, sfx)                                                   \
+  int conv2d_##sfx(const conv_shape_t *s, const T *in, const T *w, T *out);    \
+  int conv3d_##sfx(const conv_shape_t *s, const T *in, const T *w, T *out);
+#define CONV_DECLARE_WINOGRAD(T, sfx)                                          \
+  int conv2d_winograd_##sfx(const conv_shape_t *s, int m, const T *in,         \
+                            const T *w, T *out, void *ws);
+
+CONV_DECLARE(double, f64)
+CONV_DECLARE(float, f32)
+CONV_DECLARE(_Float16, f16)
+CONV_DECLARE(int64_t, i64)
+CONV_DECLARE(int32_t, i32)
+CONV_DECLARE(int16_t, i16)
+CONV_DECLARE(int8_t, i8)
+CONV_DECLARE_WINOGRAD(double, f64)
+CONV_DECLARE_WINOGRAD(float, f32)
+CONV_DECLARE_WINOGRAD(_Float16, f16)
+
+#undef CONV_DECLARE
+#undef CONV_DECLARE_WINOGRAD
+
+#endif
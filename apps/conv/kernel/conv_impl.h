@@ -0,0 +1,387 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Convolution library body, instantiated by conv.c once per element type.
+// Do not include this file directly.
+//
+// Expects CV_KIND (f, i) and CV_SEW (8, 16, 32, 64) to be defined. They are
+// undefined at the end of the file. All the vectors are LMUL=4.
+
+#if !defined(CV_KIND) || !defined(CV_SEW)
+#error "conv_impl.h must be included through conv.c"
+#endif
+
+#define CV_f 1
+#define CV_i 0
+#define CV_FLOAT CV_CAT(CV_, CV_KIND)
+
+#if CV_FLOAT && CV_SEW == 64
+#define CV_T double
+#elif CV_FLOAT && CV_SEW == 32
+#define CV_T float
+#elif CV_FLOAT && CV_SEW == 16
+#define CV_T _Float16
+#elif !CV_FLOAT && CV_SEW == 64
+#define CV_T int64_t
+#elif !CV_FLOAT && CV_SEW == 32
+#define CV_T int32_t
+#elif !CV_FLOAT && CV_SEW == 16
+#define CV_T int16_t
+#elif !CV_FLOAT && CV_SEW == 8
+#define CV_T int8_t
+#else
+#error "conv: unsupported element type"
+#endif
+
+// Type and intrinsic name builders, e.g. with CV_KIND=f, CV_SEW=32:
+//   CV_V               -> vfloat32m4_t
+//   CV_OP(vslidedown_vx) -> __riscv_vslidedown_vx_f32m4
+//   CV_NAME(conv2d)    -> conv2d_f32
+#define CV_TAG CV_CAT3(CV_KIND, CV_SEW, m4)
+#if CV_FLOAT
+#define CV_V CV_CAT3(vfloat, CV_SEW, m4_t)
+#define CV_MACC CV_OP(vfmacc_vf)
+#define CV_ZERO(vl) CV_OP(vfmv_v_f)(0, vl)
+#else
+#define CV_V CV_CAT3(vint, CV_SEW, m4_t)
+#define CV_MACC CV_OP(vmacc_vx)
+#define CV_ZERO(vl) CV_OP(vmv_v_x)(0, vl)
+#endif
+#define CV_OP(op) CV_CAT4(__riscv_, op, _, CV_TAG)
+#define CV_LOAD CV_CAT4(__riscv_vle, CV_SEW, _v_, CV_TAG)
+#define CV_SLOAD CV_CAT4(__riscv_vlse, CV_SEW, _v_, CV_TAG)
+#define CV_STORE CV_CAT4(__riscv_vse, CV_SEW, _v_, CV_TAG)
+#define CV_SSTORE CV_CAT4(__riscv_vsse, CV_SEW, _v_, CV_TAG)
+#define CV_VSETVL CV_CAT3(__riscv_vsetvl_e, CV_SEW, m4)
+#define CV_VSETVLMAX CV_CAT3(__riscv_vsetvlmax_e, CV_SEW, m4)
+#define CV_NAME(fn) CV_CAT3(fn, _, CV_CAT(CV_KIND, CV_SEW))
+
+/////////////
+// Helpers //
+/////////////
+
+// Load n elements, step elements apart, from row[start]. The elements that
+// fall outside the row [0, w) are zero: only the valid lanes are loaded, and
+// slid up into a zero vector.
+static inline CV_V CV_NAME(__conv_load_row)(const CV_T *row, long start,
+                                            size_t step, size_t n, size_t w) {
+  size_t lo = start < 0 ? ((size_t)-start + step - 1) / step : 0;
+  size_t hi =
+      start < (long)w ? ((size_t)((long)w - start) + step - 1) / step : 0;
+  if (hi > n)
+    hi = n;
+
+  const CV_T *p = row + start + (long)(lo * step);
+  CV_V v;
+  if (lo >= hi)
+    return CV_ZERO(n);
+  if (step == 1)
+    v = CV_LOAD(p, hi - lo);
+  else
+    v = CV_SLOAD(p, step * sizeof(CV_T), hi - lo);
+  if (lo == 0 && hi == n)
+    return v;
+  return CV_CAT(CV_OP(vslideup_vx), _tu)(CV_ZERO(n), v, lo, hi);
+}
+
+////////////
+// Direct //
+////////////
+
+// Accumulate the tap (ky, kx) of output row y0 + r of the block, if the
+// current input row contributes to it
+#define CV_ROW_MACC(acc, r)                                                    \
+  do {                                                                         \
+    long ky = iy + (long)s->ph - (long)((y0 + r) * s->sh);                     \
+    if (r < rows && ky >= 0 && ky < (long)s->kh)                               \
+      acc = CV_MACC(acc, k[ky * s->kw + kx], v, vl);                           \
+  } while (0)
+
+// The block is 4 output rows by one strip of vl output columns, with the
+// accumulators in registers. Every input row read by the block is loaded
+// once per filter plane. With unit stride, the row is loaded with kw - 1
+// extra elements and the kw shifted copies are slid down from it, otherwise
+// every column tap is a strided load.
+int CV_NAME(conv3d)(const conv_shape_t *s, const CV_T *in, const CV_T *w,
+                    CV_T *out) {
+  if (!s->sd || !s->sh || !s->sw || !s->kd || !s->kh || !s->kw ||
+      s->d + 2 * s->pd < s->kd || s->h + 2 * s->ph < s->kh ||
+      s->w + 2 * s->pw < s->kw)
+    return -1;
+
+  const size_t od = conv_out_dim(s->d, s->kd, s->sd, s->pd);
+  const size_t oh = conv_out_dim(s->h, s->kh, s->sh, s->ph);
+  const size_t ow = conv_out_dim(s->w, s->kw, s->sw, s->pw);
+  const size_t ext = s->sw == 1 ? s->kw - 1 : 0;
+  const size_t vlmax = CV_VSETVLMAX();
+  if (vlmax <= ext)
+    return -1;
+  const size_t chunk = vlmax - ext;
+  const size_t plane = s->h * s->w;
+  const size_t ksize = s->kd * s->kh * s->kw;
+
+  for (size_t co = 0; co < s->c_out; ++co)
+    for (size_t z = 0; z < od; ++z)
+      for (size_t y0 = 0; y0 < oh; y0 += 4) {
+        const size_t rows = oh - y0 < 4 ? oh - y0 : 4;
+        CV_T *dst = out + ((co * od + z) * oh + y0) * ow;
+        size_t vl;
+        for (size_t x0 = 0; x0 < ow; x0 += vl) {
+          vl = CV_VSETVL(ow - x0 < chunk ? ow - x0 : chunk);
+          CV_V acc0 = CV_ZERO(vl);
+          CV_V acc1 = CV_ZERO(vl);
+          CV_V acc2 = CV_ZERO(vl);
+          CV_V acc3 = CV_ZERO(vl);
+          const long col = (long)(x0 * s->sw) - (long)s->pw;
+
+          for (size_t ci = 0; ci < s->c_in; ++ci)
+            for (size_t kz = 0; kz < s->kd; ++kz) {
+              const long iz = (long)(z * s->sd + kz) - (long)s->pd;
+              if (iz < 0 || iz >= (long)s->d)
+                continue;
+              const CV_T *src = in + (ci * s->d + iz) * plane;
+              const CV_T *k =
+                  w + (co * s->c_in + ci) * ksize + kz * s->kh * s->kw;
+
+              // Input rows read by the block, clipped to the image
+              long iy = (long)(y0 * s->sh) - (long)s->ph;
+              long iy_end =
+                  (long)((y0 + rows - 1) * s->sh + s->kh) - (long)s->ph;
+              if (iy < 0)
+                iy = 0;
+              if (iy_end > (long)s->h)
+                iy_end = s->h;
+
+              for (; iy < iy_end; ++iy) {
+                const CV_T *row = src + iy * s->w;
+                if (s->sw == 1) {
+                  CV_V r =
+                      CV_NAME(__conv_load_row)(row, col, 1, vl + ext, s->w);
+                  for (size_t kx = 0; kx < s->kw; ++kx) {
+                    CV_V v = kx ? CV_OP(vslidedown_vx)(r, kx, vl) : r;
+                    CV_ROW_MACC(acc0, 0);
+                    CV_ROW_MACC(acc1, 1);
+                    CV_ROW_MACC(acc2, 2);
+                    CV_ROW_MACC(acc3, 3);
+                  }
+                } else {
+                  for (size_t kx = 0; kx < s->kw; ++kx) {
+                    CV_V v = CV_NAME(__conv_load_row)(row, col + kx, s->sw, vl,
+                                                      s->w);
+                    CV_ROW_MACC(acc0, 0);
+                    CV_ROW_MACC(acc1, 1);
+                    CV_ROW_MACC(acc2, 2);
+                    CV_ROW_MACC(acc3, 3);
+                  }
+                }
+              }
+            }
+
+          CV_STORE(dst + x0, acc0, vl);
+          if (rows > 1)
+            CV_STORE(dst + ow + x0, acc1, vl);
+          if (rows > 2)
+            CV_STORE(dst + 2 * ow + x0, acc2, vl);
+          if (rows > 3)
+            CV_STORE(dst + 3 * ow + x0, acc3, vl);
+        }
+      }
+
+  return 0;
+}
+
+int CV_NAME(conv2d)(const conv_shape_t *s, const CV_T *in, const CV_T *w,
+                    CV_T *out) {
+  conv_shape_t s2 = *s;
+  s2.d = s2.kd = s2.sd = 1;
+  s2.pd = 0;
+  return CV_NAME(conv3d)(&s2, in, w, out);
+}
+
+//////////////
+// Winograd //
+//////////////
+
+#if CV_FLOAT
+// Y = A^T [(G g G^T) . (B^T d B)] A, for m x m output tiles of a 3x3 filter,
+// with a = m + 2. The filter transform is scalar. The other stages work on
+// one row of tiles at a time, with one vector element per tile, and keep
+// their intermediate results in the workspace:
+//   U[co][ci][a*a]   transformed filters
+//   V[ci][a*a][nt]   transformed inputs of the tile row
+//   R[a*a][nt]       B^T d or A^T M, depending on the stage
+//   D[a][nt]         one input row of the tiles
+//   M[4][a*a][nt]    U . V, summed over ci, for 4 output channels
+int CV_NAME(conv2d_winograd)(const conv_shape_t *s, int m, const CV_T *in,
+                             const CV_T *w, CV_T *out, void *ws) {
+  const conv_wino_t *t = conv_wino(m);
+  if (!t || s->kh != 3 || s->kw != 3 || s->sh != 1 || s->sw != 1 ||
+      s->h + 2 * s->ph < 3 || s->w + 2 * s->pw < 3)
+    return -1;
+
+  const size_t a = t->a, a2 = a * a;
+  const size_t oh = conv_out_dim(s->h, 3, 1, s->ph);
+  const size_t ow = conv_out_dim(s->w, 3, 1, s->pw);
+  const size_t th = (oh + m - 1) / m;
+  const size_t tw = (ow + m - 1) / m;
+  const size_t nt = conv_wino_chunk(s, m, sizeof(CV_T));
+  const size_t ci_n = s->c_in;
+
+  CV_T *U = (CV_T *)ws;
+  CV_T *V = U + s->c_out * ci_n * a2;
+  CV_T *R = V + ci_n * a2 * nt;
+  CV_T *D = R + a2 * nt;
+  CV_T *M = D + a * nt;
+
+  // U = G g G^T
+  for (size_t f = 0; f < s->c_out * ci_n; ++f) {
+    const CV_T *g = w + f * 9;
+    CV_T *u = U + f * a2;
+    for (size_t i = 0; i < a; ++i) {
+      double gi[3] = {0, 0, 0};
+      for (size_t k = 0; k < 3; ++k)
+        for (size_t j = 0; j < 3; ++j)
+          gi[j] += t->g[i * 3 + k] * g[k * 3 + j];
+      for (size_t j = 0; j < a; ++j)
+        u[i * a + j] = (CV_T)(gi[0] * t->g[j * 3] + gi[1] * t->g[j * 3 + 1] +
+                              gi[2] * t->g[j * 3 + 2]);
+    }
+  }
+
+  for (size_t ty = 0; ty < th; ++ty) {
+    size_t vl;
+    for (size_t tx0 = 0; tx0 < tw; tx0 += vl) {
+      vl = CV_VSETVL(tw - tx0 < nt ? tw - tx0 : nt);
+      const long col = (long)(tx0 * m) - (long)s->pw;
+
+      // V = B^T d B
+      for (size_t ci = 0; ci < ci_n; ++ci) {
+        const CV_T *src = in + ci * s->h * s->w;
+        for (size_t i = 0; i < a; ++i) {
+          const long iy = (long)(ty * m + i) - (long)s->ph;
+          const int valid = iy >= 0 && iy < (long)s->h;
+          if (valid)
+            for (size_t j = 0; j < a; ++j)
+              CV_STORE(D + j * nt,
+                       CV_NAME(__conv_load_row)(src + iy * s->w, col + j, m,
+                                                vl, s->w),
+                       vl);
+          for (size_t b = 0; b < a; ++b) {
+            CV_V acc = CV_ZERO(vl);
+            for (size_t j = 0; valid && j < a; ++j)
+              if (t->bt[b * a + j] != 0)
+                acc = CV_MACC(acc, (CV_T)t->bt[b * a + j],
+                              CV_LOAD(D + j * nt, vl), vl);
+            CV_STORE(R + (i * a + b) * nt, acc, vl);
+          }
+        }
+        for (size_t i = 0; i < a; ++i)
+          for (size_t b = 0; b < a; ++b) {
+            CV_V acc = CV_ZERO(vl);
+            for (size_t j = 0; j < a; ++j)
+              if (t->bt[i * a + j] != 0)
+                acc = CV_MACC(acc, (CV_T)t->bt[i * a + j],
+                              CV_LOAD(R + (j * a + b) * nt, vl), vl);
+            CV_STORE(V + (ci * a2 + i * a + b) * nt, acc, vl);
+          }
+      }
+
+      for (size_t co0 = 0; co0 < s->c_out; co0 += 4) {
+        const size_t nco = s->c_out - co0 < 4 ? s->c_out - co0 : 4;
+
+        // M = sum over ci of U . V, one V load for 4 output channels
+        for (size_t x = 0; x < a2; ++x) {
+          CV_V acc0 = CV_ZERO(vl);
+          CV_V acc1 = CV_ZERO(vl);
+          CV_V acc2 = CV_ZERO(vl);
+          CV_V acc3 = CV_ZERO(vl);
+          for (size_t ci = 0; ci < ci_n; ++ci) {
+            const CV_T *u = U + (co0 * ci_n + ci) * a2 + x;
+            CV_V v = CV_LOAD(V + (ci * a2 + x) * nt, vl);
+            acc0 = CV_MACC(acc0, u[0], v, vl);
+            if (nco > 1)
+              acc1 = CV_MACC(acc1, u[ci_n * a2], v, vl);
+            if (nco > 2)
+              acc2 = CV_MACC(acc2, u[2 * ci_n * a2], v, vl);
+            if (nco > 3)
+              acc3 = CV_MACC(acc3, u[3 * ci_n * a2], v, vl);
+          }
+          CV_STORE(M + x * nt, acc0, vl);
+          if (nco > 1)
+            CV_STORE(M + (a2 + x) * nt, acc1, vl);
+          if (nco > 2)
+            CV_STORE(M + (2 * a2 + x) * nt, acc2, vl);
+          if (nco > 3)
+            CV_STORE(M + (3 * a2 + x) * nt, acc3, vl);
+        }
+
+        // Y = A^T M A, the tiles that exceed the output are clipped
+        for (size_t c = 0; c < nco; ++c) {
+          const CV_T *mc = M + c * a2 * nt;
+          for (size_t r = 0; r < (size_t)m; ++r)
+            for (size_t b = 0; b < a; ++b) {
+              CV_V acc = CV_ZERO(vl);
+              for (size_t i = 0; i < a; ++i)
+                if (t->at[r * a + i] != 0)
+                  acc = CV_MACC(acc, (CV_T)t->at[r * a + i],
+                                CV_LOAD(mc + (i * a + b) * nt, vl), vl);
+              CV_STORE(R + (r * a + b) * nt, acc, vl);
+            }
+          for (size_t r = 0; r < (size_t)m && ty * m + r < oh; ++r) {
+            CV_T *dst = out + ((co0 + c) * oh + ty * m + r) * ow + tx0 * m;
+            for (size_t l = 0; l < (size_t)m; ++l) {
+              // Tiles of the strip whose column l is in the output
+              const size_t end = l < ow ? (ow - l + m - 1) / m : 0;
+              if (end <= tx0)
+                break;
+              const size_t cnt = end - tx0 < vl ? end - tx0 : vl;
+              CV_V acc = CV_ZERO(cnt);
+              for (size_t b = 0; b < a; ++b)
+                if (t->at[l * a + b] != 0)
+                  acc = CV_MACC(acc, (CV_T)t->at[l * a + b],
+                                CV_LOAD(R + (r * a + b) * nt, cnt), cnt);
+              CV_SSTORE(dst + l, m * sizeof(CV_T), acc, cnt);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+#endif
+
+#undef CV_ROW_MACC
+#undef CV_f
+#undef CV_i
+#undef CV_FLOAT
+#undef CV_T
+#undef CV_TAG
+#undef CV_V
+#undef CV_MACC
+#undef CV_ZERO
+#undef CV_OP
+#undef CV_LOAD
+#undef CV_SLOAD
+#undef CV_STORE
+#undef CV_SSTORE
+#undef CV_VSETVL
+#undef CV_VSETVLMAX
+#undef CV_NAME
+
+#undef CV_KIND
+#undef CV_SEW
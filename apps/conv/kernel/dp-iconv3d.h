@@ -0,0 +1 @@
+../../dtype-conv3d/kernel/dp-iconv3d.h
\ No newline at end of file
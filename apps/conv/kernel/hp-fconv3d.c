@@ -0,0 +1 @@
+../../dtype-conv3d/kernel/hp-fconv3d.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../dtype-conv3d/kernel/hp-iconv3d.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../dtype-conv3d/kernel/sp-iconv3d.c
\ No newline at end of file
@@ -0,0 +1,221 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Convolution library benchmark. Run the CHx7x7 convolution of dtype-conv3d
+// and the library on the same data, then the library on 3x3 (direct and
+// Winograd), strided 5x5 and 3x3x3 convolutions. Check the results and print
+// the MAC/cycle of every kernel.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel/conv.h"
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Define the different data types
+#define FLOAT64 1
+#define FLOAT32 2
+#define FLOAT16 3
+#define INT64 4
+#define INT32 5
+#define INT16 6
+#define INT8 7
+
+// Map DTYPE to the data type, the dtype-conv3d kernel and the library
+#ifndef DTYPE
+#warning                                                                       \
+    "Please explicitly define DTYPE and force-build with '-B'. Example command: make -B bin/conv ENV_DEFINES='-DDTYPE=FLOAT32' def_args_conv='32 3 4 float32'. Compiling now under the assumption of DTYPE == FLOAT64"
+#define DTYPE FLOAT64
+#endif
+
+#if DTYPE == FLOAT64
+typedef double _DTYPE;
+#define _KERNEL dp_fconv3d_CHx7x7
+#define _VERIFY dp_fconv3d_verify
+#define _CONV(fn) fn##_f64
+#define WINO_THRESHOLD 0.000000001
+#include "kernel/dp-fconv3d.h"
+#elif DTYPE == FLOAT32
+typedef float _DTYPE;
+#define _KERNEL sp_fconv3d_CHx7x7
+#define _VERIFY sp_fconv3d_verify
+#define _CONV(fn) fn##_f32
+#define WINO_THRESHOLD 0.001
+#include "kernel/sp-fconv3d.h"
+#elif DTYPE == FLOAT16
+typedef _Float16 _DTYPE;
+#define _KERNEL hp_fconv3d_CHx7x7
+#define _VERIFY hp_fconv3d_verify
+#define _CONV(fn) fn##_f16
+#define WINO_THRESHOLD 1
+#include "kernel/hp-fconv3d.h"
+#elif DTYPE == INT64
+typedef int64_t _DTYPE;
+#define _KERNEL dp_iconv3d_CHx7x7
+#define _VERIFY dp_iconv3d_verify
+#define _CONV(fn) fn##_i64
+#include "kernel/dp-iconv3d.h"
+#elif DTYPE == INT32
+typedef int32_t _DTYPE;
+#define _KERNEL sp_iconv3d_CHx7x7
+#define _VERIFY sp_iconv3d_verify
+#define _CONV(fn) fn##_i32
+#include "kernel/sp-iconv3d.h"
+#elif DTYPE == INT16
+typedef int16_t _DTYPE;
+#define _KERNEL hp_iconv3d_CHx7x7
+#define _VERIFY hp_iconv3d_verify
+#define _CONV(fn) fn##_i16
+#include "kernel/hp-iconv3d.h"
+#elif DTYPE == INT8
+typedef int8_t _DTYPE;
+#define _KERNEL bp_iconv3d_CHx7x7
+#define _VERIFY bp_iconv3d_verify
+#define _CONV(fn) fn##_i8
+#include "kernel/bp-iconv3d.h"
+#else
+#error "Unsupported data type"
+#endif
+
+// Image size M x M, CH input channels, COUT output channels
+extern int64_t M, CH, COUT;
+// Winograd workspace, ws_size bytes
+extern uint64_t ws_size;
+// 7x7: input [CH][M+6][M+6], already padded, filter [CH][7][7], output [M][M]
+extern _DTYPE i7[] __attribute__((aligned(4 * NR_LANES)));
+extern _DTYPE f7[] __attribute__((aligned(4 * NR_LANES)));
+extern _DTYPE gold7[] __attribute__((aligned(4 * NR_LANES)));
+// Input [CH][M][M] of the other tests
+extern _DTYPE i3[] __attribute__((aligned(4 * NR_LANES)));
+// 3x3, padding 1: filter [COUT][CH][3][3], output [COUT][M][M]
+extern _DTYPE f3[] __attribute__((aligned(4 * NR_LANES)));
+extern _DTYPE gold3[] __attribute__((aligned(4 * NR_LANES)));
+// 5x5, stride 2, padding 2: filter [COUT][CH][5][5]
+extern _DTYPE f5[] __attribute__((aligned(4 * NR_LANES)));
+extern _DTYPE gold5[] __attribute__((aligned(4 * NR_LANES)));
+// 3x3x3, padding 1, on the input seen as one channel of CH x M x M:
+// filter [COUT][3][3][3], output [COUT][CH][M][M]
+extern _DTYPE f3d[] __attribute__((aligned(4 * NR_LANES)));
+extern _DTYPE gold3d[] __attribute__((aligned(4 * NR_LANES)));
+extern _DTYPE o[] __attribute__((aligned(4 * NR_LANES)));
+extern uint8_t ws[] __attribute__((aligned(4 * NR_LANES)));
+
+static void print_row(const char *name, const char *shape, int64_t runtime,
+                      uint64_t macs) {
+  printf("%-16s  %-14s  %9d  %9f\n", name, shape, runtime,
+         (float)macs / runtime);
+}
+
+int main() {
+  printf("\n");
+  printf("==========\n");
+  printf("=  CONV  =\n");
+  printf("==========\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+  int64_t runtime;
+  const size_t m = M;
+
+  printf("Image %dx%d, %d input channels, %d output channels, %s.\n", M, M, CH,
+         COUT, DATA_WIDTH);
+  printf("kernel            shape              cycles  MAC/cycle\n");
+
+  // CHx7x7 valid convolution: dtype-conv3d kernel vs library
+  const conv_shape_t s7 = {CH, 1, m + 6, m + 6, 1, 1, 7, 7, 1, 1, 1, 0, 0, 0};
+  const uint64_t macs7 = (uint64_t)CH * 49 * m * m;
+
+  start_timer();
+  _KERNEL(o, i7, f7, M, M, CH, 7);
+  stop_timer();
+  runtime = get_timer();
+  print_row("dtype-conv3d", "CHx7x7", runtime, macs7);
+  error += _VERIFY(o, gold7, M, M, THRESHOLD);
+
+  memset(o, 0, m * m * sizeof(_DTYPE));
+  start_timer();
+  error += _CONV(conv2d)(&s7, i7, f7, o) != 0;
+  stop_timer();
+  runtime = get_timer();
+  print_row("conv2d", "CHx7x7", runtime, macs7);
+  error += _VERIFY(o, gold7, M, M, THRESHOLD);
+
+  // 3x3 "same" convolution: direct vs Winograd
+  const conv_shape_t s3 = {CH, 1, m, m, COUT, 1, 3, 3, 1, 1, 1, 0, 1, 1};
+  const uint64_t macs3 = (uint64_t)COUT * CH * 9 * m * m;
+
+  start_timer();
+  error += _CONV(conv2d)(&s3, i3, f3, o) != 0;
+  stop_timer();
+  runtime = get_timer();
+  print_row("conv2d", "3x3 pad 1", runtime, macs3);
+  error += _VERIFY(o, gold3, COUT * M, M, THRESHOLD);
+
+#if DTYPE <= FLOAT16
+  for (int t = 2; t <= 4; t += 2) {
+    if (conv2d_winograd_workspace(&s3, t, sizeof(_DTYPE)) > ws_size) {
+      printf("Error: workspace too small for F(%dx%d, 3x3).\n", t, t);
+      return -1;
+    }
+    memset(o, 0, COUT * m * m * sizeof(_DTYPE));
+    start_timer();
+    error += _CONV(conv2d_winograd)(&s3, t, i3, f3, o, ws) != 0;
+    stop_timer();
+    runtime = get_timer();
+    print_row(t == 2 ? "winograd F(2,3)" : "winograd F(4,3)", "3x3 pad 1",
+              runtime, macs3);
+    error += _VERIFY(o, gold3, COUT * M, M, WINO_THRESHOLD);
+  }
+#endif
+
+  // 5x5 convolution, stride 2
+  const conv_shape_t s5 = {CH, 1, m, m, COUT, 1, 5, 5, 1, 2, 2, 0, 2, 2};
+  const size_t m5 = conv_out_dim(m, 5, 2, 2);
+
+  start_timer();
+  error += _CONV(conv2d)(&s5, i3, f5, o) != 0;
+  stop_timer();
+  runtime = get_timer();
+  print_row("conv2d", "5x5 stride 2", runtime,
+            (uint64_t)COUT * CH * 25 * m5 * m5);
+  error += _VERIFY(o, gold5, COUT * m5, m5, THRESHOLD);
+
+  // 3x3x3 "same" convolution
+  const conv_shape_t s3d = {1, CH, m, m, COUT, 3, 3, 3, 1, 1, 1, 1, 1, 1};
+
+  start_timer();
+  error += _CONV(conv3d)(&s3d, i3, f3d, o) != 0;
+  stop_timer();
+  runtime = get_timer();
+  print_row("conv3d", "3x3x3 pad 1", runtime, (uint64_t)COUT * CH * 27 * m * m);
+  error += _VERIFY(o, gold3d, COUT * CH * M, M, THRESHOLD);
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+# Copyright 2026 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# arg1: image size M, arg2: input channels, arg3: output channels,
+# arg4: data type
+
+import numpy as np
+import sys
+
+def conv(image, kernel, stride, padding):
+    # image [C][D][H][W], kernel [CO][C][KD][KH][KW], computed in 64 bits
+    acc = np.float64 if np.issubdtype(image.dtype, np.floating) else np.int64
+    x = np.pad(image.astype(acc), [(0, 0)] + [(p, p) for p in padding])
+    k = kernel.astype(acc)
+    out_dims = [(x.shape[1 + d] - k.shape[2 + d]) // stride[d] + 1
+                for d in range(3)]
+    out = np.zeros([k.shape[0]] + out_dims, dtype=acc)
+    for kz in range(k.shape[2]):
+        for ky in range(k.shape[3]):
+            for kx in range(k.shape[4]):
+                win = x[:, kz:kz + stride[0] * out_dims[0]:stride[0],
+                           ky:ky + stride[1] * out_dims[1]:stride[1],
+                           kx:kx + stride[2] * out_dims[2]:stride[2]]
+                out += np.einsum('oc,czyx->ozyx', k[:, :, kz, ky, kx], win)
+    # Integers wrap around like the vector accumulators
+    return out.astype(image.dtype)
+
+def rand(shape, dtype):
+    if np.issubdtype(np.dtype(dtype), np.floating):
+        return np.random.rand(*shape).astype(dtype)
+    return np.random.randint(-8, 8, size=shape).astype(dtype)
+
+def emit(name, array, alignment='8'):
+	print(".global %s" % name)
+	print(".balign " + alignment)
+	print("%s:" % name)
+	bs = array.tobytes()
+	for i in range(0, len(bs), 1):
+		s = ""
+		s += "%02x" % bs[i]
+		print("    .byte 0x%s" % s)
+
+def emit_space(name, size, alignment='8'):
+	print(".global %s" % name)
+	print(".balign " + alignment)
+	print("%s:" % name)
+	print("    .space %d" % size)
+
+if len(sys.argv) > 1:
+	M = int(sys.argv[1])
+	CH = int(sys.argv[2])
+	COUT = int(sys.argv[3])
+	dtype = sys.argv[4]
+else:
+	M = 32
+	CH = 3
+	COUT = 4
+	dtype = 'float64'
+
+# The dtype-conv3d kernel works on blocks of 4 rows and columns
+assert(M % 4 == 0), "The image size must be divisible by 4"
+esize = np.dtype(dtype).itemsize
+
+# 7x7 valid convolution of an already padded image, one output channel
+i7 = rand((CH, 1, M + 6, M + 6), dtype)
+f7 = rand((1, CH, 1, 7, 7), dtype)
+gold7 = conv(i7, f7, (1, 1, 1), (0, 0, 0))
+
+# 3x3 with padding 1, 5x5 with stride 2 and padding 2, and 3x3x3 with
+# padding 1 on the image seen as a single-channel volume
+i3 = rand((CH, 1, M, M), dtype)
+f3 = rand((COUT, CH, 1, 3, 3), dtype)
+gold3 = conv(i3, f3, (1, 1, 1), (0, 1, 1))
+f5 = rand((COUT, CH, 1, 5, 5), dtype)
+gold5 = conv(i3, f5, (1, 2, 2), (0, 2, 2))
+f3d = rand((COUT, 1, 3, 3, 3), dtype)
+gold3d = conv(i3.reshape(1, CH, M, M), f3d, (1, 1, 1), (1, 1, 1))
+
+# Winograd workspace, upper bound over F(2x2, 3x3) and F(4x4, 3x3)
+ws_size = 0
+for m in (2, 4):
+	a = m + 2
+	nt = (M + m - 1) // m
+	ws_size = max(ws_size, esize * (COUT * CH * a * a + (CH + 5) * a * a * nt + a * nt))
+
+o_size = esize * max(M * M, COUT * CH * M * M)
+
+print(".section .data,\"aw\",@progbits")
+emit("M", np.array(M, dtype=np.uint64))
+emit("CH", np.array(CH, dtype=np.uint64))
+emit("COUT", np.array(COUT, dtype=np.uint64))
+emit("ws_size", np.array(ws_size, dtype=np.uint64))
+emit("i7", i7, 'NR_LANES*4')
+emit("f7", f7, 'NR_LANES*4')
+emit("gold7", gold7, 'NR_LANES*4')
+emit("i3", i3, 'NR_LANES*4')
+emit("f3", f3, 'NR_LANES*4')
+emit("gold3", gold3, 'NR_LANES*4')
+emit("f5", f5, 'NR_LANES*4')
+emit("gold5", gold5, 'NR_LANES*4')
+emit("f3d", f3d, 'NR_LANES*4')
+emit("gold3d", gold3d, 'NR_LANES*4')
+emit_space("o", o_size, 'NR_LANES*4')
+emit_space("ws", ws_size, 'NR_LANES*4')
@@ -0,0 +1,191 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Double-buffered fmatmul with the SoC DMA. C = AB is computed by tiles of
+// TM x TP elements. For every tile, the DMA copies the TM rows of A, and the
+// TP columns of B with a 2D transfer, to local buffers, and copies the tile of
+// C back with a 2D transfer. The tiling is timed three times:
+//   resident: fmatmul on the whole matrices, without copies
+//   serial:   every copy is waited for before the compute
+//   overlap:  the copies of the next tile run during the compute of this one
+// The result is checked against a scalar reference.
+//
+// In ara_soc, the matrices and the buffers are all in the L2, so the copies
+// only model the transfers from a larger and slower memory.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "dma.h"
+#include "kernel/fmatmul.h"
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// C = AB with A=[MxN], B=[NxP], C=[MxP]
+#ifndef M
+#define M 64
+#endif
+#ifndef N
+#define N 64
+#endif
+#ifndef P
+#define P 64
+#endif
+// Tile of C, TM must be at most 64 (see fmatmul)
+#ifndef TM
+#define TM 16
+#endif
+#ifndef TP
+#define TP 32
+#endif
+
+#define NR_TILES ((M / TM) * (P / TP))
+
+typedef enum { RESIDENT, SERIAL, OVERLAP, N_MODES } mode_e;
+
+static const char *names[N_MODES] = {"resident", "serial", "overlap"};
+
+// Backing memory
+static double a[M * N] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+static double b[N * P] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+static double c[M * P] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+static double g[M * P] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+
+// Local buffers, two of each
+static double a_buf[2][TM * N] __attribute__((aligned(32 * NR_LANES)));
+static double b_buf[2][N * TP] __attribute__((aligned(32 * NR_LANES)));
+static double c_buf[2][TM * TP] __attribute__((aligned(32 * NR_LANES)));
+
+// Copy the A rows and B columns of tile t to buffer k
+static dma_id_t load_tile(int t, int k) {
+  const int tm = t / (P / TP), tp = t % (P / TP);
+  dma_start(a_buf[k], a + tm * TM * N, TM * N * sizeof(double));
+  return dma_start_2d(b_buf[k], b + tp * TP, TP * sizeof(double),
+                      TP * sizeof(double), P * sizeof(double), N);
+}
+
+// Copy buffer k back to the tile t of C
+static dma_id_t store_tile(int t, int k) {
+  const int tm = t / (P / TP), tp = t % (P / TP);
+  return dma_start_2d(c + tm * TM * P + tp * TP, c_buf[k], TP * sizeof(double),
+                      P * sizeof(double), TP * sizeof(double), TM);
+}
+
+static void run(mode_e mode) {
+  dma_id_t id = 0;
+
+  switch (mode) {
+  case RESIDENT:
+    fmatmul(c, a, b, M, N, P);
+    break;
+  case SERIAL:
+    for (int t = 0; t < NR_TILES; ++t) {
+      dma_wait(load_tile(t, 0));
+      fmatmul(c_buf[0], a_buf[0], b_buf[0], TM, N, TP);
+      id = store_tile(t, 0);
+      dma_wait(id);
+    }
+    break;
+  default:
+    // The copies execute in order: waiting for the tile t also waits for
+    // the store of the tile t - 2, which used the same buffers
+    id = load_tile(0, 0);
+    for (int t = 0; t < NR_TILES; ++t) {
+      const int k = t & 1;
+      const dma_id_t cur = id;
+      if (t + 1 < NR_TILES)
+        id = load_tile(t + 1, !k);
+      dma_wait(cur);
+      fmatmul(c_buf[k], a_buf[k], b_buf[k], TM, N, TP);
+      id = store_tile(t, k);
+    }
+    dma_wait(id);
+    break;
+  }
+}
+
+int main() {
+  printf("\n");
+  printf("================\n");
+  printf("=  DMA MATMUL  =\n");
+  printf("================\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+
+  // Small integers, for an exact result
+  for (int i = 0; i < M; ++i)
+    for (int j = 0; j < N; ++j)
+      a[i * N + j] = (double)((i + 2 * j) % 7 - 3);
+  for (int i = 0; i < N; ++i)
+    for (int j = 0; j < P; ++j)
+      b[i * P + j] = (double)((3 * i + j) % 5 - 2);
+  for (int i = 0; i < M; ++i)
+    for (int j = 0; j < P; ++j) {
+      double sum = 0;
+      for (int k = 0; k < N; ++k)
+        sum += a[i * N + k] * b[k * P + j];
+      g[i * P + j] = sum;
+    }
+
+  printf("(%d x %d) x (%d x %d), tiles of %d x %d\n", M, N, N, P, TM, TP);
+  printf("mode          cycles  FLOP/cycle\n");
+
+  int64_t runtimes[N_MODES];
+  for (int mode = 0; mode < N_MODES; ++mode) {
+    memset(c, 0, sizeof(c));
+
+    HW_CNT_READY;
+    start_timer();
+    run(mode);
+    stop_timer();
+    HW_CNT_NOT_READY;
+    runtimes[mode] = get_timer();
+
+    printf("%-8s  %10d  %10f\n", names[mode], runtimes[mode],
+           2.0 * M * N * P / runtimes[mode]);
+
+    for (int i = 0; i < M * P; ++i) {
+      if (c[i] != g[i]) {
+        printf("Error: %s, c[%d] = %f instead of %f\n", names[mode], i, c[i],
+               g[i]);
+        error++;
+        break;
+      }
+    }
+  }
+
+  // Part of the serial copy time that the double buffering hides
+  const int64_t copies = runtimes[SERIAL] - runtimes[RESIDENT];
+  if (copies > 0)
+    printf("Copy cycles hidden by the overlap: %d of %d\n",
+           runtimes[SERIAL] - runtimes[OVERLAP], copies);
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
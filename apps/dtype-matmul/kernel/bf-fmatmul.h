@@ -0,0 +1,41 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BF_FMATMUL_H
+#define BF_FMATMUL_H
+
+#include "ara_insn.h"
+#include "util.h"
+#include <stdint.h>
+#include <string.h>
+
+// Relative, about one BF16 ulp
+#define THRESHOLD 0.01
+
+// Help calculate performance
+// How many parallel elements in an ELEN-wide FPU data bus?
+#define DTYPE_FACTOR 4
+
+// C = AB with BF16 A=[MxN], B=[NxP], and C=[MxP], with the vtype.altfmt of
+// Ara. M must be a multiple of 4.
+void bf_fmatmul(bf16_t *c, const bf16_t *a, const bf16_t *b,
+                const unsigned int m, const unsigned int n,
+                const unsigned int p);
+
+int bf_fmatmul_verify(bf16_t *result, bf16_t *gold, size_t R, size_t C,
+                      float threshold);
+
+#endif
@@ -0,0 +1,109 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "bf-fwmatmul.h"
+
+// Verify the matrix
+int bf_fwmatmul_verify(float *result, float *gold, size_t R, size_t C,
+                       float threshold) {
+  for (uint64_t i = 0; i < R; ++i) {
+    for (uint64_t j = 0; j < C; ++j) {
+      uint64_t idx = i * C + j;
+      if (!similarity_check(result[idx], gold[idx], threshold)) {
+        return (i + j) == 0 ? -1 : idx;
+      }
+    }
+  }
+  return 0;
+}
+
+// The vtype is BF16 with LMUL = 2, so that the FP32 accumulators of four rows
+// of C are v0, v4, v8, and v12 with EMUL = 4. The rows of B alternate between
+// v16 and v20, and the elements of A are loaded with flh, which keeps their
+// bits.
+void bf_fwmatmul(float *c, const bf16_t *a, const bf16_t *b,
+                 const unsigned int M, const unsigned int N,
+                 const unsigned int P) {
+  unsigned int block_size_p, vl;
+
+  // Set the vector configuration
+  VSETVL_BF16(block_size_p, P, 1);
+
+  // Slice the matrix into a manageable number of columns p_
+  for (unsigned int p = 0; p < P; p += block_size_p) {
+    // Set the vector length
+    const unsigned int p_ = MIN(P - p, block_size_p);
+
+    // Find pointers to the submatrices
+    const bf16_t *b_ = b + p;
+    float *c_ = c + p;
+
+    VSETVL_BF16(vl, p_, 1);
+
+    // Iterate over the rows, four at a time
+    for (unsigned int m = 0; m < M; m += 4) {
+      const bf16_t *a_ = a + m * N;
+      _Float16 t0, t1, t2, t3;
+
+      // Prefetch the first row of B
+      asm volatile("vle16.v v16, (%0)" ::"r"(b_));
+
+      for (unsigned int k = 0; k < N; k += 2) {
+        // Load the next row while consuming the current one
+        if (k + 1 < N)
+          asm volatile("vle16.v v20, (%0)" ::"r"(b_ + (k + 1) * P));
+
+        asm volatile("flh %0, (%1)" : "=f"(t0) : "r"(a_ + k));
+        asm volatile("flh %0, (%1)" : "=f"(t1) : "r"(a_ + N + k));
+        asm volatile("flh %0, (%1)" : "=f"(t2) : "r"(a_ + 2 * N + k));
+        asm volatile("flh %0, (%1)" : "=f"(t3) : "r"(a_ + 3 * N + k));
+        if (k == 0) {
+          // The first products initialize the accumulators
+          asm volatile("vfwmul.vf v0, v16, %0" ::"f"(t0));
+          asm volatile("vfwmul.vf v4, v16, %0" ::"f"(t1));
+          asm volatile("vfwmul.vf v8, v16, %0" ::"f"(t2));
+          asm volatile("vfwmul.vf v12, v16, %0" ::"f"(t3));
+        } else {
+          asm volatile("vfwmacc.vf v0, %0, v16" ::"f"(t0));
+          asm volatile("vfwmacc.vf v4, %0, v16" ::"f"(t1));
+          asm volatile("vfwmacc.vf v8, %0, v16" ::"f"(t2));
+          asm volatile("vfwmacc.vf v12, %0, v16" ::"f"(t3));
+        }
+
+        if (k + 1 >= N)
+          break;
+
+        if (k + 2 < N)
+          asm volatile("vle16.v v16, (%0)" ::"r"(b_ + (k + 2) * P));
+
+        asm volatile("flh %0, (%1)" : "=f"(t0) : "r"(a_ + k + 1));
+        asm volatile("flh %0, (%1)" : "=f"(t1) : "r"(a_ + N + k + 1));
+        asm volatile("flh %0, (%1)" : "=f"(t2) : "r"(a_ + 2 * N + k + 1));
+        asm volatile("flh %0, (%1)" : "=f"(t3) : "r"(a_ + 3 * N + k + 1));
+        asm volatile("vfwmacc.vf v0, %0, v20" ::"f"(t0));
+        asm volatile("vfwmacc.vf v4, %0, v20" ::"f"(t1));
+        asm volatile("vfwmacc.vf v8, %0, v20" ::"f"(t2));
+        asm volatile("vfwmacc.vf v12, %0, v20" ::"f"(t3));
+      }
+
+      // EEW = 32 at SEW = 16: the stores have EMUL = 4
+      asm volatile("vse32.v v0, (%0)" ::"r"(c_ + m * P));
+      asm volatile("vse32.v v4, (%0)" ::"r"(c_ + (m + 1) * P));
+      asm volatile("vse32.v v8, (%0)" ::"r"(c_ + (m + 2) * P));
+      asm volatile("vse32.v v12, (%0)" ::"r"(c_ + (m + 3) * P));
+    }
+  }
+}
@@ -0,0 +1,41 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BF_FWMATMUL_H
+#define BF_FWMATMUL_H
+
+#include "ara_insn.h"
+#include "util.h"
+#include <stdint.h>
+#include <string.h>
+
+#define THRESHOLD 0.001
+
+// Help calculate performance
+// How many parallel elements in an ELEN-wide FPU data bus? The products are
+// accumulated in FP32.
+#define DTYPE_FACTOR 2
+
+// C = AB with BF16 A=[MxN] and B=[NxP], and FP32 C=[MxP], accumulated with
+// vfwmacc under the vtype.altfmt of Ara. M must be a multiple of 4.
+void bf_fwmatmul(float *c, const bf16_t *a, const bf16_t *b,
+                 const unsigned int m, const unsigned int n,
+                 const unsigned int p);
+
+int bf_fwmatmul_verify(float *result, float *gold, size_t R, size_t C,
+                       float threshold);
+
+#endif
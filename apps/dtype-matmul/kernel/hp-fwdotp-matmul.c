@@ -0,0 +1,105 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hp-fwdotp-matmul.h"
+#include "ara_insn.h"
+
+// Verify the matrix
+int hp_fwdotp_matmul_verify(float *result, float *gold, size_t R, size_t C,
+                            float threshold) {
+  for (uint64_t i = 0; i < R; ++i) {
+    for (uint64_t j = 0; j < C; ++j) {
+      uint64_t idx = i * C + j;
+      if (!similarity_check(result[idx], gold[idx], threshold)) {
+        return (i + j) == 0 ? -1 : idx;
+      }
+    }
+  }
+  return 0;
+}
+
+// Each iteration over k consumes two rows of B and two columns of A. The FP32
+// accumulators of four rows of C are v0, v4, v8, and v12, the row pair of B is
+// in v16 or v20, and the matching pair of each row of A is read with flw.
+void hp_fwdotp_matmul(float *c, const _Float16 *a, const _Float16 *b,
+                      const unsigned int M, const unsigned int N,
+                      const unsigned int P) {
+  unsigned int block_size_p;
+
+  // Set the vector configuration
+  asm volatile("vsetvli %0, %1, e32, m4, ta, ma" : "=r"(block_size_p) : "r"(P));
+
+  // Slice the matrix into a manageable number of columns p_
+  for (unsigned int p = 0; p < P; p += block_size_p) {
+    // Set the vector length
+    const unsigned int p_ = MIN(P - p, block_size_p);
+
+    // Find pointers to the submatrices. A row pair of B has 2 * P halves.
+    const _Float16 *b_ = b + 2 * p;
+    float *c_ = c + p;
+
+    asm volatile("vsetvli zero, %0, e32, m4, ta, ma" ::"r"(p_));
+
+    // Iterate over the rows, four at a time
+    for (unsigned int m = 0; m < M; m += 4) {
+      const _Float16 *a_ = a + m * N;
+      float t0, t1, t2, t3;
+
+      asm volatile("vmv.v.i v0, 0");
+      asm volatile("vmv.v.i v4, 0");
+      asm volatile("vmv.v.i v8, 0");
+      asm volatile("vmv.v.i v12, 0");
+
+      // Prefetch the first row pair of B
+      asm volatile("vle32.v v16, (%0)" ::"r"(b_));
+
+      for (unsigned int k = 0; k < N; k += 4) {
+        // Load the next row pair while consuming the current one
+        if (k + 2 < N)
+          asm volatile("vle32.v v20, (%0)" ::"r"(b_ + (k + 2) * P));
+
+        asm volatile("flw %0, (%1)" : "=f"(t0) : "r"(a_ + k));
+        asm volatile("flw %0, (%1)" : "=f"(t1) : "r"(a_ + N + k));
+        asm volatile("flw %0, (%1)" : "=f"(t2) : "r"(a_ + 2 * N + k));
+        asm volatile("flw %0, (%1)" : "=f"(t3) : "r"(a_ + 3 * N + k));
+        VFWDOTP_VF(v0, t0, v16);
+        VFWDOTP_VF(v4, t1, v16);
+        VFWDOTP_VF(v8, t2, v16);
+        VFWDOTP_VF(v12, t3, v16);
+
+        if (k + 2 >= N)
+          break;
+
+        if (k + 4 < N)
+          asm volatile("vle32.v v16, (%0)" ::"r"(b_ + (k + 4) * P));
+
+        asm volatile("flw %0, (%1)" : "=f"(t0) : "r"(a_ + k + 2));
+        asm volatile("flw %0, (%1)" : "=f"(t1) : "r"(a_ + N + k + 2));
+        asm volatile("flw %0, (%1)" : "=f"(t2) : "r"(a_ + 2 * N + k + 2));
+        asm volatile("flw %0, (%1)" : "=f"(t3) : "r"(a_ + 3 * N + k + 2));
+        VFWDOTP_VF(v0, t0, v20);
+        VFWDOTP_VF(v4, t1, v20);
+        VFWDOTP_VF(v8, t2, v20);
+        VFWDOTP_VF(v12, t3, v20);
+      }
+
+      asm volatile("vse32.v v0, (%0)" ::"r"(c_ + m * P));
+      asm volatile("vse32.v v4, (%0)" ::"r"(c_ + (m + 1) * P));
+      asm volatile("vse32.v v8, (%0)" ::"r"(c_ + (m + 2) * P));
+      asm volatile("vse32.v v12, (%0)" ::"r"(c_ + (m + 3) * P));
+    }
+  }
+}
@@ -0,0 +1,41 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HP_FWDOTP_MATMUL_H
+#define HP_FWDOTP_MATMUL_H
+
+#include "util.h"
+#include <stdint.h>
+#include <string.h>
+
+#define THRESHOLD 0.001
+
+// Help calculate performance
+// How many parallel elements in an ELEN-wide FPU data bus? Two FP32 results,
+// each accumulating two FP16 products.
+#define DTYPE_FACTOR 4
+
+// C = AB with FP16 A=[MxN] and B=[NxP], and FP32 C=[MxP], accumulated with
+// vfwdotp. B is stored pair-interleaved: B[k][j] and B[k+1][j], with k even,
+// are adjacent, at b[k*P + 2*j]. M must be a multiple of 4, N even.
+void hp_fwdotp_matmul(float *c, const _Float16 *a, const _Float16 *b,
+                      const unsigned int m, const unsigned int n,
+                      const unsigned int p);
+
+int hp_fwdotp_matmul_verify(float *result, float *gold, size_t R, size_t C,
+                            float threshold);
+
+#endif
@@ -39,6 +39,12 @@
 #define INT32 5
 #define INT16 6
 #define INT8 7
+// FP16 inputs, FP32 results, with Ara's vfwdotp
+#define FLOAT16W 8
+// BF16 inputs and results, and BF16 inputs with FP32 results, with the BF16
+// vtype of Ara
+#define BFLOAT16 9
+#define BFLOAT16W 10
 
 // Map DTYPE to the actual data type
 #ifndef DTYPE
@@ -62,6 +68,23 @@ typedef _Float16 _DTYPE;
 #define _KERNEL hp_fmatmul
 #define _VERIFY hp_fmatmul_verify
 #include "kernel/hp-fmatmul.h"
+#elif DTYPE == FLOAT16W
+typedef float _DTYPE;
+typedef _Float16 _DTYPE_IN;
+#define _KERNEL hp_fwdotp_matmul
+#define _VERIFY hp_fwdotp_matmul_verify
+#include "kernel/hp-fwdotp-matmul.h"
+#elif DTYPE == BFLOAT16
+#include "kernel/bf-fmatmul.h"
+typedef bf16_t _DTYPE;
+#define _KERNEL bf_fmatmul
+#define _VERIFY bf_fmatmul_verify
+#elif DTYPE == BFLOAT16W
+#include "kernel/bf-fwmatmul.h"
+typedef float _DTYPE;
+typedef bf16_t _DTYPE_IN;
+#define _KERNEL bf_fwmatmul
+#define _VERIFY bf_fwmatmul_verify
 #elif DTYPE == INT64
 typedef int64_t _DTYPE;
 #define _KERNEL dp_imatmul
@@ -86,14 +109,19 @@ typedef int8_t _DTYPE;
 #error "Unsupported data type"
 #endif
 
+// The inputs have the type of the results, unless the kernel widens them
+#if DTYPE != FLOAT16W && DTYPE != BFLOAT16W
+typedef _DTYPE _DTYPE_IN;
+#endif
+
 // Define Matrix dimensions:
 // C = AB with A=[MxN], B=[NxP], C=[MxP]
 extern uint64_t M;
 extern uint64_t N;
 extern uint64_t P;
 
-extern _DTYPE a[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
-extern _DTYPE b[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+extern _DTYPE_IN a[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+extern _DTYPE_IN b[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
 extern _DTYPE c[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
 extern _DTYPE g[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
 
@@ -35,6 +35,24 @@ def emit(name, array, alignment='8'):
       s += "%02x" % bs[i+3-n]
     print("    .word 0x%s" % s)
 
+# Round to the nearest even BF16 (8 significant bits), as float64
+def bf16_round(x):
+  m, e = np.frexp(x)
+  return np.ldexp(np.round(np.ldexp(m, 8)), e - 8)
+
+# Bit patterns of values representable in BF16
+def bf16_bits(x):
+  return (x.astype(np.float32).view(np.uint32) >> 16).astype(np.uint16)
+
+# C = AB accumulated in order over k, with one rounding per FMA, as the kernels
+# do. The products of BF16 values and their sums with the accumulator are exact
+# in float64.
+def bf16_matmul(A, B, rnd):
+  C = np.zeros([A.shape[0], B.shape[1]])
+  for k in range(A.shape[1]):
+    C = rnd(C + np.outer(A[:, k], B[k, :]))
+  return C
+
 ############
 ## SCRIPT ##
 ############
@@ -46,16 +64,37 @@ if len(sys.argv) == 5:
   P = int(sys.argv[4])
 else:
   print("Error. Give me four argument: dtype, M, N, P.")
-  print("dtype in [float64, float32, float16, int64, int32, int16, int8]")
+  print("dtype in [float64, float32, float16, float16w, bfloat16, bfloat16w, int64, int32, int16, int8]")
   print("C = AB with A=[MxP], B=[PxN], C=[MxN]")
   sys.exit()
 
-# Matrices and results
-A = np.random.rand(M, N).astype(dtype)
-B = np.random.rand(N, P).astype(dtype)
-C = np.zeros([M, P], dtype=dtype)
-# Golden result matrix
-G = np.matmul(A, B).astype(dtype)
+if dtype == 'float16w':
+  # FP16 inputs and FP32 results, for vfwdotp. B is stored pair-interleaved:
+  # B[k][j] and B[k+1][j], with k even, are adjacent.
+  A = np.random.rand(M, N).astype(np.float16)
+  Bk = np.random.rand(N, P).astype(np.float16)
+  B = Bk.reshape(N // 2, 2, P).transpose(0, 2, 1)
+  C = np.zeros([M, P], dtype=np.float32)
+  G = np.matmul(A.astype(np.float32), Bk.astype(np.float32))
+elif dtype in ('bfloat16', 'bfloat16w'):
+  # BF16 inputs, and BF16 or FP32 results, as bit patterns
+  Af = bf16_round(np.random.rand(M, N))
+  Bf = bf16_round(np.random.rand(N, P))
+  A = bf16_bits(Af)
+  B = bf16_bits(Bf)
+  if dtype == 'bfloat16':
+    C = np.zeros([M, P], dtype=np.uint16)
+    G = bf16_bits(bf16_matmul(Af, Bf, bf16_round))
+  else:
+    C = np.zeros([M, P], dtype=np.float32)
+    G = bf16_matmul(Af, Bf, lambda x: x.astype(np.float32).astype(np.float64)).astype(np.float32)
+else:
+  # Matrices and results
+  A = np.random.rand(M, N).astype(dtype)
+  B = np.random.rand(N, P).astype(dtype)
+  C = np.zeros([M, P], dtype=dtype)
+  # Golden result matrix
+  G = np.matmul(A, B).astype(dtype)
 
 # Create the file
 print(".section .data,\"aw\",@progbits")
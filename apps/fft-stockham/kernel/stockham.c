@@ -0,0 +1,449 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// A radix-r stage s (stride S, the product of the radices of the previous
+// stages, sub-transform length L = N / S) maps, for every flattened index
+// i = q + S * p in [0, N/r), with q < S and p < L/r:
+//
+//   x[i + k * N/r], k = 0..r-1  ->  y[q + S * (rp + k)]
+//                                 = y[i + (r-1)S * p + S * k]
+//
+// with the twiddles W_L^(p*k). The loads are always unit-stride. If S is a
+// multiple of the vector length, a vector of consecutive i has a single p:
+// the stores are unit-stride and the twiddles are scalars. Otherwise, the
+// output of the vector chunk starting at i0 is scattered to
+// r * i0 + S * k + idx[j], with idx[j] = j + (r-1)S * (j / S), and the
+// twiddles are loaded per element. Both idx and the expanded twiddles are
+// cached in the plan.
+//
+// The radix-8 butterfly is split into two radix-4 ones: the even outputs are
+// the DFT4 of x[k] + x[k+4], the odd ones the DFT4 of (x[k] - x[k+4]) * W8^k.
+// The inputs are loaded once for each half, so that the eight complex inputs
+// never have to be live at the same time at LMUL 2.
+
+#include <string.h>
+
+#include "riscv_vector.h"
+
+#include "stockham.h"
+#include "vmath/vmath.h"
+
+// Alignment of the plan buffers
+#define FFT_ALIGN (4 * NR_LANES)
+
+// Complex vector: {re, im} pair
+typedef vfloat32m2x2_t vcplx_t;
+
+// Pointers to a complex buffer. im is NULL for interleaved data.
+typedef struct {
+  float *re;
+  float *im;
+} fft_buf_t;
+
+static inline size_t fft_log2(size_t n) { return 63 - __builtin_clzl(n); }
+
+static inline size_t fft_align(size_t x) {
+  return (x + FFT_ALIGN - 1) & ~(size_t)(FFT_ALIGN - 1);
+}
+
+// Radices of the stages of an n-point transform: radix-8 stages, then one or
+// two radix-4 stages for the remaining factors. Return the number of stages.
+static size_t fft_plan_radices(size_t n, size_t *radix) {
+  const size_t log2n = fft_log2(n);
+  size_t r8 = log2n / 3, r4 = 0, stages = 0;
+
+  if (log2n == 1) {
+    radix[0] = 2;
+    return 1;
+  }
+  // 8 * 2 = 4 * 4, and 4
+  if (log2n % 3 == 1) {
+    r8 -= 1;
+    r4 = 2;
+  } else if (log2n % 3 == 2) {
+    r4 = 1;
+  }
+  while (r8--)
+    radix[stages++] = 8;
+  while (r4--)
+    radix[stages++] = 4;
+  return stages;
+}
+
+// Carve the plan buffers out of mem, starting from offset 0, and return the
+// number of bytes used. If p is NULL, only count the bytes.
+static size_t fft_plan_carve(fft_plan_t *p, uint8_t *mem, size_t n) {
+  const size_t vlmax = __riscv_vsetvlmax_e32m2();
+  size_t radix[FFT_MAX_STAGES];
+  const size_t stages = fft_plan_radices(n, radix);
+  size_t off = fft_align(sizeof(fft_plan_t));
+
+  if (p) {
+    p->work = (float *)(mem + off);
+    p->stages = stages;
+  }
+  off = fft_align(off + 2 * n * sizeof(float));
+
+  size_t stride = 1;
+  for (size_t s = 0; s < stages; stride *= radix[s++]) {
+    const size_t r = radix[s];
+    // The radix-2 stage is the only one of N = 2, and has no twiddles
+    const size_t len = r == 2 ? 0 : stride < vlmax ? n / r : n / (r * stride);
+    if (p) {
+      p->radix[s] = r;
+      p->stride[s] = stride;
+      p->tw[s] = (const float *)(mem + off);
+      p->tw_len[s] = len;
+    }
+    off = fft_align(off + 2 * (r - 1) * len * sizeof(float));
+    if (r != 2 && stride < vlmax) {
+      if (p)
+        p->idx[s] = (const uint32_t *)(mem + off);
+      off = fft_align(off + vlmax * sizeof(uint32_t));
+    } else if (p) {
+      p->idx[s] = NULL;
+    }
+  }
+
+  return off;
+}
+
+size_t fft_plan_size(size_t n) { return fft_plan_carve(NULL, NULL, n); }
+
+// Fill the twiddle table of stage s. Entry e corresponds to the exponent
+// k = (e & ~(S - 1)) for the expanded tables and to k = e * S for the scalar
+// ones; w_m[e] = exp(-+2 pi i * m * k / N), m = 1..r-1.
+static void fft_plan_twiddles(fft_plan_t *p, size_t s) {
+  const size_t n = p->n;
+  const size_t stride = p->stride[s];
+  const size_t len = p->tw_len[s];
+  const int expanded = p->idx[s] != NULL;
+  const double theta = (p->inverse ? 2.0 : -2.0) * 3.14159265358979323846 / n;
+  float *tw = (float *)p->tw[s];
+
+  size_t vl;
+  for (size_t e = 0; e < len; e += vl) {
+    vl = __riscv_vsetvl_e64m2(len - e);
+    vuint64m2_t k = __riscv_vadd_vx_u64m2(__riscv_vid_v_u64m2(vl), e, vl);
+    if (expanded)
+      k = __riscv_vand_vx_u64m2(k, ~(uint64_t)(stride - 1), vl);
+    else
+      k = __riscv_vmul_vx_u64m2(k, stride, vl);
+    vfloat64m2_t kf = __riscv_vfcvt_f_xu_v_f64m2(k, vl);
+    for (size_t m = 1; m < p->radix[s]; ++m) {
+      vfloat64m2_t a = __riscv_vfmul_vf_f64m2(kf, m * theta, vl);
+      vfloat32m1_t wr = __riscv_vfncvt_f_f_w_f32m1(vmath_cos_f64m2(a, vl), vl);
+      vfloat32m1_t wi = __riscv_vfncvt_f_f_w_f32m1(vmath_sin_f64m2(a, vl), vl);
+      __riscv_vse32_v_f32m1(tw + (2 * m - 2) * len + e, wr, vl);
+      __riscv_vse32_v_f32m1(tw + (2 * m - 1) * len + e, wi, vl);
+    }
+  }
+}
+
+// idx[j] = j + (r-1)S * (j / S), j < VLMAX
+static void fft_plan_index(fft_plan_t *p, size_t s) {
+  const size_t stride = p->stride[s];
+  const size_t vl = __riscv_vsetvlmax_e32m2();
+  vuint32m2_t j = __riscv_vid_v_u32m2(vl);
+  vuint32m2_t q = __riscv_vsrl_vx_u32m2(j, fft_log2(stride), vl);
+  vuint32m2_t idx =
+      __riscv_vmacc_vx_u32m2(j, (p->radix[s] - 1) * stride, q, vl);
+  __riscv_vse32_v_u32m2((uint32_t *)p->idx[s], idx, vl);
+}
+
+fft_plan_t *fft_plan_init(size_t n, int inverse, void *mem, size_t len) {
+  // Power of two, at least 2 points, and an aligned memory area
+  if (n < 2 || (n & (n - 1)) || fft_log2(n) > 2 * FFT_MAX_STAGES)
+    return NULL;
+  if (!mem || ((uintptr_t)mem & (FFT_ALIGN - 1)) || len < fft_plan_size(n))
+    return NULL;
+
+  fft_plan_t *p = (fft_plan_t *)mem;
+  memset(p, 0, sizeof(*p));
+  p->n = n;
+  p->inverse = inverse;
+  fft_plan_carve(p, (uint8_t *)mem, n);
+
+  for (size_t s = 0; s < p->stages; ++s) {
+    if (p->radix[s] == 2)
+      continue;
+    fft_plan_twiddles(p, s);
+    if (p->idx[s])
+      fft_plan_index(p, s);
+  }
+
+  return p;
+}
+
+/////////////////////////
+// Loads and stores    //
+/////////////////////////
+
+// Interleaved data is moved with two-field segment loads/stores, which
+// deinterleave re/im into two vector registers
+
+static inline vcplx_t fft_load(fft_buf_t x, size_t off, size_t vl) {
+  if (x.im)
+    return __riscv_vcreate_v_f32m2x2(__riscv_vle32_v_f32m2(x.re + off, vl),
+                                     __riscv_vle32_v_f32m2(x.im + off, vl));
+  return __riscv_vlseg2e32_v_f32m2x2(x.re + 2 * off, vl);
+}
+
+static inline void fft_store(fft_buf_t y, size_t off, vcplx_t v, size_t vl) {
+  if (y.im) {
+    __riscv_vse32_v_f32m2(y.re + off, __riscv_vget_v_f32m2x2_f32m2(v, 0), vl);
+    __riscv_vse32_v_f32m2(y.im + off, __riscv_vget_v_f32m2x2_f32m2(v, 1), vl);
+  } else {
+    __riscv_vsseg2e32_v_f32m2x2(y.re + 2 * off, v, vl);
+  }
+}
+
+// Scatter to off + idx[j], with byte offsets boff = idx * sizeof(element)
+static inline void fft_scatter(fft_buf_t y, size_t off, vuint32m2_t boff,
+                               vcplx_t v, size_t vl) {
+  if (y.im) {
+    __riscv_vsuxei32_v_f32m2(y.re + off, boff,
+                             __riscv_vget_v_f32m2x2_f32m2(v, 0), vl);
+    __riscv_vsuxei32_v_f32m2(y.im + off, boff,
+                             __riscv_vget_v_f32m2x2_f32m2(v, 1), vl);
+  } else {
+    __riscv_vsuxseg2ei32_v_f32m2x2(y.re + 2 * off, boff, v, vl);
+  }
+}
+
+/////////////////////////
+// Complex arithmetic  //
+/////////////////////////
+
+#define RE(v) __riscv_vget_v_f32m2x2_f32m2(v, 0)
+#define IM(v) __riscv_vget_v_f32m2x2_f32m2(v, 1)
+
+static inline vcplx_t fft_add(vcplx_t a, vcplx_t b, size_t vl) {
+  return __riscv_vcreate_v_f32m2x2(__riscv_vfadd_vv_f32m2(RE(a), RE(b), vl),
+                                   __riscv_vfadd_vv_f32m2(IM(a), IM(b), vl));
+}
+
+static inline vcplx_t fft_sub(vcplx_t a, vcplx_t b, size_t vl) {
+  return __riscv_vcreate_v_f32m2x2(__riscv_vfsub_vv_f32m2(RE(a), RE(b), vl),
+                                   __riscv_vfsub_vv_f32m2(IM(a), IM(b), vl));
+}
+
+// a * w, with w = wr + i * wi loaded per element
+static inline vcplx_t fft_mul_vv(vcplx_t a, const float *wr, const float *wi,
+                                 size_t vl) {
+  vfloat32m2_t br = __riscv_vle32_v_f32m2(wr, vl);
+  vfloat32m2_t bi = __riscv_vle32_v_f32m2(wi, vl);
+  vfloat32m2_t re = __riscv_vfmul_vv_f32m2(RE(a), br, vl);
+  vfloat32m2_t im = __riscv_vfmul_vv_f32m2(RE(a), bi, vl);
+  re = __riscv_vfnmsac_vv_f32m2(re, IM(a), bi, vl);
+  im = __riscv_vfmacc_vv_f32m2(im, IM(a), br, vl);
+  return __riscv_vcreate_v_f32m2x2(re, im);
+}
+
+// a * w, with a scalar w = wr + i * wi
+static inline vcplx_t fft_mul_vf(vcplx_t a, float wr, float wi, size_t vl) {
+  vfloat32m2_t re = __riscv_vfmul_vf_f32m2(RE(a), wr, vl);
+  vfloat32m2_t im = __riscv_vfmul_vf_f32m2(RE(a), wi, vl);
+  re = __riscv_vfnmsac_vf_f32m2(re, wi, IM(a), vl);
+  im = __riscv_vfmacc_vf_f32m2(im, wr, IM(a), vl);
+  return __riscv_vcreate_v_f32m2x2(re, im);
+}
+
+/////////////////////////
+// Stages              //
+/////////////////////////
+
+// Store output k of the butterflies of the vector chunk at i0 of stage s,
+// multiplied by its twiddle (none for k = 0). boff are the byte offsets of
+// the scattered stages.
+static inline void fft_store_output(const fft_plan_t *p, size_t s, fft_buf_t y,
+                                    size_t i0, size_t k, vuint32m2_t boff,
+                                    vcplx_t v, size_t vl) {
+  const size_t r = p->radix[s];
+  const size_t stride = p->stride[s];
+  const size_t len = p->tw_len[s];
+  const float *tw = p->tw[s];
+
+  if (p->idx[s]) {
+    // Per-element twiddles, scattered output
+    if (k)
+      v = fft_mul_vv(v, tw + (2 * k - 2) * len + i0,
+                     tw + (2 * k - 1) * len + i0, vl);
+    fft_scatter(y, r * i0 + k * stride, boff, v, vl);
+  } else {
+    // Scalar twiddles, contiguous output
+    const size_t blk = i0 / stride;
+    if (k)
+      v = fft_mul_vf(v, tw[(2 * k - 2) * len + blk],
+                     tw[(2 * k - 1) * len + blk], vl);
+    fft_store(y, i0 + (r - 1) * stride * blk + k * stride, v, vl);
+  }
+}
+
+// DFT4 of a, b, c, d, stored to the outputs k0, k0 + kstep, k0 + 2 kstep,
+// and k0 + 3 kstep of the chunk at i0
+static inline void fft_dft4_store(const fft_plan_t *p, size_t s, fft_buf_t y,
+                                  size_t i0, size_t k0, size_t kstep,
+                                  vuint32m2_t boff, vcplx_t a, vcplx_t b,
+                                  vcplx_t c, vcplx_t d, size_t vl) {
+  vcplx_t apc = fft_add(a, c, vl);
+  vcplx_t amc = fft_sub(a, c, vl);
+  vcplx_t bpd = fft_add(b, d, vl);
+  vcplx_t bmd = fft_sub(b, d, vl);
+
+  fft_store_output(p, s, y, i0, k0, boff, fft_add(apc, bpd, vl), vl);
+  fft_store_output(p, s, y, i0, k0 + 2 * kstep, boff, fft_sub(apc, bpd, vl),
+                   vl);
+
+  // u = (a - c) - i(b - d), v = (a - c) + i(b - d). The inverse transform
+  // rotates the other way.
+  vcplx_t u = __riscv_vcreate_v_f32m2x2(
+      __riscv_vfadd_vv_f32m2(RE(amc), IM(bmd), vl),
+      __riscv_vfsub_vv_f32m2(IM(amc), RE(bmd), vl));
+  vcplx_t v = __riscv_vcreate_v_f32m2x2(
+      __riscv_vfsub_vv_f32m2(RE(amc), IM(bmd), vl),
+      __riscv_vfadd_vv_f32m2(IM(amc), RE(bmd), vl));
+  fft_store_output(p, s, y, i0, k0 + kstep, boff, p->inverse ? v : u, vl);
+  fft_store_output(p, s, y, i0, k0 + 3 * kstep, boff, p->inverse ? u : v, vl);
+}
+
+// Byte offsets of the scattered output of stage s, unused by the contiguous
+// stages
+static inline vuint32m2_t fft_scatter_offsets(const fft_plan_t *p, size_t s,
+                                              fft_buf_t x, size_t vl) {
+  // Element size is 4 B (split) or 8 B (interleaved segment)
+  const size_t esh = x.im ? 2 : 3;
+  if (p->idx[s])
+    return __riscv_vsll_vx_u32m2(__riscv_vle32_v_u32m2(p->idx[s], vl), esh,
+                                 vl);
+  return __riscv_vmv_v_x_u32m2(0, vl);
+}
+
+static void fft_radix4_stage(const fft_plan_t *p, size_t s, fft_buf_t x,
+                             fft_buf_t y) {
+  const size_t n4 = p->n / 4;
+
+  size_t vl;
+  for (size_t i0 = 0; i0 < n4; i0 += vl) {
+    vl = __riscv_vsetvl_e32m2(n4 - i0);
+    vuint32m2_t boff = fft_scatter_offsets(p, s, x, vl);
+
+    fft_dft4_store(p, s, y, i0, 0, 1, boff, fft_load(x, i0, vl),
+                   fft_load(x, i0 + n4, vl), fft_load(x, i0 + 2 * n4, vl),
+                   fft_load(x, i0 + 3 * n4, vl), vl);
+  }
+}
+
+// a * W8^k, k = 1..3, with W8 = exp(-+2 pi i / 8)
+static inline vcplx_t fft_rot8(vcplx_t a, size_t k, int inverse, size_t vl) {
+  const float c = 0.70710678118654752f;
+  vfloat32m2_t re, im;
+
+  if (k == 2) {
+    // -i, or i for the inverse transform
+    re = inverse ? __riscv_vfneg_v_f32m2(IM(a), vl) : IM(a);
+    im = inverse ? RE(a) : __riscv_vfneg_v_f32m2(RE(a), vl);
+    return __riscv_vcreate_v_f32m2x2(re, im);
+  }
+
+  vfloat32m2_t sum = __riscv_vfadd_vv_f32m2(RE(a), IM(a), vl);
+  vfloat32m2_t dif = __riscv_vfsub_vv_f32m2(RE(a), IM(a), vl);
+  if (k == 1) {
+    // (1 - i) / sqrt(2), or (1 + i) / sqrt(2)
+    re = inverse ? dif : sum;
+    im = inverse ? sum : __riscv_vfneg_v_f32m2(dif, vl);
+  } else {
+    // (-1 - i) / sqrt(2), or (-1 + i) / sqrt(2)
+    re = inverse ? __riscv_vfneg_v_f32m2(sum, vl)
+                 : __riscv_vfneg_v_f32m2(dif, vl);
+    im = inverse ? dif : __riscv_vfneg_v_f32m2(sum, vl);
+  }
+  return __riscv_vcreate_v_f32m2x2(__riscv_vfmul_vf_f32m2(re, c, vl),
+                                   __riscv_vfmul_vf_f32m2(im, c, vl));
+}
+
+static void fft_radix8_stage(const fft_plan_t *p, size_t s, fft_buf_t x,
+                             fft_buf_t y) {
+  const size_t n8 = p->n / 8;
+
+  size_t vl;
+  for (size_t i0 = 0; i0 < n8; i0 += vl) {
+    vl = __riscv_vsetvl_e32m2(n8 - i0);
+    vuint32m2_t boff = fft_scatter_offsets(p, s, x, vl);
+
+    // Even outputs: DFT4 of x[k] + x[k+4]
+    vcplx_t a[4];
+    for (size_t k = 0; k < 4; ++k)
+      a[k] = fft_add(fft_load(x, i0 + k * n8, vl),
+                     fft_load(x, i0 + (k + 4) * n8, vl), vl);
+    fft_dft4_store(p, s, y, i0, 0, 2, boff, a[0], a[1], a[2], a[3], vl);
+
+    // Odd outputs: DFT4 of (x[k] - x[k+4]) * W8^k
+    for (size_t k = 0; k < 4; ++k) {
+      a[k] = fft_sub(fft_load(x, i0 + k * n8, vl),
+                     fft_load(x, i0 + (k + 4) * n8, vl), vl);
+      if (k)
+        a[k] = fft_rot8(a[k], k, p->inverse, vl);
+    }
+    fft_dft4_store(p, s, y, i0, 1, 2, boff, a[0], a[1], a[2], a[3], vl);
+  }
+}
+
+// Single stage of N = 2: y[0] = x[0] + x[1], y[1] = x[0] - x[1]
+static void fft_radix2_stage(const fft_plan_t *p, fft_buf_t x, fft_buf_t y) {
+  const size_t n2 = p->n / 2;
+
+  size_t vl;
+  for (size_t i0 = 0; i0 < n2; i0 += vl) {
+    vl = __riscv_vsetvl_e32m2(n2 - i0);
+    vcplx_t a = fft_load(x, i0, vl);
+    vcplx_t b = fft_load(x, i0 + n2, vl);
+    fft_store(y, i0, fft_add(a, b, vl), vl);
+    fft_store(y, i0 + n2, fft_sub(a, b, vl), vl);
+  }
+}
+
+// Run the stages, ping-ponging between out and the work buffer so that the
+// last stage writes out
+static void fft_run(const fft_plan_t *p, fft_buf_t in, fft_buf_t out) {
+  fft_buf_t work = {p->work, in.im ? p->work + p->n : NULL};
+  fft_buf_t x = in;
+  fft_buf_t y = (p->stages & 1) ? out : work;
+
+  for (size_t s = 0; s < p->stages; ++s) {
+    if (p->radix[s] == 8)
+      fft_radix8_stage(p, s, x, y);
+    else if (p->radix[s] == 4)
+      fft_radix4_stage(p, s, x, y);
+    else
+      fft_radix2_stage(p, x, y);
+    x = y;
+    y = (y.re == out.re) ? work : out;
+  }
+}
+
+void fft_execute(const fft_plan_t *plan, const float *in, float *out) {
+  fft_buf_t x = {(float *)in, NULL};
+  fft_buf_t y = {out, NULL};
+  fft_run(plan, x, y);
+}
+
+void fft_execute_split(const fft_plan_t *plan, const float *in_re,
+                       const float *in_im, float *out_re, float *out_im) {
+  fft_buf_t x = {(float *)in_re, (float *)in_im};
+  fft_buf_t y = {out_re, out_im};
+  fft_run(plan, x, y);
+}
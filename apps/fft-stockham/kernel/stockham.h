@@ -0,0 +1,78 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Stockham vector FFT with precomputed plans (single precision)
+//
+// The transform runs radix-8 Stockham stages, followed by one or two radix-4
+// stages if log2(N) is not a multiple of 3 (N = 2 runs a single radix-2
+// stage). Stockham stages are self-sorting, so there is no bit-reversal pass:
+// every stage reads its inputs with unit-stride loads and writes the output
+// in natural order at the end.
+//
+// Usage:
+//   static uint8_t mem[...];               // at least fft_plan_size(n) bytes
+//   fft_plan_t *p = fft_plan_init(n, 0, mem, sizeof(mem));
+//   fft_execute(p, in, out);               // interleaved {re, im} pairs
+//   fft_execute_split(p, in_re, in_im, out_re, out_im);
+//
+// The plan caches, per stage, the twiddle factors and the scatter index
+// vector of the stages whose output stride is shorter than one vector. The
+// transform is out-of-place and unnormalized (the inverse transform is not
+// scaled by 1/N); the input is not modified. The plan also holds the
+// ping-pong work buffer, so it must not be shared by concurrent transforms.
+
+#ifndef _STOCKHAM_H_
+#define _STOCKHAM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Up to N = 2^30 points
+#define FFT_MAX_STAGES 15
+
+typedef struct {
+  size_t n;
+  int inverse;
+  // Number of stages, and the radix (2, 4, or 8) and the output stride of
+  // each one
+  size_t stages;
+  size_t radix[FFT_MAX_STAGES];
+  size_t stride[FFT_MAX_STAGES];
+  // Twiddles of each stage: w1 to w(radix-1) as split re/im arrays of
+  // tw_len[s] elements each
+  const float *tw[FFT_MAX_STAGES];
+  size_t tw_len[FFT_MAX_STAGES];
+  // Output index vector of the scattered stages, NULL for the contiguous ones
+  const uint32_t *idx[FFT_MAX_STAGES];
+  // Work buffer of 2 * n floats
+  float *work;
+} fft_plan_t;
+
+// Bytes of memory needed by the plan of an n-point transform
+size_t fft_plan_size(size_t n);
+
+// Build the plan of an n-point transform (n power of two, n >= 2) in the
+// memory area mem. Return NULL if n is not supported or len is too small.
+fft_plan_t *fft_plan_init(size_t n, int inverse, void *mem, size_t len);
+
+// Transform n complex numbers stored as interleaved {re, im} pairs
+void fft_execute(const fft_plan_t *plan, const float *in, float *out);
+
+// Transform n complex numbers stored as separate real and imaginary arrays
+void fft_execute_split(const fft_plan_t *plan, const float *in_re,
+                       const float *in_im, float *out_re, float *out_im);
+
+#endif
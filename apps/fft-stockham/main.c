@@ -0,0 +1,138 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Stockham FFT benchmark. For every size, run the forward transform on
+// interleaved and split data and the inverse transform on interleaved data,
+// check the results, and print the FLOP/cycle (5 * N * log2(N) / cycles).
+
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel/stockham.h"
+#include "runtime.h"
+#include "util.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Max absolute error, per point of the transform
+#define THRESHOLD 1e-4f
+
+extern uint64_t n_sizes;
+extern uint64_t sizes[];
+extern uint64_t plan_mem_size;
+// Interleaved {re, im} input, and forward gold outputs of every size
+extern float samples[] __attribute__((aligned(4 * NR_LANES)));
+extern float gold[] __attribute__((aligned(4 * NR_LANES)));
+extern uint8_t plan_mem[] __attribute__((aligned(4 * NR_LANES)));
+extern float out[] __attribute__((aligned(4 * NR_LANES)));
+extern float in_split[] __attribute__((aligned(4 * NR_LANES)));
+extern float out_split[] __attribute__((aligned(4 * NR_LANES)));
+
+// Compare n complex numbers, a and b interleaved or split (im at offset n),
+// with b scaled by scale
+static int check(const float *a, int a_split, const float *b, float scale,
+                 size_t n) {
+  int err = 0;
+  for (size_t i = 0; i < n; ++i) {
+    float are = a_split ? a[i] : a[2 * i];
+    float aim = a_split ? a[n + i] : a[2 * i + 1];
+    if (!similarity_check_32b(are, scale * b[2 * i], THRESHOLD * n) ||
+        !similarity_check_32b(aim, scale * b[2 * i + 1], THRESHOLD * n)) {
+      printf("Error at index %d: %f + j%f != %f + j%f\n", i, are, aim,
+             scale * b[2 * i], scale * b[2 * i + 1]);
+      err++;
+    }
+  }
+  return err;
+}
+
+static void print_row(size_t n, const char *layout, const char *dir,
+                      int64_t runtime) {
+  float perf = 5.0f * n * (31 - __builtin_clz(n)) / runtime;
+  printf("%6d  %-11s  %-7s  %9d  %9f\n", n, layout, dir, runtime, perf);
+}
+
+int main() {
+  printf("\n");
+  printf("==================\n");
+  printf("=  FFT STOCKHAM  =\n");
+  printf("==================\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+  const float *gold_n = gold;
+
+  printf("     N  layout       dir         cycles  FLOP/cycle\n");
+
+  for (uint64_t s = 0; s < n_sizes; ++s) {
+    const size_t n = sizes[s];
+    fft_plan_t *plan;
+    int64_t runtime;
+
+    // Split copy of the input
+    for (size_t i = 0; i < n; ++i) {
+      in_split[i] = samples[2 * i];
+      in_split[n + i] = samples[2 * i + 1];
+    }
+
+    // Forward transform
+    plan = fft_plan_init(n, 0, plan_mem, plan_mem_size);
+    if (!plan) {
+      printf("Error: cannot build the plan of %d points.\n", n);
+      return -1;
+    }
+
+    start_timer();
+    fft_execute(plan, samples, out);
+    stop_timer();
+    runtime = get_timer();
+    print_row(n, "interleaved", "forward", runtime);
+    error += check(out, 0, gold_n, 1.0f, n);
+
+    start_timer();
+    fft_execute_split(plan, in_split, in_split + n, out_split, out_split + n);
+    stop_timer();
+    runtime = get_timer();
+    print_row(n, "split", "forward", runtime);
+    error += check(out_split, 1, gold_n, 1.0f, n);
+
+    // Inverse transform of the gold output, unnormalized
+    plan = fft_plan_init(n, 1, plan_mem, plan_mem_size);
+
+    start_timer();
+    fft_execute(plan, gold_n, out);
+    stop_timer();
+    runtime = get_timer();
+    print_row(n, "interleaved", "inverse", runtime);
+    error += check(out, 0, samples, (float)n, n);
+
+    gold_n += 2 * n;
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+# Copyright 2026 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# arg1, arg2, ...: FFT sizes (powers of two)
+
+import numpy as np
+import sys
+
+def emit(name, array, alignment='8'):
+  print(".global %s" % name)
+  print(".balign " + alignment)
+  print("%s:" % name)
+  bs = array.tobytes()
+  for i in range(0, len(bs), 4):
+    s = ""
+    for n in range(4):
+      s += "%02x" % bs[i+3-n]
+    print("    .word 0x%s" % s)
+
+# Zero-initialized buffer
+def emit_space(name, size, alignment='8'):
+  print(".global %s" % name)
+  print(".balign " + alignment)
+  print("%s:" % name)
+  print("    .space %d" % size)
+
+# Interleaved {re, im} float32 array
+def serialize_cmplx(vector):
+  serial_vec = np.empty(2 * len(vector), dtype=np.float32)
+  serial_vec[0::2] = np.real(vector)
+  serial_vec[1::2] = np.imag(vector)
+  return serial_vec
+
+# Upper bound of fft_plan_size(n), for any VLEN up to 16384: work buffer,
+# plus expanded twiddles (at most 7n bytes for a radix-8 stage) and one index
+# vector per stage
+def plan_size_bound(n):
+  stages = int(np.log2(n)) // 3 + 2
+  return 8 * n + stages * (7 * n + 4096 + 512) + 1024
+
+############
+## SCRIPT ##
+############
+
+if len(sys.argv) < 2:
+  print("Error. Give me at least one argument: the FFT sizes.")
+  sys.exit()
+
+sizes = [int(a) for a in sys.argv[1:]]
+for n in sizes:
+  if n < 2 or n & (n - 1):
+    print("Error. The FFT sizes must be powers of two.")
+    sys.exit()
+max_n = max(sizes)
+
+np.random.seed(42)
+
+samples = (np.random.uniform(-1, 1, max_n) +
+           1j * np.random.uniform(-1, 1, max_n)).astype(np.complex64)
+# Gold outputs of the forward transform of the first n samples, back to back
+gold = np.concatenate([serialize_cmplx(np.fft.fft(samples[:n].astype(np.complex128)))
+                       for n in sizes])
+
+print(".section .data,\"aw\",@progbits")
+emit("n_sizes", np.array(len(sizes), dtype=np.uint64))
+emit("sizes", np.array(sizes, dtype=np.uint64))
+emit("samples", serialize_cmplx(samples), 'NR_LANES*4')
+emit("gold", gold, 'NR_LANES*4')
+emit("plan_mem_size", np.array(plan_size_bound(max_n), dtype=np.uint64))
+emit_space("plan_mem", plan_size_bound(max_n), 'NR_LANES*4')
+for buf in ["out", "in_split", "out_split"]:
+  emit_space(buf, 8 * max_n, 'NR_LANES*4')
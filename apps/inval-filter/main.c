@@ -0,0 +1,147 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Long-run behaviour of the L1 invalidation filter of ara_system. Every round,
+// CVA6 reads a new slice of a large buffer, so that many more lines than the
+// shadow of the L1 tags holds go through it. Ara then stores to a buffer that
+// CVA6 never reads, and the invalidations and the skipped lines of that store
+// are read from the performance counters: the skip rate should not drop over
+// the rounds. Finally, Ara overwrites the slice that CVA6 read, and CVA6 reads
+// it back: it must see the new values, also for the lines the filter evicted
+// from its shadow.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS 16
+#endif
+// Elements read by CVA6 every round, and stored by Ara to the cold buffer
+#ifndef HOT
+#define HOT 2048
+#endif
+#ifndef COLD
+#define COLD 1024
+#endif
+
+static uint64_t hot[ROUNDS * HOT]
+    __attribute__((aligned(32 * NR_LANES), section(".l2")));
+static uint64_t cold[COLD]
+    __attribute__((aligned(32 * NR_LANES), section(".l2")));
+
+// Unit-stride vector store of x to n elements of d
+static void vstore(uint64_t *d, uint64_t x, size_t n) {
+  size_t vl;
+
+  for (size_t avl = n; avl > 0; avl -= vl, d += vl) {
+    asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(avl));
+    asm volatile("vmv.v.x v8, %0" ::"r"(x));
+    asm volatile("vse64.v v8, (%0)" ::"r"(d));
+  }
+  asm volatile("fence");
+}
+
+// Scalar sum of n elements, which brings them into the L1
+static uint64_t sum(const uint64_t *s, size_t n) {
+  uint64_t acc = 0;
+  for (size_t i = 0; i < n; ++i)
+    acc += ((volatile const uint64_t *)s)[i];
+  return acc;
+}
+
+int main() {
+  printf("\n");
+  printf("==================\n");
+  printf("=  INVAL FILTER  =\n");
+  printf("==================\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+  int64_t runtime;
+  perf_cnt_t perf_start, perf_end;
+  uint64_t first_rate = 0;
+
+  for (size_t i = 0; i < ROUNDS * HOT; ++i)
+    hot[i] = i;
+
+  printf("%d rounds, %d elements read and %d stored per round\n", ROUNDS, HOT,
+         COLD);
+  printf("round    cycles  inval_reqs  skipped  skip %%\n");
+
+  for (size_t r = 0; r < ROUNDS; ++r) {
+    uint64_t *slice = hot + r * HOT;
+
+    // CVA6 fills its L1, and the shadow, with a new slice
+    uint64_t s = sum(slice, HOT);
+    const uint64_t gold = HOT * (2 * r * HOT + HOT - 1) / 2;
+    if (s != gold) {
+      printf("Error: round %d, read %d instead of %d\n", r, s, gold);
+      error++;
+    }
+
+    // Ara stores to lines that are not in the L1
+    HW_CNT_READY;
+    perf_snapshot(&perf_start);
+    start_timer();
+    vstore(cold, r, COLD);
+    stop_timer();
+    perf_snapshot(&perf_end);
+    HW_CNT_NOT_READY;
+    runtime = get_timer();
+
+    perf_diff(&perf_end, &perf_end, &perf_start);
+    const uint64_t lines = perf_end.inval_reqs + perf_end.inval_skipped;
+    const uint64_t rate = lines ? 100 * perf_end.inval_skipped / lines : 0;
+    if (r == 0)
+      first_rate = rate;
+    printf("%5d  %8d  %10d  %7d  %6d\n", r, runtime, perf_end.inval_reqs,
+           perf_end.inval_skipped, rate);
+
+    // The filter must not degrade to invalidating every line
+    if (rate + 10 < first_rate) {
+      printf("Error: round %d, skip rate %d%% below the %d%% of round 0\n", r,
+             rate, first_rate);
+      error++;
+    }
+
+    // Ara overwrites the slice in the L1, and CVA6 must see it
+    vstore(slice, r + 1, HOT);
+    s = sum(slice, HOT);
+    if (s != HOT * (r + 1)) {
+      printf("Error: round %d, read %d instead of %d after the store\n", r, s,
+             HOT * (r + 1));
+      error++;
+    }
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
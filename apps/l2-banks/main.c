@@ -0,0 +1,162 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Throughput of the banked L2 of ara_soc. Times unit-stride load, store and
+// copy streams over N 64-bit elements, the copy with its destination shifted
+// by 0 to L2_BANKS-1 L2 words, and, on the multi-core configurations, one
+// copy per hart at the same time. Prints the bytes moved per cycle, and the
+// L2 bank accesses and conflicts from the performance counters. The copies
+// are checked.
+//
+// The reads and the writes of a port have their own requesters into the
+// banks: the copy is faster than the load and the store in sequence. Its
+// conflicts depend on the banks of the two streams.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "mt.h"
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Elements of every stream
+#ifndef N
+#define N (1024 * NR_LANES)
+#endif
+// L2NumBanks of ara_soc
+#ifndef L2_BANKS
+#define L2_BANKS 4
+#endif
+
+// An L2 word is a bus word of Ara
+#define L2_WORD_ELEMS (NR_LANES / 2)
+
+static uint64_t src[N]
+    __attribute__((aligned(32 * NR_LANES), section(".l2")));
+static uint64_t dst[N + L2_BANKS * L2_WORD_ELEMS]
+    __attribute__((aligned(32 * NR_LANES), section(".l2")));
+
+// Unit-stride streams of n elements: loads from s, stores to d, or both
+static void stream(const uint64_t *s, uint64_t *d, size_t n) {
+  size_t vl;
+
+  for (size_t avl = n; avl > 0; avl -= vl) {
+    asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(avl));
+    if (s)
+      asm volatile("vle64.v v8, (%0)" ::"r"(s));
+    if (d)
+      asm volatile("vse64.v v8, (%0)" ::"r"(d));
+    s += s ? vl : 0;
+    d += d ? vl : 0;
+  }
+  asm volatile("fence");
+}
+
+// One slice of the copy per hart
+static void copy_slice(unsigned int hart, unsigned int nr_harts, void *arg) {
+  (void)arg;
+  const size_t n = N / nr_harts;
+  stream(src + hart * n, dst + hart * n, n);
+}
+
+static int64_t runtime;
+static perf_cnt_t perf_start, perf_end;
+
+static void report(const char *name, size_t bytes) {
+  perf_diff(&perf_end, &perf_end, &perf_start);
+  printf("%-10s  %8d  %9f  %11d  %12d\n", name, runtime,
+         (float)bytes / runtime, perf_end.l2_accesses, perf_end.l2_conflicts);
+}
+
+#define TIMED(...)                                                             \
+  do {                                                                         \
+    HW_CNT_READY;                                                              \
+    perf_snapshot(&perf_start);                                                \
+    start_timer();                                                             \
+    __VA_ARGS__;                                                               \
+    stop_timer();                                                              \
+    perf_snapshot(&perf_end);                                                  \
+    HW_CNT_NOT_READY;                                                          \
+    runtime = get_timer();                                                     \
+  } while (0)
+
+// The copy at offset off of dst is checked through the uncached alias, since
+// other cores may have written it
+static int check(size_t off) {
+  const uint64_t *d = (const uint64_t *)mt_uncached(dst) + off;
+  for (size_t i = 0; i < N; ++i) {
+    if (d[i] != src[i]) {
+      printf("Error: dst[%d] = %d instead of %d\n", i, d[i], src[i]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int main() {
+  printf("\n");
+  printf("==============\n");
+  printf("=  L2 BANKS  =\n");
+  printf("==============\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+
+  for (size_t i = 0; i < N; ++i)
+    src[i] = 3 * i + 1;
+
+  printf("%d elements of 8 bytes, %d banks of %d bytes\n", N, L2_BANKS,
+         L2_WORD_ELEMS * 8);
+  printf("stream        cycles  B/cycle  l2_accesses  l2_conflicts\n");
+
+  TIMED(stream(src, NULL, N));
+  report("load", N * 8);
+
+  TIMED(stream(NULL, dst, N));
+  report("store", N * 8);
+
+  char name[16];
+  for (size_t b = 0; b < L2_BANKS; ++b) {
+    memset(dst, 0, sizeof(dst));
+    TIMED(stream(src, dst + b * L2_WORD_ELEMS, N));
+    sprintf(name, "copy+%d", b);
+    report(name, 2 * N * 8);
+    error += check(b * L2_WORD_ELEMS);
+  }
+
+  for (unsigned int harts = 2; harts <= mt_nr_harts(); harts *= 2) {
+    memset(dst, 0, sizeof(dst));
+    TIMED(mt_fork(harts, copy_slice, NULL));
+    sprintf(name, "copy x%d", harts);
+    report(name, 2 * N * 8);
+    error += check(0);
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
@@ -288,7 +288,7 @@ void kernel_vec(fp alpha, uint64_t n_boxes, box_str *box, FOUR_VECTOR *rv,
           // u2 = a2*r2;
           xu2 = _MM_MUL_f32(xa2, xr2, gvl);
           // vij= exp(-u2);
-          xvij = __exp_2xf32(_MM_VFSGNJN_f32(xu2, xu2, gvl), gvl);
+          xvij = vmath_exp_fast_f32m1(_MM_VFSGNJN_f32(xu2, xu2, gvl), gvl);
 
           if (k && (j + gvl) >= NUMBER_PAR_PER_BOX) {
             // Accumulate final results
@@ -14,7 +14,7 @@
 #ifndef _LAVAMD_H_
 #define _LAVAMD_H_
 
-#include "../lib/exp.h"
+#include "vmath/vmath.h"
 #include "rivec/vector_defines.h"
 #include <math.h>
 #include <stdint.h>
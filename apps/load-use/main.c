@@ -0,0 +1,166 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Load-to-use microbenchmark, on the pattern of the inner loop of fmatmul.
+// Every iteration loads a row of B with LMUL = 8, and accumulates it into v16
+// with a vfmacc.vf, once reading the loaded row (dependent), and once another
+// register (independent). The difference of their cycles per iteration is the
+// load-to-use latency left after chaining. fmatmul itself is then timed.
+//
+// Build the hardware with load_chaining=1 to compare against the rate-matched
+// chaining of the loads.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel/fmatmul.h"
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+#ifndef ITER
+#define ITER 16
+#endif
+
+// Matrix size of fmatmul
+#ifndef M
+#define M 64
+#endif
+
+// Elements of a register group with LMUL = 8, at SEW = 64
+#define VLMAX (VLEN / 8)
+
+typedef enum { LOAD, INDEPENDENT, DEPENDENT, N_CASES } load_use_e;
+
+static const char *names[N_CASES] = {"load", "independent", "dependent"};
+
+static double row[VLMAX] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+static double acc[VLMAX] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+
+static double a[M * M] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+static double b[M * M] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+static double c[M * M] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+
+static void run_case(load_use_e l, double f) {
+  asm volatile("vmv.v.i v16, 0");
+  for (size_t i = 0; i < ITER; ++i) {
+    asm volatile("vle64.v v8, (%0)" ::"r"(row));
+    switch (l) {
+    case INDEPENDENT:
+      asm volatile("vfmacc.vf v16, %0, v24" ::"f"(f));
+      break;
+    case DEPENDENT:
+      asm volatile("vfmacc.vf v16, %0, v8" ::"f"(f));
+      break;
+    default:
+      break;
+    }
+  }
+  asm volatile("vse64.v v16, (%0)" ::"r"(acc));
+  asm volatile("fence");
+}
+
+int main() {
+  printf("\n");
+  printf("==============\n");
+  printf("=  LOAD USE  =\n");
+  printf("==============\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+  int64_t runtime;
+  size_t vl;
+
+  for (size_t i = 0; i < VLMAX; ++i)
+    row[i] = (double)(i % 7 - 3);
+
+  asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(VLMAX));
+  asm volatile("vmv.v.i v24, 0");
+
+  printf("%d iterations, vl = %d at LMUL = 8\n", ITER, vl);
+  printf("case             cycles  cycles/iter\n");
+
+  int64_t cycles[N_CASES];
+  for (int l = 0; l < N_CASES; ++l) {
+    HW_CNT_READY;
+    start_timer();
+    run_case(l, 2.0);
+    stop_timer();
+    HW_CNT_NOT_READY;
+    runtime = get_timer();
+    cycles[l] = runtime;
+
+    printf("%-12s  %9d  %11d\n", names[l], runtime, runtime / ITER);
+
+    // The dependent case accumulates the row, the other ones leave v16 at 0
+    for (size_t i = 0; i < vl; ++i) {
+      const double gold = l == DEPENDENT ? 2.0 * ITER * row[i] : 0;
+      if (acc[i] != gold) {
+        printf("Error: %s, acc[%d] = %f instead of %f\n", names[l], i, acc[i],
+               gold);
+        error++;
+        break;
+      }
+    }
+  }
+
+  printf("Load-to-use: %d cycles per iteration\n",
+         (cycles[DEPENDENT] - cycles[INDEPENDENT]) / ITER);
+
+  // fmatmul, whose vfmacc chain on the row of B loaded by the previous one
+  for (int i = 0; i < M; ++i) {
+    for (int j = 0; j < M; ++j) {
+      a[i * M + j] = (double)((i + 2 * j) % 7 - 3);
+      b[i * M + j] = (double)((3 * i + j) % 5 - 2);
+    }
+  }
+
+  HW_CNT_READY;
+  start_timer();
+  fmatmul(c, a, b, M, M, M);
+  stop_timer();
+  HW_CNT_NOT_READY;
+  runtime = get_timer();
+
+  printf("fmatmul %dx%d: %d cycles, %f FLOP/cycle\n", M, M, runtime,
+         2.0 * M * M * M / runtime);
+
+  // Check the diagonal
+  for (int i = 0; i < M; ++i) {
+    double gold = 0;
+    for (int k = 0; k < M; ++k)
+      gold += a[i * M + k] * b[k * M + i];
+    if (c[i * M + i] != gold) {
+      printf("Error: c[%d][%d] = %f instead of %f\n", i, i, c[i * M + i], gold);
+      error++;
+      break;
+    }
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
@@ -0,0 +1,151 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Memory stream bandwidth. Times unit-stride load, store and copy streams,
+// and an indexed gather followed by a store, over N 64-bit elements, and
+// prints the bytes moved per cycle. The copy and the gather are checked.
+//
+// Build the hardware with nr_mem_ports > 1 (e.g., config=4_lanes_2_ports) to
+// spread the 512-byte pages of the streams over several memory ports of Ara.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Elements of every stream
+#ifndef N
+#define N (1024 * NR_LANES)
+#endif
+
+typedef enum { LOAD, STORE, COPY, GATHER, N_CASES } stream_e;
+
+static const char *names[N_CASES] = {"load", "store", "copy", "gather"};
+
+static uint64_t src[N] __attribute__((aligned(32 * NR_LANES)));
+static uint64_t dst[N] __attribute__((aligned(32 * NR_LANES)));
+// Byte offsets of the gather
+static uint64_t idx[N] __attribute__((aligned(32 * NR_LANES)));
+
+static void run_case(stream_e c) {
+  const uint64_t *s = src, *o = idx;
+  uint64_t *d = dst;
+  size_t vl;
+
+  for (size_t avl = N; avl > 0; avl -= vl) {
+    asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(avl));
+    switch (c) {
+    case LOAD:
+      asm volatile("vle64.v v8, (%0)" ::"r"(s));
+      break;
+    case STORE:
+      asm volatile("vse64.v v16, (%0)" ::"r"(d));
+      break;
+    case COPY:
+      asm volatile("vle64.v v8, (%0)" ::"r"(s));
+      asm volatile("vse64.v v8, (%0)" ::"r"(d));
+      break;
+    default:
+      asm volatile("vle64.v v24, (%0)" ::"r"(o));
+      asm volatile("vluxei64.v v8, (%0), v24" ::"r"(src));
+      asm volatile("vse64.v v8, (%0)" ::"r"(d));
+      break;
+    }
+    s += vl;
+    o += vl;
+    d += vl;
+  }
+  asm volatile("fence");
+}
+
+// Bytes read and written by one case
+static size_t case_bytes(stream_e c) {
+  switch (c) {
+  case LOAD:
+  case STORE:
+    return N * sizeof(uint64_t);
+  case COPY:
+    return 2 * N * sizeof(uint64_t);
+  default:
+    return 3 * N * sizeof(uint64_t);
+  }
+}
+
+int main() {
+  printf("\n");
+  printf("====================\n");
+  printf("=  MEMORY STREAMS  =\n");
+  printf("====================\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+
+  // A permutation of the elements, which jumps across pages
+  for (size_t i = 0; i < N; ++i) {
+    src[i] = 0x0123456789abcdefull * (i + 1);
+    idx[i] = ((i * 2654435761u) % N) * sizeof(uint64_t);
+  }
+  asm volatile("vsetvli zero, %0, e64, m8, ta, ma" ::"r"(N));
+  asm volatile("vmv.v.i v16, 0");
+
+  printf("N = %d elements per stream, %d lanes\n", N, NR_LANES);
+  printf("stream      cycles     B/cycle  B/cycle/lane\n");
+
+  for (int c = 0; c < N_CASES; ++c) {
+    memset(dst, 0, sizeof(dst));
+
+    HW_CNT_READY;
+    start_timer();
+    run_case(c);
+    stop_timer();
+    HW_CNT_NOT_READY;
+    int64_t runtime = get_timer();
+    if (runtime <= 0)
+      runtime = 1;
+
+    const float bw = (float)case_bytes(c) / runtime;
+    printf("%-6s  %10d  %10f  %12f\n", names[c], runtime, bw, bw / NR_LANES);
+
+    if (c != COPY && c != GATHER)
+      continue;
+    for (size_t i = 0; i < N; ++i) {
+      const uint64_t exp =
+          c == COPY ? src[i] : src[idx[i] / sizeof(uint64_t)];
+      if (dst[i] != exp) {
+        printf("Error: %s, element %d: %lx instead of %lx\n", names[c], i,
+               dst[i], exp);
+        error++;
+        break;
+      }
+    }
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
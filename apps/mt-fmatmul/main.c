@@ -0,0 +1,126 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Multi-core fmatmul. The rows of C = AB are split in blocks among the harts,
+// and every hart computes its block with fmatmul on its own Ara. The product
+// is timed on 1, 2, 4, ... harts, up to NR_CORES, fork and join included, and
+// the speedup over a single hart is printed. The results are read back through
+// the uncached alias, and checked against a scalar reference at a few columns
+// of every row.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel/fmatmul.h"
+#include "mt.h"
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// C = AB with A=[MxN], B=[NxP], C=[MxP]. The blocks of M / harts rows must be
+// 4, 8, or a multiple of 16 rows (see fmatmul).
+#ifndef M
+#define M 64
+#endif
+#ifndef N
+#define N 64
+#endif
+#ifndef P
+#define P 64
+#endif
+
+// Checked columns per row
+#define SAMPLES 4
+
+static double a[M * N] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+static double b[N * P] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+static double c[M * P] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+
+static void fmatmul_block(unsigned int hart, unsigned int nr_harts, void *arg) {
+  (void)arg;
+  const unsigned long int rows = M / nr_harts;
+  fmatmul(c + hart * rows * P, a + hart * rows * N, b, rows, N, P);
+}
+
+int main() {
+  printf("\n");
+  printf("================\n");
+  printf("=  MT FMATMUL  =\n");
+  printf("================\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+
+  // Small integers, for an exact result
+  for (int i = 0; i < M; ++i)
+    for (int j = 0; j < N; ++j)
+      a[i * N + j] = (double)((i + 2 * j) % 7 - 3);
+  for (int i = 0; i < N; ++i)
+    for (int j = 0; j < P; ++j)
+      b[i * P + j] = (double)((3 * i + j) % 5 - 2);
+
+  printf("(%d x %d) x (%d x %d) on up to %d harts\n", M, N, N, P,
+         mt_nr_harts());
+  printf("harts      cycles  FLOP/cycle  speedup\n");
+
+  int64_t runtime_1 = 0;
+  for (unsigned int harts = 1; harts <= mt_nr_harts(); harts *= 2) {
+    memset(c, 0, sizeof(c));
+
+    HW_CNT_READY;
+    start_timer();
+    mt_fork(harts, fmatmul_block, NULL);
+    stop_timer();
+    HW_CNT_NOT_READY;
+    const int64_t runtime = get_timer();
+    if (harts == 1)
+      runtime_1 = runtime;
+
+    printf("%5d  %10d  %10f  %7f\n", harts, runtime,
+           2.0 * M * N * P / runtime, (double)runtime_1 / runtime);
+
+    // The other cores wrote C: bypass the L1
+    const double *c_ = (const double *)mt_uncached(c);
+    for (int i = 0; i < M && !error; ++i) {
+      for (int s = 0; s < SAMPLES; ++s) {
+        const int j = (5 * i + s * (P / SAMPLES)) % P;
+        double gold = 0;
+        for (int k = 0; k < N; ++k)
+          gold += a[i * N + k] * b[k * P + j];
+        if (c_[i * P + j] != gold) {
+          printf("Error: %d harts, c[%d][%d] = %f instead of %f\n", harts, i,
+                 j, c_[i * P + j], gold);
+          error++;
+          break;
+        }
+      }
+    }
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
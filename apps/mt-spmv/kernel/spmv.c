@@ -0,0 +1 @@
+../../spmv/kernel/spmv.c
\ No newline at end of file
@@ -0,0 +1,144 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Multi-core SpMV. The rows of a CSR matrix with a varying number of nonzeros
+// per row are split among the harts, with the same number of nonzeros each,
+// and every hart runs spmv_csr_idx32 on its rows with its own Ara. The product
+// is timed on 1, 2, 4, ... harts, up to NR_CORES, fork and join included, and
+// the speedup over a single hart is printed. The result is read back through
+// the uncached alias, and checked against a scalar reference.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel/spmv.h"
+#include "mt.h"
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Matrix of R x C elements, with 8 to 32 nonzeros per row
+#ifndef R
+#define R 256
+#endif
+#ifndef C
+#define C 256
+#endif
+#define ROW_NZ(i) (8 + ((i) * 7) % 25)
+#define NZ_MAX (R * 32)
+
+static int32_t prow[R + 1]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+// Byte offsets of the columns, as the indexed loads take them
+static int32_t col_idx[NZ_MAX]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+static double data[NZ_MAX]
+    __attribute__((aligned(4 * NR_LANES), section(".l2")));
+static double x[C] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+static double y[R] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+static double g[R] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+
+// First row whose nonzeros start at nz or after
+static int32_t first_row(int32_t nz) {
+  int32_t r = 0;
+  while (r < R && prow[r] < nz)
+    ++r;
+  return r;
+}
+
+static void spmv_rows(unsigned int hart, unsigned int nr_harts, void *arg) {
+  (void)arg;
+  const int32_t nz = prow[R];
+  const int32_t r0 = first_row((int64_t)nz * hart / nr_harts);
+  const int32_t r1 =
+      hart + 1 == nr_harts ? R : first_row((int64_t)nz * (hart + 1) / nr_harts);
+  if (r1 > r0)
+    spmv_csr_idx32(r1 - r0, prow + r0, col_idx, data, x, y + r0);
+}
+
+int main() {
+  printf("\n");
+  printf("=============\n");
+  printf("=  MT SPMV  =\n");
+  printf("=============\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+
+  // Small integers, for an exact result. The columns of a row are distinct.
+  prow[0] = 0;
+  for (int i = 0; i < R; ++i) {
+    prow[i + 1] = prow[i] + ROW_NZ(i);
+    g[i] = 0;
+    for (int k = 0; k < ROW_NZ(i); ++k) {
+      const int32_t nz = prow[i] + k;
+      const int32_t col = (3 * i + 11 * k) % C;
+      col_idx[nz] = col * sizeof(double);
+      data[nz] = (double)(nz % 5 - 2);
+    }
+  }
+  for (int j = 0; j < C; ++j)
+    x[j] = (double)(j % 7 - 3);
+  for (int i = 0; i < R; ++i)
+    for (int32_t nz = prow[i]; nz < prow[i + 1]; ++nz)
+      g[i] += data[nz] * x[col_idx[nz] / sizeof(double)];
+
+  printf("(%d x %d) x %d with %d nonzeros on up to %d harts\n", R, C, C,
+         prow[R], mt_nr_harts());
+  printf("harts      cycles  FLOP/cycle  speedup\n");
+
+  int64_t runtime_1 = 0;
+  for (unsigned int harts = 1; harts <= mt_nr_harts(); harts *= 2) {
+    memset(y, 0, sizeof(y));
+
+    HW_CNT_READY;
+    start_timer();
+    mt_fork(harts, spmv_rows, NULL);
+    stop_timer();
+    HW_CNT_NOT_READY;
+    const int64_t runtime = get_timer();
+    if (harts == 1)
+      runtime_1 = runtime;
+
+    printf("%5d  %10d  %10f  %7f\n", harts, runtime, 2.0 * prow[R] / runtime,
+           (double)runtime_1 / runtime);
+
+    // The other cores wrote y: bypass the L1
+    const double *y_ = (const double *)mt_uncached(y);
+    for (int i = 0; i < R; ++i) {
+      if (y_[i] != g[i]) {
+        printf("Error: %d harts, y[%d] = %f instead of %f\n", harts, i, y_[i],
+               g[i]);
+        error++;
+        break;
+      }
+    }
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
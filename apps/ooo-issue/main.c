@@ -0,0 +1,176 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Issue rate of mixed-unit kernels. Every iteration runs DIVS vfdiv on the
+// MFPU, followed by OPS independent instructions for another unit: vadd on the
+// ALU, or vslidedown on the slide unit. The divisions fill the queue of the
+// MFPU, and the instructions behind them wait for it, unless the sequencer
+// issues them past the waiting division. A last kernel copies the quotient
+// with vmv.v.v, which depends on the division and must wait for it. The
+// registers of the independent instructions are outside of the register groups
+// of the division, doubled by the conservative check of the sequencer.
+// Prints the cycles, the issued instructions per cycle, and the instructions
+// issued out of order, from the performance counters. The results are checked.
+//
+// Build the hardware with ooo_issue=1 to compare against the in-order issue.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+#ifndef ITER
+#define ITER 8
+#endif
+// Divisions and independent instructions per iteration
+#ifndef DIVS
+#define DIVS 4
+#endif
+#ifndef OPS
+#define OPS 4
+#endif
+
+// Elements of a register group with LMUL = 2, at SEW = 64
+#define VL (VLEN / 32)
+
+typedef enum { ALU, SLIDE, DEPENDENT, N_CASES } ooo_issue_e;
+
+static const char *names[N_CASES] = {"fdiv+vadd", "fdiv+vslide",
+                                     "fdiv+vmv dep"};
+
+static double num[VL] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+static double den[VL] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+static int64_t add[VL] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+static double quo[VL] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+static int64_t res[VL] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+
+// v8 = num / den on the MFPU, then v16 += v20, v16 = v20 slid down by one, or
+// v16 = v8
+static void run_case(ooo_issue_e o) {
+  for (size_t i = 0; i < ITER; ++i) {
+    for (size_t d = 0; d < DIVS; ++d)
+      asm volatile("vfdiv.vv v8, v4, v6");
+    for (size_t k = 0; k < OPS; ++k) {
+      switch (o) {
+      case ALU:
+        asm volatile("vadd.vv v16, v16, v20");
+        break;
+      case SLIDE:
+        asm volatile("vslidedown.vi v16, v20, 1");
+        break;
+      default:
+        asm volatile("vmv.v.v v16, v8");
+        break;
+      }
+    }
+  }
+  asm volatile("vse64.v v8, (%0)" ::"r"(quo));
+  asm volatile("vse64.v v16, (%0)" ::"r"(res));
+  asm volatile("fence");
+}
+
+static int check(ooo_issue_e o) {
+  for (size_t i = 0; i < VL; ++i) {
+    const double q = num[i] / den[i];
+    if (quo[i] != q) {
+      printf("Error: %s, quo[%d] = %f instead of %f\n", names[o], i, quo[i], q);
+      return 1;
+    }
+    int64_t gold;
+    switch (o) {
+    case ALU:
+      gold = (int64_t)ITER * OPS * add[i];
+      break;
+    case SLIDE:
+      gold = i + 1 < VL ? add[i + 1] : 0;
+      break;
+    default:
+      memcpy(&gold, &q, sizeof(gold));
+      break;
+    }
+    if (res[i] != gold) {
+      printf("Error: %s, res[%d] = %d instead of %d\n", names[o], i, res[i],
+             gold);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int main() {
+  printf("\n");
+  printf("===============\n");
+  printf("=  OOO ISSUE  =\n");
+  printf("===============\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+  int64_t runtime;
+  size_t vl;
+  perf_cnt_t perf_start, perf_end;
+
+  // Powers of two as denominators, for an exact quotient
+  for (size_t i = 0; i < VL; ++i) {
+    num[i] = (double)(i % 7 - 3);
+    den[i] = (double)(1 << (i % 3));
+    add[i] = 5 * i + 1;
+  }
+
+  asm volatile("vsetvli %0, %1, e64, m2, ta, ma" : "=r"(vl) : "r"(VL));
+
+  printf("%d iterations of %d vfdiv and %d other instructions, vl = %d\n", ITER,
+         DIVS, OPS, vl);
+  printf("kernel          cycles  vinsn  vinsn/cycle  out-of-order\n");
+
+  for (int o = 0; o < N_CASES; ++o) {
+    asm volatile("vle64.v v4, (%0)" ::"r"(num));
+    asm volatile("vle64.v v6, (%0)" ::"r"(den));
+    asm volatile("vle64.v v20, (%0)" ::"r"(add));
+    asm volatile("vmv.v.i v16, 0");
+
+    HW_CNT_READY;
+    perf_snapshot(&perf_start);
+    start_timer();
+    run_case(o);
+    stop_timer();
+    perf_snapshot(&perf_end);
+    HW_CNT_NOT_READY;
+    runtime = get_timer();
+
+    perf_diff(&perf_end, &perf_end, &perf_start);
+    printf("%-12s  %8d  %5d  %11f  %12d\n", names[o], runtime,
+           perf_end.vinsn_issues, (float)perf_end.vinsn_issues / runtime,
+           perf_end.ooo_issues);
+
+    error += check(o);
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
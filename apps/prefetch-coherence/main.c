@@ -0,0 +1,165 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Coherence of the VLSU's stream prefetcher with the other writers of the
+// memory. Ara copies the first part of a buffer with unit-stride loads, which
+// starts a stream: the prefetcher fetches the next blocks of the buffer. The
+// rest of the buffer is then overwritten, by the DMA or by CVA6, and Ara
+// copies it: it must read the new values, and not the prefetched ones. The
+// DMA first copies an unrelated buffer, so that the prefetcher has the time to
+// fetch the blocks again before the DMA writes them.
+//
+// Build the hardware with config=4_lanes_prefetch to enable the prefetcher,
+// with a slower L2. The prefetched and the fetched beats are printed.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "dma.h"
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS 4
+#endif
+// Elements of the buffer, and elements copied before it is overwritten. The
+// overwritten part starts in the middle of a 4 KiB page, so that the
+// prefetcher fetches its first blocks.
+#ifndef N
+#define N 1024
+#endif
+#ifndef HEAD
+#define HEAD 384
+#endif
+// Elements of the unrelated copy of the DMA
+#ifndef SCRATCH
+#define SCRATCH 4096
+#endif
+
+typedef enum { DMA, CVA6, N_WRITERS } writer_e;
+
+static const char *names[N_WRITERS] = {"dma", "cva6"};
+
+static uint64_t buf[N] __attribute__((aligned(4096), section(".l2")));
+static uint64_t src[N] __attribute__((aligned(4096), section(".l2")));
+static uint64_t dst[N] __attribute__((aligned(4096), section(".l2")));
+static uint64_t scratch_src[SCRATCH]
+    __attribute__((aligned(4096), section(".l2")));
+static uint64_t scratch_dst[SCRATCH]
+    __attribute__((aligned(4096), section(".l2")));
+
+// Unit-stride vector copy of n elements, by register groups of LMUL = 1
+static void vcopy(uint64_t *d, const uint64_t *s, size_t n) {
+  size_t vl;
+
+  for (size_t avl = n; avl > 0; avl -= vl, d += vl, s += vl) {
+    asm volatile("vsetvli %0, %1, e64, m1, ta, ma" : "=r"(vl) : "r"(avl));
+    asm volatile("vle64.v v8, (%0)" ::"r"(s));
+    asm volatile("vse64.v v8, (%0)" ::"r"(d));
+  }
+  asm volatile("fence");
+}
+
+static uint64_t old_val(size_t i, size_t r) { return (r << 32) | i; }
+static uint64_t new_val(size_t i, size_t r) { return ~old_val(i, r); }
+
+// Overwrite the tail of the buffer with the new values
+static void overwrite(writer_e w) {
+  dma_id_t id;
+
+  switch (w) {
+  case DMA:
+    dma_start(scratch_dst, scratch_src, sizeof(scratch_src));
+    id = dma_start(buf + HEAD, src + HEAD, (N - HEAD) * sizeof(uint64_t));
+    dma_wait(id);
+    break;
+  default:
+    for (size_t i = HEAD; i < N; ++i)
+      buf[i] = src[i];
+    asm volatile("fence");
+    break;
+  }
+}
+
+int main() {
+  printf("\n");
+  printf("========================\n");
+  printf("=  PREFETCH COHERENCE  =\n");
+  printf("========================\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+  int64_t runtime;
+  perf_cnt_t perf_start, perf_end;
+
+  for (size_t i = 0; i < SCRATCH; ++i)
+    scratch_src[i] = i;
+
+  printf("%d rounds, %d elements overwritten after %d\n", ROUNDS, N - HEAD,
+         HEAD);
+  printf("writer  round    cycles  pf_hits  pf_misses\n");
+
+  for (int w = 0; w < N_WRITERS; ++w) {
+    for (size_t r = 0; r < ROUNDS; ++r) {
+      for (size_t i = 0; i < N; ++i) {
+        buf[i] = old_val(i, r);
+        src[i] = new_val(i, r);
+      }
+      asm volatile("fence");
+
+      HW_CNT_READY;
+      perf_snapshot(&perf_start);
+      start_timer();
+      // Start the stream, and let the prefetcher fetch the tail
+      vcopy(dst, buf, HEAD);
+      overwrite(w);
+      vcopy(dst + HEAD, buf + HEAD, N - HEAD);
+      stop_timer();
+      perf_snapshot(&perf_end);
+      HW_CNT_NOT_READY;
+      runtime = get_timer();
+
+      perf_diff(&perf_end, &perf_end, &perf_start);
+      printf("%-6s  %5d  %8d  %7d  %9d\n", names[w], r, runtime,
+             perf_end.pf_hits, perf_end.pf_misses);
+
+      for (size_t i = 0; i < N; ++i) {
+        const uint64_t gold = i < HEAD ? old_val(i, r) : new_val(i, r);
+        if (dst[i] != gold) {
+          printf("Error: %s, round %d, dst[%d] = %lx instead of %lx\n",
+                 names[w], r, i, dst[i], gold);
+          error++;
+          break;
+        }
+      }
+    }
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
@@ -0,0 +1,134 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// RVV instruction microbenchmarks. For every instruction, SEW and LMUL
+// generated by script/gen_data.py, print the issue throughput and the
+// dependent-chain latency, in cycles per instruction, at the maximum vector
+// length and at one element per lane. Compare two tables, e.g. of two
+// configurations or RTL revisions, with scripts/rvv_perf_diff.py.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Instructions per block of the generated functions, see gen_data.py
+#define UNROLL 8
+// Blocks of the shorter timed run
+#define ITERS 4
+
+typedef size_t (*rvv_perf_fn_t)(size_t avl, uint64_t iters, void *buf);
+
+// Table entry written by gen_data.py. lat is NULL for the instructions
+// without a vector source to chain through.
+typedef struct {
+  const char *cls;
+  const char *insn;
+  rvv_perf_fn_t thr;
+  rvv_perf_fn_t lat;
+  uint32_t sew;
+  uint32_t lmul;
+} rvv_perf_t;
+
+extern uint64_t rvv_perf_n_benches;
+extern rvv_perf_t rvv_perf_benches[];
+
+// Target of the memory instructions: two full LMUL=8 groups, for the
+// strided and segment accesses
+static uint8_t buf[2 * VLEN] __attribute__((aligned(4 * NR_LANES)));
+
+// Cycles per instruction of the steady state. Timing ITERS and 2 * ITERS
+// blocks and taking the difference removes the call, the register setup
+// and the fill and drain of the pipeline.
+static float measure(rvv_perf_fn_t fn, size_t avl, size_t *vl) {
+  int64_t runtime;
+
+  // The indexed loads use the data of the buffer as offsets
+  memset(buf, 0, sizeof(buf));
+  // Warm up the instruction cache
+  fn(avl, 1, buf);
+
+  start_timer();
+  fn(avl, ITERS, buf);
+  stop_timer();
+  runtime = -get_timer();
+
+  start_timer();
+  *vl = fn(avl, 2 * ITERS, buf);
+  stop_timer();
+  runtime += get_timer();
+
+  return (float)runtime / (ITERS * UNROLL);
+}
+
+int main() {
+  printf("\n");
+  printf("==============\n");
+  printf("=  RVV-PERF  =\n");
+  printf("==============\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+  size_t vl;
+  float thr, lat;
+
+  printf("%d instructions, cycles per instruction.\n", rvv_perf_n_benches);
+  printf("class      insn                sew  lmul  point     vl      thr"
+         "      lat\n");
+
+  for (uint64_t i = 0; i < rvv_perf_n_benches; ++i) {
+    const rvv_perf_t *b = &rvv_perf_benches[i];
+    const size_t vlmax = VLEN / b->sew * b->lmul;
+
+    // One element per lane, then the whole register group
+    for (int p = 0; p < 2; ++p) {
+      const size_t avl = p ? vlmax : NR_LANES;
+      const size_t gold = avl < vlmax ? avl : vlmax;
+
+      thr = measure(b->thr, avl, &vl);
+      if (vl != gold) {
+        printf("Error: %s, SEW %d, LMUL %d: vl %d != %d\n", b->insn, b->sew,
+               b->lmul, vl, gold);
+        error++;
+      }
+
+      printf("%-9s  %-18s  %3d  %4d  %-5s  %5d  %7.2f", b->cls, b->insn,
+             b->sew, b->lmul, p ? "max" : "lane", vl, thr);
+      if (b->lat) {
+        lat = measure(b->lat, avl, &vl);
+        printf("  %7.2f\n", lat);
+      } else {
+        printf("        -\n");
+      }
+    }
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
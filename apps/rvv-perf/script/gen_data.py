@@ -0,0 +1,337 @@
+#!/usr/bin/env python3
+# Copyright 2026 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# arg1: comma-separated SEWs, arg2: comma-separated LMULs,
+# arg3: comma-separated instruction classes, or "all"
+#
+# Generate one throughput and, when the instruction allows it, one latency
+# microbenchmark per instruction, SEW and LMUL, as assembly functions
+#
+#   size_t bench(size_t avl, uint64_t iters, void *buf)
+#
+# that set vl from avl, run iters times a block of UNROLL instructions and
+# return vl. The throughput blocks write UNROLL independent destinations
+# from constant sources. The latency blocks alternate two register groups,
+# so that every instruction reads the result of the previous one.
+# Instructions with a scalar result are chained through the matching
+# scalar-to-vector move, and one latency step is the pair of them.
+#
+# The functions are listed in the rvv_perf_benches table, read by main.c.
+
+import sys
+
+UNROLL = 8
+
+# Operand templates. {d} is the destination, {a} the source that carries
+# the latency chain, {b} the constant source. Scalar operands: t1 = 1,
+# t2 = the stride of the strided accesses, ft0 = 1.0, a2 = the buffer.
+FORMS = {
+  'vv'  : "{op} {d}, {a}, {b}",
+  'vx'  : "{op} {d}, {a}, t1",
+  'vi'  : "{op} {d}, {a}, 1",
+  'vf'  : "{op} {d}, {a}, ft0",
+  'vvm' : "{op} {d}, {a}, {b}, v0",
+  'vfm' : "{op} {d}, {a}, ft0, v0",
+  'mac' : "{op} {d}, {b}, {a}",
+  'macx': "{op} {d}, t1, {a}",
+  'macf': "{op} {d}, ft0, {a}",
+  'v'   : "{op} {d}, {a}",
+  'x'   : "{op} {d}",
+  'sx'  : "{op} {d}, t1",
+  'sf'  : "{op} {d}, ft0",
+  'xs'  : "{op} t0, {a}",
+  'fs'  : "{op} ft1, {a}",
+  'ld'  : "{op} {d}, (a2)",
+  'lds' : "{op} {d}, (a2), t2",
+  'ldx' : "{op} {d}, (a2), {a}",
+  'st'  : "{op} {b}, (a2)",
+  'sts' : "{op} {b}, (a2), t2",
+  'stx' : "{op} {b}, (a2), {i}",
+}
+
+# Second instruction of the latency step of the scalar-result forms
+BACK = {
+  'xs': "vmv.s.x {d}, t0",
+  'fs': "vfmv.s.f {d}, ft1",
+}
+
+# Forms without a vector source to chain through
+NO_LATENCY = {'x', 'sx', 'sf', 'ld', 'lds', 'st', 'sts', 'stx'}
+
+# Instruction table. w: 'w' widening (2*SEW must exist), 'n' narrowing.
+# d, a, b: size of the operands in register groups of LMUL. min_sew: the
+# smallest legal SEW. {sew} and {lmul} in the mnemonic are expanded.
+SPECS = []
+def I(cls, op, form, t='i', w=None, d=1, a=1, b=1, min_sew=8):
+  if t == 'f':
+    min_sew = max(min_sew, 16)
+  SPECS.append(dict(cls=cls, op=op, form=form, t=t, w=w, d=d, a=a, b=b,
+                    min_sew=min_sew))
+
+# Single-width integer
+for op, f in [("vadd.vv", 'vv'), ("vadd.vx", 'vx'), ("vadd.vi", 'vi'),
+              ("vsub.vv", 'vv'), ("vrsub.vx", 'vx'), ("vand.vv", 'vv'),
+              ("vor.vx", 'vx'), ("vxor.vi", 'vi'), ("vsll.vv", 'vv'),
+              ("vsrl.vx", 'vx'), ("vsra.vi", 'vi'), ("vminu.vv", 'vv'),
+              ("vmax.vx", 'vx'), ("vadc.vvm", 'vvm'), ("vsbc.vvm", 'vvm'),
+              ("vmerge.vvm", 'vvm'), ("vmv.v.v", 'v'), ("vmv.v.x", 'sx')]:
+  I("int", op, f)
+I("int", "vzext.vf2", 'v', min_sew=16)
+I("int", "vsext.vf4", 'v', min_sew=32)
+I("int", "vsext.vf8", 'v', min_sew=64)
+# Integer compare
+for op, f in [("vmseq.vv", 'vv'), ("vmsne.vx", 'vx'), ("vmsltu.vv", 'vv'),
+              ("vmslt.vx", 'vx'), ("vmsle.vi", 'vi'), ("vmsgt.vx", 'vx'),
+              ("vmadc.vv", 'vv'), ("vmsbc.vv", 'vv')]:
+  I("icmp", op, f)
+# Integer multiply and divide
+for op, f in [("vmul.vv", 'vv'), ("vmul.vx", 'vx'), ("vmulh.vv", 'vv'),
+              ("vmulhu.vx", 'vx'), ("vmulhsu.vv", 'vv'), ("vmacc.vv", 'mac'),
+              ("vnmsac.vx", 'macx'), ("vmadd.vv", 'mac'),
+              ("vnmsub.vv", 'mac')]:
+  I("imul", op, f)
+for op, f in [("vdivu.vv", 'vv'), ("vdiv.vx", 'vx'), ("vremu.vv", 'vv'),
+              ("vrem.vv", 'vv')]:
+  I("idiv", op, f)
+# Widening and narrowing integer
+for op, f, a in [("vwaddu.vv", 'vv', 1), ("vwadd.vx", 'vx', 1),
+                 ("vwsub.wv", 'vv', 2), ("vwsubu.wx", 'vx', 2),
+                 ("vwmul.vv", 'vv', 1), ("vwmulu.vx", 'vx', 1),
+                 ("vwmulsu.vv", 'vv', 1), ("vwmacc.vv", 'mac', 1),
+                 ("vwmaccu.vx", 'macx', 1), ("vwmaccsu.vv", 'mac', 1),
+                 ("vwmaccus.vx", 'macx', 1)]:
+  I("iwiden", op, f, w='w', d=2, a=a)
+for op, f in [("vnsrl.wv", 'vv'), ("vnsra.wx", 'vx'), ("vnsrl.wi", 'vi'),
+              ("vnclip.wv", 'vv'), ("vnclipu.wi", 'vi')]:
+  I("inarrow", op, f, w='n', a=2)
+# Fixed point
+for op, f in [("vsaddu.vv", 'vv'), ("vsadd.vx", 'vx'), ("vssub.vv", 'vv'),
+              ("vssubu.vx", 'vx'), ("vaadd.vv", 'vv'), ("vasubu.vx", 'vx'),
+              ("vsmul.vv", 'vv'), ("vssra.vi", 'vi'), ("vssrl.vv", 'vv')]:
+  I("fixp", op, f)
+# Floating point
+for op, f in [("vfadd.vv", 'vv'), ("vfsub.vf", 'vf'), ("vfrsub.vf", 'vf'),
+              ("vfmul.vv", 'vv'), ("vfmul.vf", 'vf'), ("vfmin.vv", 'vv'),
+              ("vfmax.vf", 'vf'), ("vfsgnj.vv", 'vv'), ("vfsgnjx.vf", 'vf'),
+              ("vfmacc.vv", 'mac'), ("vfnmsac.vf", 'macf'),
+              ("vfmadd.vv", 'mac'), ("vfmerge.vfm", 'vfm'),
+              ("vfmv.v.f", 'sf'), ("vfclass.v", 'v'), ("vfrec7.v", 'v'),
+              ("vfrsqrt7.v", 'v')]:
+  I("fp", op, f, t='f')
+for op, f in [("vmfeq.vv", 'vv'), ("vmflt.vf", 'vf'), ("vmfle.vv", 'vv'),
+              ("vmfge.vf", 'vf')]:
+  I("fcmp", op, f, t='f')
+for op, f in [("vfdiv.vv", 'vv'), ("vfrdiv.vf", 'vf'), ("vfsqrt.v", 'v')]:
+  I("fdiv", op, f, t='f')
+for op in ["vfcvt.x.f.v", "vfcvt.f.x.v", "vfcvt.rtz.xu.f.v"]:
+  I("fcvt", op, 'v', t='f')
+for op in ["vfwcvt.f.f.v", "vfwcvt.f.x.v", "vfwcvt.rtz.x.f.v"]:
+  I("fcvt", op, 'v', t='f', w='w', d=2)
+for op in ["vfncvt.f.f.w", "vfncvt.rod.f.f.w", "vfncvt.x.f.w"]:
+  I("fcvt", op, 'v', t='f', w='n', a=2)
+# Widening floating point
+for op, f, a in [("vfwadd.vv", 'vv', 1), ("vfwadd.wv", 'vv', 2),
+                 ("vfwsub.vf", 'vf', 1), ("vfwmul.vv", 'vv', 1),
+                 ("vfwmacc.vv", 'mac', 1), ("vfwnmsac.vf", 'macf', 1)]:
+  I("fwiden", op, f, t='f', w='w', d=2, a=a)
+# Reductions
+for op in ["vredsum.vs", "vredmaxu.vs", "vredmin.vs", "vredand.vs",
+           "vredxor.vs"]:
+  I("ired", op, 'vv')
+for op in ["vwredsumu.vs", "vwredsum.vs"]:
+  I("ired", op, 'vv', w='w')
+for op in ["vfredusum.vs", "vfredosum.vs", "vfredmax.vs"]:
+  I("fred", op, 'vv', t='f')
+for op in ["vfwredusum.vs", "vfwredosum.vs"]:
+  I("fred", op, 'vv', t='f', w='w')
+# Masks
+for op in ["vmand.mm", "vmnand.mm", "vmandn.mm", "vmxor.mm", "vmor.mm",
+           "vmnor.mm", "vmorn.mm", "vmxnor.mm"]:
+  I("mask", op, 'vv')
+for op in ["vmsbf.m", "vmsif.m", "vmsof.m", "viota.m"]:
+  I("mask", op, 'v')
+I("mask", "vid.v", 'x')
+I("mask", "vcpop.m", 'xs')
+I("mask", "vfirst.m", 'xs')
+# Scalar moves
+I("move", "vmv.x.s", 'xs')
+I("move", "vmv.s.x", 'sx')
+I("move", "vfmv.f.s", 'fs', t='f')
+I("move", "vfmv.s.f", 'sf', t='f')
+I("move", "vmv{lmul}r.v", 'v')
+# Slides
+for op, f in [("vslideup.vx", 'vx'), ("vslideup.vi", 'vi'),
+              ("vslidedown.vx", 'vx'), ("vslidedown.vi", 'vi'),
+              ("vslide1up.vx", 'vx'), ("vslide1down.vx", 'vx')]:
+  I("slide", op, f)
+I("slide", "vfslide1up.vf", 'vf', t='f')
+I("slide", "vfslide1down.vf", 'vf', t='f')
+# Gathers
+for op, f in [("vrgather.vv", 'vv'), ("vrgather.vx", 'vx'),
+              ("vrgather.vi", 'vi'), ("vcompress.vm", 'vv')]:
+  I("gather", op, f)
+# The EEW=16 indices of vrgatherei16 need two groups at SEW=8
+I("gather", "vrgatherei16.vv", 'vv', b=2)
+# Memory, one class per addressing mode
+I("ld-unit", "vle{sew}.v", 'ld')
+I("ld-unit", "vle{sew}ff.v", 'ld')
+I("ld-unit", "vlm.v", 'ld')
+I("ld-stride", "vlse{sew}.v", 'lds')
+I("ld-index", "vluxei{sew}.v", 'ldx')
+I("ld-index", "vloxei{sew}.v", 'ldx')
+I("ld-seg", "vlseg2e{sew}.v", 'ld', d=2)
+I("ld-seg", "vlsseg2e{sew}.v", 'lds', d=2)
+I("ld-seg", "vluxseg2ei{sew}.v", 'ldx', d=2)
+I("ld-whole", "vl{lmul}re{sew}.v", 'ld')
+I("st-unit", "vse{sew}.v", 'st')
+I("st-unit", "vsm.v", 'st')
+I("st-stride", "vsse{sew}.v", 'sts')
+I("st-index", "vsuxei{sew}.v", 'stx')
+I("st-index", "vsoxei{sew}.v", 'stx')
+I("st-seg", "vsseg2e{sew}.v", 'st', b=2)
+I("st-seg", "vssseg2e{sew}.v", 'sts', b=2)
+I("st-seg", "vsuxseg2ei{sew}.v", 'stx', b=2)
+I("st-whole", "vs{lmul}r.v", 'st')
+
+###############
+## GENERATOR ##
+###############
+
+def legal(s, sew, lmul):
+  if sew < s['min_sew']:
+    return False
+  if s['w'] and (sew > 32 or (s['t'] == 'f' and sew < 16)):
+    return False
+  return lmul * max(s['d'], s['a'], s['b']) <= 8
+
+def reg(group, size):
+  return "v%d" % (group * size)
+
+# Register groups: the whole register file in groups of the largest operand
+def groups(s, lmul):
+  size = lmul * max(s['d'], s['a'], s['b'])
+  first = 1 if 'v0' in FORMS[s['form']] else 0
+  return size, list(range(first, 32 // size))
+
+def emit_init(s, sew, size, g):
+  # Integer ones everywhere, converted to 1.0 for the floating-point
+  # instructions. The memory instructions start from zeros instead, since
+  # the indexed loads of the latency chains use them as offsets, and the
+  # index group of the throughput blocks holds unit-stride offsets.
+  mem = s['form'] in ('ld', 'lds', 'ldx', 'st', 'sts', 'stx')
+  print("  vsetvli t0, zero, e%d, m8, ta, ma" % sew)
+  for v in range(0, 32, 8):
+    print("  vmv.v.i v%d, %d" % (v, 0 if mem else 1))
+    if s['t'] == 'f':
+      print("  vfcvt.f.x.v v%d, v%d" % (v, v))
+  if s['t'] == 'f':
+    print("  vfmv.f.s ft0, v8")
+  if s['form'] in ('ldx', 'stx'):
+    print("  vsetvli t0, zero, e%d, m%d, ta, ma" % (sew, size))
+    print("  vid.v %s" % reg(g, size))
+    print("  vsll.vi %s, %s, %d" % (reg(g, size), reg(g, size),
+                                    (sew // 8).bit_length() - 1))
+  print("  li t1, 1")
+  print("  li t2, %d" % (2 * sew // 8))
+
+def emit_bench(label, s, sew, lmul, latency):
+  op = s['op'].format(sew=sew, lmul=lmul)
+  form = FORMS[s['form']]
+  size, pool = groups(s, lmul)
+  # The constant source, or the index of the indexed stores
+  src = pool[0]
+  idx = pool[1] if s['form'] == 'stx' else src
+  print("  .balign 4")
+  print("%s:" % label)
+  emit_init(s, sew, size, idx)
+  print("  vsetvli a0, a0, e%d, m%d, ta, ma" % (sew, lmul))
+  print("1:")
+  if latency:
+    x, y = pool[1], pool[2]
+    for u in range(UNROLL):
+      regs = dict(op=op, a=reg(x, size), b=reg(src, size), d=reg(y, size),
+                  i=reg(idx, size))
+      print("  " + form.format(**regs))
+      if s['form'] in BACK:
+        print("  " + BACK[s['form']].format(**regs))
+      x, y = y, x
+  else:
+    dst = [g for g in pool if g not in (src, idx)]
+    for u in range(UNROLL):
+      print("  " + form.format(op=op, a=reg(src, size), b=reg(src, size),
+                               d=reg(dst[u % len(dst)], size),
+                               i=reg(idx, size)))
+  print("  addi a1, a1, -1")
+  print("  bnez a1, 1b")
+  print("  ret")
+
+############
+## SCRIPT ##
+############
+
+if len(sys.argv) < 3:
+  print("Error. Give me at least two arguments: the SEWs and the LMULs.")
+  sys.exit()
+
+sews = [int(x) for x in sys.argv[1].split(',')]
+lmuls = [int(x) for x in sys.argv[2].split(',')]
+classes = sys.argv[3].split(',') if len(sys.argv) > 3 else ['all']
+for sew in sews:
+  if sew not in (8, 16, 32, 64):
+    print("Error. SEW must be 8, 16, 32 or 64.")
+    sys.exit()
+for lmul in lmuls:
+  if lmul not in (1, 2, 4, 8):
+    print("Error. LMUL must be 1, 2, 4 or 8.")
+    sys.exit()
+
+benches = []
+print(".text")
+for n, s in enumerate(SPECS):
+  if 'all' not in classes and s['cls'] not in classes:
+    continue
+  for sew in sews:
+    for lmul in lmuls:
+      if not legal(s, sew, lmul):
+        continue
+      label = "rvv_perf_%d_%d_%d" % (n, sew, lmul)
+      emit_bench(label + "_t", s, sew, lmul, False)
+      lat = s['form'] not in NO_LATENCY
+      if lat:
+        emit_bench(label + "_l", s, sew, lmul, True)
+      benches.append((label, s, sew, lmul, lat))
+
+print(".section .rodata")
+for n, s in enumerate(SPECS):
+  print("rvv_perf_cls_%d: .asciz \"%s\"" % (n, s['cls']))
+for label, s, sew, lmul, lat in benches:
+  print("%s_op: .asciz \"%s\"" % (label, s['op'].format(sew=sew, lmul=lmul)))
+
+# struct rvv_perf_t, see main.c
+print(".section .data,\"aw\",@progbits")
+print(".global rvv_perf_n_benches")
+print(".balign 8")
+print("rvv_perf_n_benches:")
+print("  .dword %d" % len(benches))
+print(".global rvv_perf_benches")
+print(".balign 8")
+print("rvv_perf_benches:")
+for label, s, sew, lmul, lat in benches:
+  n = SPECS.index(s)
+  print("  .dword rvv_perf_cls_%d, %s_op, %s_t, %s" %
+        (n, label, label, label + "_l" if lat else "0"))
+  print("  .word %d, %d" % (sew, lmul))
@@ -0,0 +1,139 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Scalar readback microbenchmark. Every iteration reads one scalar result
+// out of Ara (vmv.x.s, vfmv.f.s, vcpop.m, or vfirst.m) and accumulates it.
+// CVA6 issues in order, and the accumulation waits for the result: the
+// cycles per iteration are the round trip of the readback.
+//
+// Build the hardware with scalar_fast_path=1 to measure the round trip with
+// the low-latency scalar result path, which is off by default.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+#ifndef ITER
+#define ITER 64
+#endif
+
+// Elements of the masks of vcpop and vfirst
+#ifndef AVL
+#define AVL (8 * NR_LANES)
+#endif
+
+typedef enum { VMV_X_S, VFMV_F_S, VCPOP, VFIRST, N_CASES } readback_e;
+
+static const char *names[N_CASES] = {"vmv.x.s", "vfmv.f.s", "vcpop.m",
+                                     "vfirst.m"};
+
+// Run one case, and return the sum of the results
+static int64_t run_case(readback_e c) {
+  int64_t sum = 0, x;
+  double fsum = 0, f;
+
+  for (size_t i = 0; i < ITER; ++i) {
+    switch (c) {
+    case VMV_X_S:
+      asm volatile("vmv.x.s %0, v8" : "=r"(x));
+      sum += x;
+      break;
+    case VFMV_F_S:
+      asm volatile("vfmv.f.s %0, v16" : "=f"(f));
+      fsum += f;
+      break;
+    case VCPOP:
+      asm volatile("vcpop.m %0, v4" : "=r"(x));
+      sum += x;
+      break;
+    case VFIRST:
+      asm volatile("vfirst.m %0, v5" : "=r"(x));
+      sum += x;
+      break;
+    default:
+      break;
+    }
+  }
+  return c == VFMV_F_S ? (int64_t)fsum : sum;
+}
+
+int main() {
+  printf("\n");
+  printf("=====================\n");
+  printf("=  SCALAR READBACK  =\n");
+  printf("=====================\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+  int64_t runtime, sum, ref[N_CASES];
+  size_t vl;
+
+  // v8 and v16 hold the moved elements
+  asm volatile("vsetvli %0, %1, e64, m1, ta, ma" : "=r"(vl) : "r"(1));
+  asm volatile("vmv.v.x v8, %0" ::"r"(5));
+  asm volatile("vfmv.v.f v16, %0" ::"f"(2.0));
+
+  // v4 has the first vl/2 bits set, v5 the bits from vl/2 on
+  asm volatile("vsetvli %0, %1, e32, m1, ta, ma" : "=r"(vl) : "r"(AVL));
+  const size_t half = vl / 2;
+  asm volatile("vid.v v24");
+  asm volatile("vmsltu.vx v4, v24, %0" ::"r"(half));
+  asm volatile("vmsgtu.vx v5, v24, %0" ::"r"(half - 1));
+
+  ref[VMV_X_S] = 5 * ITER;
+  ref[VFMV_F_S] = 2 * ITER;
+  ref[VCPOP] = half * ITER;
+  ref[VFIRST] = half * ITER;
+
+  printf("%d iterations, vl = %d for vcpop.m and vfirst.m\n", ITER, vl);
+  printf("case            cycles  cycles/iter\n");
+
+  for (int c = 0; c < N_CASES; ++c) {
+    // Warm the instruction cache
+    run_case(c);
+
+    HW_CNT_READY;
+    start_timer();
+    sum = run_case(c);
+    stop_timer();
+    HW_CNT_NOT_READY;
+    runtime = get_timer();
+
+    printf("%-10s  %10d  %11d\n", names[c], runtime, runtime / ITER);
+
+    if (sum != ref[c]) {
+      printf("Error: %s, sum %d instead of %d\n", names[c], sum, ref[c]);
+      error++;
+    }
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
@@ -21,7 +21,7 @@
 
 #include "riscv_vector.h"
 
-#include "../softmax/lib/exp.h"
+#include "vmath/vmath.h"
 
 // Our fdiv cannot receive any X in input
 // The following macro is just a trick and should NOT be used
@@ -176,7 +176,7 @@ void softmax_vec(const float *i, const float *o, uint64_t channels,
       // Subtract the maximum
       buf_chunk_v = __riscv_vfsub_vv_f32m1(buf_chunk_v, max_chunk_v, vl);
       // Exponentiate
-      buf_chunk_v = __exp_2xf32(buf_chunk_v, vl);
+      buf_chunk_v = vmath_exp_fast_f32m1(buf_chunk_v, vl);
       // Store the numerator to memory
       __riscv_vse32_v_f32m1(__o, buf_chunk_v, vl);
       // Accumulate
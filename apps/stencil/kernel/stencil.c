@@ -0,0 +1,321 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Time skewing of a pass with T levels: at step i, the input row i enters
+// level 0, and level t computes its row j = i - t from the window of level
+// t - 1, which holds rows (j - 1, j, j + 1). Boundary rows are passed
+// through: row 0 is the middle row of the window, and row r - 1 is the last
+// one (level t - 1 has no row r to push). Level T stores its interior rows.
+//
+// The number of levels must be known at compile time to keep the windows in
+// registers, so a pass is instantiated for each T.
+
+#include "riscv_vector.h"
+
+#include "stencil.h"
+
+static inline size_t min(size_t a, size_t b) { return a < b ? a : b; }
+
+// Rotate the window of level l and push v as its newest row
+#define PUSH(l, v)                                                             \
+  do {                                                                         \
+    a##l = b##l;                                                               \
+    b##l = c##l;                                                               \
+    c##l = v;                                                                  \
+  } while (0)
+
+// Level t: compute row j = i - t from the window of level tp = t - 1
+#define LEVEL(t, tp, apply)                                                    \
+  if (i >= t && i - t < n) {                                                   \
+    const size_t j = i - t;                                                    \
+    if (j == 0)                                                                \
+      PUSH(t, b##tp);                                                          \
+    else if (j == n - 1)                                                       \
+      PUSH(t, c##tp);                                                          \
+    else                                                                       \
+      PUSH(t, apply(&w, a##tp, b##tp, c##tp, interior, vl));                   \
+  }
+
+// Last level: compute and store the interior row j = i - t
+#define LEVEL_OUT(t, tp, apply, store)                                         \
+  if (i >= t + 1 && i - t < n - 1) {                                           \
+    const size_t j = i - t;                                                    \
+    store(j, apply(&w, a##tp, b##tp, c##tp, interior, vl));                    \
+  }
+
+////////////////
+// 2D stencil //
+////////////////
+
+#define WINDOW2D(l)                                                            \
+  vfloat64m2_t a##l = zero, b##l = zero, c##l = zero;
+
+// Row of level t + 1 from rows (up, mid, down) of level t. The columns are
+// combined first, so that only two slides are needed per row.
+static inline vfloat64m2_t stencil2d_apply(const stencil2d_t *w,
+                                           vfloat64m2_t up, vfloat64m2_t mid,
+                                           vfloat64m2_t down,
+                                           vbool32_t interior, size_t vl) {
+  vfloat64m2_t ctr, left, right;
+  ctr = __riscv_vfmul_vf_f64m2(up, w->w[0][1], vl);
+  ctr = __riscv_vfmacc_vf_f64m2(ctr, w->w[1][1], mid, vl);
+  ctr = __riscv_vfmacc_vf_f64m2(ctr, w->w[2][1], down, vl);
+  left = __riscv_vfmul_vf_f64m2(mid, w->w[1][0], vl);
+  right = __riscv_vfmul_vf_f64m2(mid, w->w[1][2], vl);
+  if (w->points == 9) {
+    left = __riscv_vfmacc_vf_f64m2(left, w->w[0][0], up, vl);
+    left = __riscv_vfmacc_vf_f64m2(left, w->w[2][0], down, vl);
+    right = __riscv_vfmacc_vf_f64m2(right, w->w[0][2], up, vl);
+    right = __riscv_vfmacc_vf_f64m2(right, w->w[2][2], down, vl);
+  }
+  ctr = __riscv_vfadd_vv_f64m2(
+      ctr, __riscv_vfslide1up_vf_f64m2(left, 0.0, vl), vl);
+  ctr = __riscv_vfadd_vv_f64m2(
+      ctr, __riscv_vfslide1down_vf_f64m2(right, 0.0, vl), vl);
+  // The first and last columns of the grid are constant
+  return __riscv_vmerge_vvm_f64m2(mid, ctr, interior, vl);
+}
+
+// Store the output columns [o0, o1) of row j, at offset sh in the strip
+#define STORE2D(j, v)                                                          \
+  __riscv_vse64_v_f64m2(dst + (j) * c + o0,                                    \
+                        __riscv_vslidedown_vx_f64m2(v, sh, vl), o1 - o0)
+
+// The strip of columns [ls, le) produces the output columns [o0, o1), with
+// ls = o0 - T and le = o1 + T unless clipped by the grid boundary
+#define STENCIL2D_PASS(T, WINDOWS, LEVELS)                                     \
+  static void stencil2d_pass_##T(const stencil2d_t *st, size_t r, size_t c,    \
+                                 const double *src, double *dst) {             \
+    const stencil2d_t w = *st;                                                 \
+    const size_t n = r;                                                        \
+    const size_t width = __riscv_vsetvlmax_e64m2() - 2 * T;                    \
+                                                                               \
+    for (size_t o0 = 1; o0 < c - 1; o0 += width) {                             \
+      const size_t o1 = min(c - 1, o0 + width);                                \
+      const size_t ls = o0 >= T ? o0 - T : 0;                                  \
+      const size_t le = min(c, o1 + T);                                        \
+      const size_t sh = o0 - ls;                                               \
+      const size_t vl = __riscv_vsetvl_e64m2(le - ls);                         \
+                                                                               \
+      vuint64m2_t col =                                                        \
+          __riscv_vadd_vx_u64m2(__riscv_vid_v_u64m2(vl), ls, vl);             \
+      vbool32_t interior =                                                     \
+          __riscv_vmand_mm_b32(__riscv_vmsgeu_vx_u64m2_b32(col, 1, vl),        \
+                               __riscv_vmsleu_vx_u64m2_b32(col, c - 2, vl),    \
+                               vl);                                            \
+      vfloat64m2_t zero = __riscv_vfmv_v_f_f64m2(0.0, vl);                     \
+      WINDOWS                                                                  \
+                                                                               \
+      for (size_t i = 0; i < r + T; ++i) {                                     \
+        if (i < r)                                                             \
+          PUSH(0, __riscv_vle64_v_f64m2(src + i * c + ls, vl));                \
+        LEVELS                                                                 \
+      }                                                                        \
+    }                                                                          \
+  }
+
+STENCIL2D_PASS(1, WINDOW2D(0), LEVEL_OUT(1, 0, stencil2d_apply, STORE2D))
+STENCIL2D_PASS(2, WINDOW2D(0) WINDOW2D(1),
+               LEVEL(1, 0, stencil2d_apply)
+                   LEVEL_OUT(2, 1, stencil2d_apply, STORE2D))
+STENCIL2D_PASS(3, WINDOW2D(0) WINDOW2D(1) WINDOW2D(2),
+               LEVEL(1, 0, stencil2d_apply) LEVEL(2, 1, stencil2d_apply)
+                   LEVEL_OUT(3, 2, stencil2d_apply, STORE2D))
+STENCIL2D_PASS(4, WINDOW2D(0) WINDOW2D(1) WINDOW2D(2) WINDOW2D(3),
+               LEVEL(1, 0, stencil2d_apply) LEVEL(2, 1, stencil2d_apply)
+                   LEVEL(3, 2, stencil2d_apply)
+                       LEVEL_OUT(4, 3, stencil2d_apply, STORE2D))
+
+double *stencil2d(const stencil2d_t *st, size_t r, size_t c, double *a,
+                  double *b, size_t steps, size_t tblock) {
+  if (r < 3 || c < 3 || (st->points != 5 && st->points != 9) || !tblock)
+    return NULL;
+  tblock = min(tblock, STENCIL2D_MAX_TBLOCK);
+
+  while (steps) {
+    const size_t t = min(tblock, steps);
+    switch (t) {
+    case 1:
+      stencil2d_pass_1(st, r, c, a, b);
+      break;
+    case 2:
+      stencil2d_pass_2(st, r, c, a, b);
+      break;
+    case 3:
+      stencil2d_pass_3(st, r, c, a, b);
+      break;
+    default:
+      stencil2d_pass_4(st, r, c, a, b);
+      break;
+    }
+    double *tmp = a;
+    a = b;
+    b = tmp;
+    steps -= t;
+  }
+
+  return a;
+}
+
+////////////////
+// 3D stencil //
+////////////////
+
+// The tile is wy rows of wx points, flattened in one vector. Its neighbors
+// along x and y are one and wx elements away.
+
+typedef struct {
+  stencil3d_t st;
+  size_t tile_wx;
+} stencil3d_tile_t;
+
+#define WINDOW3D(l)                                                            \
+  vfloat64m2_t a##l = zero, b##l = zero, c##l = zero;
+
+static inline vfloat64m2_t stencil3d_apply(const stencil3d_tile_t *w,
+                                           vfloat64m2_t below,
+                                           vfloat64m2_t mid,
+                                           vfloat64m2_t above,
+                                           vbool32_t interior, size_t vl) {
+  const size_t wx = w->tile_wx;
+  vfloat64m2_t acc;
+  acc = __riscv_vfmul_vf_f64m2(mid, w->st.center, vl);
+  acc = __riscv_vfmacc_vf_f64m2(acc, w->st.z[0], below, vl);
+  acc = __riscv_vfmacc_vf_f64m2(acc, w->st.z[1], above, vl);
+  acc = __riscv_vfmacc_vf_f64m2(
+      acc, w->st.x[0], __riscv_vslideup_vx_f64m2(mid, mid, 1, vl), vl);
+  acc = __riscv_vfmacc_vf_f64m2(
+      acc, w->st.x[1], __riscv_vslidedown_vx_f64m2(mid, 1, vl), vl);
+  acc = __riscv_vfmacc_vf_f64m2(
+      acc, w->st.y[0], __riscv_vslideup_vx_f64m2(mid, mid, wx, vl), vl);
+  acc = __riscv_vfmacc_vf_f64m2(
+      acc, w->st.y[1], __riscv_vslidedown_vx_f64m2(mid, wx, vl), vl);
+  // The boundary of the plane is constant
+  return __riscv_vmerge_vvm_f64m2(mid, acc, interior, vl);
+}
+
+// Load plane z of the tile, and store the owned points of plane j. Tiles
+// spanning whole rows are contiguous in memory.
+#define LOAD3D(z)                                                              \
+  (contig ? __riscv_vle64_v_f64m2(src + (z) * plane + base, vl)                \
+          : __riscv_vluxei64_v_f64m2(src + (z) * plane + base, offs, vl))
+#define STORE3D(j, v)                                                          \
+  do {                                                                         \
+    if (contig)                                                                \
+      __riscv_vse64_v_f64m2_m(own, dst + (j) * plane + base, v, vl);           \
+    else                                                                       \
+      __riscv_vsuxei64_v_f64m2_m(own, dst + (j) * plane + base, offs, v, vl);  \
+  } while (0)
+
+// Mask of the tile points whose coordinate k (kx or ky) is in [lo, hi]
+#define RANGE3D(k, lo, hi)                                                     \
+  __riscv_vmand_mm_b32(__riscv_vmsgeu_vx_u64m2_b32(k, lo, vl),                 \
+                       __riscv_vmsleu_vx_u64m2_b32(k, hi, vl), vl)
+
+// Tile origin along one axis: T points before the first owned one, moved
+// back if the tile would cross the end of the grid
+static inline size_t stencil3d_origin(size_t o0, size_t t, size_t w,
+                                      size_t n) {
+  size_t ls = o0 >= t ? o0 - t : 0;
+  return ls + w > n ? n - w : ls;
+}
+
+#define STENCIL3D_PASS(T, WINDOWS, LEVELS)                                     \
+  static void stencil3d_pass_##T(const stencil3d_t *st, size_t nz, size_t ny,  \
+                                 size_t nx, size_t wy, size_t wx,              \
+                                 const double *src, double *dst) {             \
+    const stencil3d_tile_t w = {*st, wx};                                      \
+    const size_t n = nz;                                                       \
+    const size_t plane = ny * nx;                                              \
+    const int contig = wx == nx;                                               \
+    const size_t step_x = contig ? nx : wx - 2 * T;                            \
+    const size_t step_y = wy == ny ? ny : wy - 2 * T;                          \
+    const size_t vl = __riscv_vsetvl_e64m2(wy * wx);                           \
+                                                                               \
+    /* Tile coordinates and byte offsets of the tile points */                 \
+    vuint64m2_t k = __riscv_vid_v_u64m2(vl);                                   \
+    vuint64m2_t kx = __riscv_vremu_vx_u64m2(k, wx, vl);                        \
+    vuint64m2_t ky = __riscv_vdivu_vx_u64m2(k, wx, vl);                        \
+    vuint64m2_t offs = __riscv_vsll_vx_u64m2(                                  \
+        __riscv_vmacc_vx_u64m2(kx, nx, ky, vl), 3, vl);                        \
+                                                                               \
+    for (size_t oy0 = 1; oy0 < ny - 1; oy0 += step_y) {                        \
+      const size_t oy1 = min(ny - 1, oy0 + step_y);                            \
+      const size_t lsy = stencil3d_origin(oy0, T, wy, ny);                     \
+      for (size_t ox0 = 1; ox0 < nx - 1; ox0 += step_x) {                      \
+        const size_t ox1 = min(nx - 1, ox0 + step_x);                          \
+        const size_t lsx = stencil3d_origin(ox0, T, wx, nx);                   \
+        const size_t base = lsy * nx + lsx;                                    \
+                                                                               \
+        /* Points inside the boundary of the plane, and owned points */        \
+        vbool32_t interior = __riscv_vmand_mm_b32(                             \
+            RANGE3D(kx, lsx ? 0 : 1, nx - 2 - lsx),                            \
+            RANGE3D(ky, lsy ? 0 : 1, ny - 2 - lsy), vl);                       \
+        vbool32_t own = __riscv_vmand_mm_b32(                                  \
+            RANGE3D(kx, ox0 - lsx, ox1 - 1 - lsx),                             \
+            RANGE3D(ky, oy0 - lsy, oy1 - 1 - lsy), vl);                        \
+        vfloat64m2_t zero = __riscv_vfmv_v_f_f64m2(0.0, vl);                   \
+        WINDOWS                                                                \
+                                                                               \
+        for (size_t i = 0; i < nz + T; ++i) {                                  \
+          if (i < nz)                                                          \
+            PUSH(0, LOAD3D(i));                                                \
+          LEVELS                                                               \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+  }
+
+STENCIL3D_PASS(1, WINDOW3D(0), LEVEL_OUT(1, 0, stencil3d_apply, STORE3D))
+STENCIL3D_PASS(2, WINDOW3D(0) WINDOW3D(1),
+               LEVEL(1, 0, stencil3d_apply)
+                   LEVEL_OUT(2, 1, stencil3d_apply, STORE3D))
+
+static size_t isqrt(size_t x) {
+  size_t r = 1;
+  while ((r + 1) * (r + 1) <= x)
+    r++;
+  return r;
+}
+
+double *stencil3d(const stencil3d_t *st, size_t nz, size_t ny, size_t nx,
+                  double *a, double *b, size_t steps, size_t tblock) {
+  if (nz < 3 || ny < 3 || nx < 3 || !tblock)
+    return NULL;
+  tblock = min(tblock, STENCIL3D_MAX_TBLOCK);
+
+  // Square-ish tile that fills one vector register group
+  const size_t vlmax = __riscv_vsetvlmax_e64m2();
+  const size_t wx = min(nx, isqrt(vlmax));
+  const size_t wy = min(ny, vlmax / wx);
+  // Tiles must own at least one point per axis after the overlap
+  if ((wx < nx && wx <= 2 * tblock) || (wy < ny && wy <= 2 * tblock))
+    return NULL;
+
+  while (steps) {
+    const size_t t = min(tblock, steps);
+    if (t == 1)
+      stencil3d_pass_1(st, nz, ny, nx, wy, wx, a, b);
+    else
+      stencil3d_pass_2(st, nz, ny, nx, wy, wx, a, b);
+    double *tmp = a;
+    a = b;
+    b = tmp;
+    steps -= t;
+  }
+
+  return a;
+}
@@ -0,0 +1,67 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Temporal-blocked stencil engine (double precision)
+//
+// A pass reads the grid once and advances it by tblock time steps. The grid
+// is streamed row by row (2D) or plane by plane (3D), and every intermediate
+// time level keeps a rotating window of its last three rows/planes in vector
+// registers: when level t-1 produces row j+1, level t can compute row j. Only
+// the last level is stored back.
+//
+// The vector of a 2D pass is a strip of columns, the vector of a 3D pass a
+// tile of (x, y) points of one plane. Strips and tiles overlap by tblock
+// points per side, since their edges are no longer valid after each level.
+//
+// The boundary of the grid (first/last row, column and plane) is constant: it
+// is never written, and must hold the same values in both buffers.
+
+#ifndef _STENCIL_H_
+#define _STENCIL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Max time steps fused in one pass
+#define STENCIL2D_MAX_TBLOCK 4
+#define STENCIL3D_MAX_TBLOCK 2
+
+// 2D stencil: w[dy + 1][dx + 1] multiplies the point at (y + dy, x + dx).
+// points is 5 (the corners of w are ignored) or 9.
+typedef struct {
+  int points;
+  double w[3][3];
+} stencil2d_t;
+
+// 3D 7-point stencil: center, and {-1, +1} neighbors along each axis
+typedef struct {
+  double center;
+  double x[2];
+  double y[2];
+  double z[2];
+} stencil3d_t;
+
+// Advance the r x c grid by steps time steps, fusing up to tblock of them per
+// pass. a holds the initial grid, and a and b are used as ping-pong buffers.
+// Return the buffer that holds the result, or NULL on invalid arguments.
+double *stencil2d(const stencil2d_t *st, size_t r, size_t c, double *a,
+                  double *b, size_t steps, size_t tblock);
+
+// Same, for a nz x ny x nx grid
+double *stencil3d(const stencil3d_t *st, size_t nz, size_t ny, size_t nx,
+                  double *a, double *b, size_t steps, size_t tblock);
+
+#endif
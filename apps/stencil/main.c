@@ -0,0 +1,138 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Temporal-blocked stencil benchmark. Run the 2D 5-point and 9-point and the
+// 3D 7-point stencils for every number of fused time steps, check the result
+// and print the point updates and FLOP per cycle.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel/stencil.h"
+#include "runtime.h"
+#include "util.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Threshold for FP numbers comparison during the final check
+#define THRESHOLD 0.000001
+
+extern uint64_t R, C, NZ, NY, NX, STEPS;
+extern double w5[], w9[], w7[];
+extern double grid2d[] __attribute__((aligned(4 * NR_LANES)));
+extern double gold2d_5[] __attribute__((aligned(4 * NR_LANES)));
+extern double gold2d_9[] __attribute__((aligned(4 * NR_LANES)));
+extern double grid3d[] __attribute__((aligned(4 * NR_LANES)));
+extern double gold3d_7[] __attribute__((aligned(4 * NR_LANES)));
+extern double buf_a[] __attribute__((aligned(4 * NR_LANES)));
+extern double buf_b[] __attribute__((aligned(4 * NR_LANES)));
+
+static int check(const double *res, const double *gold, size_t len) {
+  int err = 0;
+  for (size_t i = 0; i < len; ++i)
+    if (!similarity_check(res[i], gold[i], THRESHOLD)) {
+      if (!err)
+        printf("Error at index %d: %f != %f\n", i, res[i], gold[i]);
+      err++;
+    }
+  return err;
+}
+
+// FLOP per point update: one multiply per stencil point, plus the adds
+static void print_row(const char *name, size_t tblock, size_t points,
+                      uint64_t updates, int64_t runtime, int64_t base) {
+  float upc = (float)updates / runtime;
+  printf("%-10s  %d  %9d  %8f  %8f  %6f\n", name, tblock, runtime, upc,
+         upc * (2 * points - 1), (float)base / runtime);
+}
+
+int main() {
+  printf("\n");
+  printf("=============\n");
+  printf("=  STENCIL  =\n");
+  printf("=============\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+  int64_t runtime, base;
+  double *res;
+
+  stencil2d_t st5 = {5, {{0}}};
+  stencil2d_t st9 = {9, {{0}}};
+  memcpy(st5.w, w5, sizeof(st5.w));
+  memcpy(st9.w, w9, sizeof(st9.w));
+  stencil3d_t st7 = {w7[0], {w7[1], w7[2]}, {w7[3], w7[4]}, {w7[5], w7[6]}};
+
+  const size_t len2d = R * C;
+  const size_t len3d = NZ * NY * NX;
+  const uint64_t updates2d = STEPS * (R - 2) * (C - 2);
+  const uint64_t updates3d = STEPS * (NZ - 2) * (NY - 2) * (NX - 2);
+
+  printf("2D grid %dx%d, 3D grid %dx%dx%d, %d time steps.\n", R, C, NZ, NY, NX,
+         STEPS);
+  printf("stencil     T     cycles  upd/cycle  FLOP/cycle  speedup\n");
+
+  for (int s = 0; s < 2; ++s) {
+    const stencil2d_t *st = s ? &st9 : &st5;
+    const double *gold = s ? gold2d_9 : gold2d_5;
+    base = 0;
+    for (size_t t = 1; t <= STENCIL2D_MAX_TBLOCK; ++t) {
+      memcpy(buf_a, grid2d, len2d * sizeof(double));
+      memcpy(buf_b, grid2d, len2d * sizeof(double));
+      start_timer();
+      res = stencil2d(st, R, C, buf_a, buf_b, STEPS, t);
+      stop_timer();
+      runtime = get_timer();
+      if (!base)
+        base = runtime;
+      print_row(s ? "2d-9pt" : "2d-5pt", t, st->points, updates2d, runtime,
+                base);
+      error += res ? check(res, gold, len2d) : 1;
+    }
+  }
+
+  base = 0;
+  for (size_t t = 1; t <= STENCIL3D_MAX_TBLOCK; ++t) {
+    memcpy(buf_a, grid3d, len3d * sizeof(double));
+    memcpy(buf_b, grid3d, len3d * sizeof(double));
+    start_timer();
+    res = stencil3d(&st7, NZ, NY, NX, buf_a, buf_b, STEPS, t);
+    stop_timer();
+    runtime = get_timer();
+    if (!res) {
+      printf("3d-7pt: vector too short for T = %d, skipping.\n", t);
+      continue;
+    }
+    if (!base)
+      base = runtime;
+    print_row("3d-7pt", t, 7, updates3d, runtime, base);
+    error += check(res, gold3d_7, len3d);
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
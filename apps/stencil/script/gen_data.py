@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+# Copyright 2026 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# arg1, arg2: 2D grid rows and columns
+# arg3, arg4, arg5: 3D grid planes, rows and columns
+# arg6: time steps
+
+import numpy as np
+import sys
+
+def emit(name, array, alignment='8'):
+  print(".global %s" % name)
+  print(".balign " + alignment)
+  print("%s:" % name)
+  bs = array.tobytes()
+  for i in range(0, len(bs), 4):
+    s = ""
+    for n in range(4):
+      s += "%02x" % bs[i+3-n]
+    print("    .word 0x%s" % s)
+
+# Zero-initialized buffer
+def emit_space(name, size, alignment='8'):
+  print(".global %s" % name)
+  print(".balign " + alignment)
+  print("%s:" % name)
+  print("    .space %d" % size)
+
+# Reference 2D stencil: the boundary of the grid is constant
+def stencil2d(A, w, steps):
+  A = A.copy()
+  for _ in range(steps):
+    B = A.copy()
+    B[1:-1, 1:-1] = 0
+    for dy in range(3):
+      for dx in range(3):
+        B[1:-1, 1:-1] += w[dy, dx] * A[dy:A.shape[0]-2+dy, dx:A.shape[1]-2+dx]
+    A = B
+  return A
+
+# Reference 3D 7-point stencil: w = center, x-, x+, y-, y+, z-, z+
+def stencil3d(A, w, steps):
+  A = A.copy()
+  for _ in range(steps):
+    B = A.copy()
+    c = A[1:-1, 1:-1, 1:-1]
+    B[1:-1, 1:-1, 1:-1] = (w[0] * c +
+                           w[1] * A[1:-1, 1:-1, :-2] + w[2] * A[1:-1, 1:-1, 2:] +
+                           w[3] * A[1:-1, :-2, 1:-1] + w[4] * A[1:-1, 2:, 1:-1] +
+                           w[5] * A[:-2, 1:-1, 1:-1] + w[6] * A[2:, 1:-1, 1:-1])
+    A = B
+  return A
+
+############
+## SCRIPT ##
+############
+
+if len(sys.argv) == 7:
+  R, C, NZ, NY, NX, STEPS = [int(a) for a in sys.argv[1:]]
+else:
+  print("Error. Give me six arguments: R, C, NZ, NY, NX and the time steps.")
+  sys.exit()
+
+dtype = np.float64
+
+# Jacobi 5-point, 9-point box blur, and 7-point 3D Jacobi coefficients
+w5 = np.array([[0, 0.2, 0], [0.2, 0.2, 0.2], [0, 0.2, 0]], dtype=dtype)
+w9 = np.array([[1, 2, 1], [2, 4, 2], [1, 2, 1]], dtype=dtype) / 16
+w7 = np.array([0.4, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1], dtype=dtype)
+
+grid2d = np.random.rand(R, C).astype(dtype)
+grid3d = np.random.rand(NZ, NY, NX).astype(dtype)
+
+print(".section .data,\"aw\",@progbits")
+emit("R", np.array(R, dtype=np.uint64))
+emit("C", np.array(C, dtype=np.uint64))
+emit("NZ", np.array(NZ, dtype=np.uint64))
+emit("NY", np.array(NY, dtype=np.uint64))
+emit("NX", np.array(NX, dtype=np.uint64))
+emit("STEPS", np.array(STEPS, dtype=np.uint64))
+emit("w5", w5)
+emit("w9", w9)
+emit("w7", w7)
+emit("grid2d", grid2d, 'NR_LANES*4')
+emit("gold2d_5", stencil2d(grid2d, w5, STEPS), 'NR_LANES*4')
+emit("gold2d_9", stencil2d(grid2d, w9, STEPS), 'NR_LANES*4')
+emit("grid3d", grid3d, 'NR_LANES*4')
+emit("gold3d_7", stencil3d(grid3d, w7, STEPS), 'NR_LANES*4')
+emit_space("buf_a", 8 * max(R * C, NZ * NY * NX), 'NR_LANES*4')
+emit_space("buf_b", 8 * max(R * C, NZ * NY * NX), 'NR_LANES*4')
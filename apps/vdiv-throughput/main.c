@@ -0,0 +1,199 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Vector integer divider throughput. For every SEW, times vdivu, vdiv,
+// vremu, and vrem on AVL elements, followed by the store of the result, and
+// checks the result against a scalar reference.
+//
+// Build the hardware with a different nr_div_units (e.g., make -C hardware
+// verilate nr_div_units=4) to compare the throughput of the SIMD divider with
+// more serial dividers per lane.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Elements per instruction
+#ifndef AVL
+#define AVL (16 * NR_LANES)
+#endif
+
+typedef enum { VDIVU, VDIV, VREMU, VREM, N_OPS } div_op_e;
+
+static const char *names[N_OPS] = {"vdivu", "vdiv", "vremu", "vrem"};
+
+static uint64_t a[AVL] __attribute__((aligned(32 * NR_LANES)));
+static uint64_t b[AVL] __attribute__((aligned(32 * NR_LANES)));
+static uint64_t res[AVL] __attribute__((aligned(32 * NR_LANES)));
+
+// Vector length of the last run, at most AVL
+static size_t vl;
+
+// Element i of width sew of a buffer, zero-extended
+static uint64_t get_elem(const uint64_t *buf, size_t i, int sew) {
+  switch (sew) {
+  case 8:
+    return ((const uint8_t *)buf)[i];
+  case 16:
+    return ((const uint16_t *)buf)[i];
+  case 32:
+    return ((const uint32_t *)buf)[i];
+  default:
+    return buf[i];
+  }
+}
+
+static int64_t sext(uint64_t x, int sew) {
+  const int shift = 64 - sew;
+  return (int64_t)(x << shift) >> shift;
+}
+
+// Scalar reference, for non-zero divisors
+static uint64_t div_ref(div_op_e op, uint64_t x, uint64_t y, int sew) {
+  const uint64_t mask = sew == 64 ? ~0ull : (1ull << sew) - 1;
+  const int64_t sx = sext(x, sew), sy = sext(y, sew);
+  uint64_t r;
+
+  switch (op) {
+  case VDIVU:
+    r = x / y;
+    break;
+  case VREMU:
+    r = x % y;
+    break;
+  case VDIV:
+    // The overflow of INT_MIN / -1 wraps around
+    r = sy == -1 ? 0 - (uint64_t)sx : (uint64_t)(sx / sy);
+    break;
+  default:
+    r = sy == -1 ? 0 : (uint64_t)(sx % sy);
+    break;
+  }
+  return r & mask;
+}
+
+// Time one division over AVL elements of v8 and v16, into v24, and store it
+#define DIV_RUN(sew)                                                           \
+  static int64_t div_run_##sew(div_op_e op) {                                  \
+    asm volatile("vsetvli %0, %1, e" #sew ", m8, ta, ma"                       \
+                 : "=r"(vl)                                                    \
+                 : "r"(AVL));                                                  \
+    asm volatile("vle" #sew ".v v8, (%0)" ::"r"(a));                           \
+    asm volatile("vle" #sew ".v v16, (%0)" ::"r"(b));                          \
+    asm volatile("fence");                                                     \
+                                                                               \
+    HW_CNT_READY;                                                              \
+    start_timer();                                                             \
+    switch (op) {                                                              \
+    case VDIVU:                                                                \
+      asm volatile("vdivu.vv v24, v8, v16");                                   \
+      break;                                                                   \
+    case VDIV:                                                                 \
+      asm volatile("vdiv.vv v24, v8, v16");                                    \
+      break;                                                                   \
+    case VREMU:                                                                \
+      asm volatile("vremu.vv v24, v8, v16");                                   \
+      break;                                                                   \
+    default:                                                                   \
+      asm volatile("vrem.vv v24, v8, v16");                                    \
+      break;                                                                   \
+    }                                                                          \
+    asm volatile("vse" #sew ".v v24, (%0)" ::"r"(res));                        \
+    stop_timer();                                                              \
+    HW_CNT_NOT_READY;                                                          \
+    return get_timer();                                                        \
+  }
+
+DIV_RUN(8)
+DIV_RUN(16)
+DIV_RUN(32)
+DIV_RUN(64)
+
+int main() {
+  printf("\n");
+  printf("====================\n");
+  printf("=  VDIV THROUGHPUT  =\n");
+  printf("====================\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+  const int sews[4] = {8, 16, 32, 64};
+
+  // Dividends and odd, thus non-zero, divisors of any magnitude and sign
+  uint64_t seed = 0x2545F4914F6CDD1Dull;
+  for (size_t i = 0; i < AVL; ++i) {
+    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    a[i] = seed;
+    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    // Shift the divisors right to get quotients of any length
+    b[i] = (seed >> (seed & 0x3f)) | 0x0101010101010101ull;
+  }
+
+  printf("AVL = %d elements per instruction\n", AVL);
+  printf("sew  op         cycles  cycles/elem\n");
+
+  for (int s = 0; s < 4; ++s) {
+    const int sew = sews[s];
+    for (int op = 0; op < N_OPS; ++op) {
+      int64_t runtime;
+      switch (sew) {
+      case 8:
+        runtime = div_run_8(op);
+        break;
+      case 16:
+        runtime = div_run_16(op);
+        break;
+      case 32:
+        runtime = div_run_32(op);
+        break;
+      default:
+        runtime = div_run_64(op);
+        break;
+      }
+
+      printf("%3d  %-5s  %10d  %11d\n", sew, names[op], runtime,
+             runtime / vl);
+
+      for (size_t i = 0; i < vl; ++i) {
+        const uint64_t exp = div_ref(op, get_elem(a, i, sew),
+                                     get_elem(b, i, sew), sew);
+        if (get_elem(res, i, sew) != exp) {
+          printf("Error: e%d %s, element %d: %lx instead of %lx\n", sew,
+                 names[op], i, get_elem(res, i, sew), exp);
+          error++;
+          break;
+        }
+      }
+    }
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
@@ -0,0 +1,171 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Accuracy/performance table of the vector math library (common/vmath).
+// For each function, data type, accuracy tier and LMUL, print the
+// cycles/element and the max ULP error against a float64 reference.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+#include "util.h"
+#include "vmath/vmath.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+// Max ULP error accepted by the ULP-bounded tier
+#define MAX_ULP 4
+
+extern uint64_t N;
+
+#define DECLARE_DATA(fn)                                                       \
+  extern double fn##_in_f64[], fn##_gold_f64[];                                \
+  extern float fn##_in_f32[], fn##_gold_f32[];                                 \
+  extern _Float16 fn##_in_f16[], fn##_gold_f16[];
+
+DECLARE_DATA(exp)
+DECLARE_DATA(log)
+DECLARE_DATA(sin)
+DECLARE_DATA(cos)
+DECLARE_DATA(tanh)
+DECLARE_DATA(sigmoid)
+
+extern double results_f64[] __attribute__((aligned(4 * NR_LANES)));
+extern float results_f32[] __attribute__((aligned(4 * NR_LANES)));
+extern _Float16 results_f16[] __attribute__((aligned(4 * NR_LANES)));
+
+// Distance in ULPs, on the sign-magnitude to two's complement mapping of the
+// bit patterns
+static uint64_t ulp_f64(double a, double b) {
+  int64_t ia, ib;
+  if (a != a && b != b)
+    return 0;
+  memcpy(&ia, &a, sizeof(ia));
+  memcpy(&ib, &b, sizeof(ib));
+  ia = ia < 0 ? INT64_MIN - ia : ia;
+  ib = ib < 0 ? INT64_MIN - ib : ib;
+  return ia > ib ? ia - ib : ib - ia;
+}
+
+static uint64_t ulp_f32(float a, float b) {
+  int32_t ia, ib;
+  if (a != a && b != b)
+    return 0;
+  memcpy(&ia, &a, sizeof(ia));
+  memcpy(&ib, &b, sizeof(ib));
+  ia = ia < 0 ? INT32_MIN - ia : ia;
+  ib = ib < 0 ? INT32_MIN - ib : ib;
+  return ia > ib ? (int64_t)ia - ib : (int64_t)ib - ia;
+}
+
+static uint64_t ulp_f16(_Float16 a, _Float16 b) {
+  int16_t ia, ib;
+  if (a != a && b != b)
+    return 0;
+  memcpy(&ia, &a, sizeof(ia));
+  memcpy(&ib, &b, sizeof(ib));
+  int32_t ja = ia < 0 ? INT16_MIN - ia : ia;
+  int32_t jb = ib < 0 ? INT16_MIN - ib : ib;
+  return ja > jb ? ja - jb : jb - ja;
+}
+
+// One benchmark point: array function and its data
+#define BMARK_TYPE(T, sfx)                                                     \
+  typedef struct {                                                             \
+    const char *fn;                                                            \
+    const char *tier;                                                          \
+    int lmul;                                                                  \
+    void (*run)(const T *, T *, size_t);                                       \
+    const T *in;                                                               \
+    const T *gold;                                                             \
+  } bmark_##sfx##_t;
+BMARK_TYPE(double, f64)
+BMARK_TYPE(float, f32)
+BMARK_TYPE(_Float16, f16)
+
+#define ENTRY_LMUL(fn, sfx, lmul)                                              \
+  {#fn, "fast", lmul, vmath_##fn##_fast_array_##sfx##m##lmul,                 \
+   fn##_in_##sfx, fn##_gold_##sfx},                                            \
+      {#fn, "ulp", lmul, vmath_##fn##_array_##sfx##m##lmul, fn##_in_##sfx,     \
+       fn##_gold_##sfx},
+#define ENTRY(fn, sfx)                                                         \
+  ENTRY_LMUL(fn, sfx, 1)                                                       \
+  ENTRY_LMUL(fn, sfx, 2) ENTRY_LMUL(fn, sfx, 4) ENTRY_LMUL(fn, sfx, 8)
+#define TABLE(sfx)                                                             \
+  static const bmark_##sfx##_t bmarks_##sfx[] = {                              \
+      ENTRY(exp, sfx) ENTRY(log, sfx) ENTRY(sin, sfx) ENTRY(cos, sfx)          \
+          ENTRY(tanh, sfx) ENTRY(sigmoid, sfx)};
+
+TABLE(f64)
+TABLE(f32)
+TABLE(f16)
+
+// Run every point of a table, print its row and return the number of
+// ULP-bounded functions that exceed MAX_ULP
+#define RUN_TABLE(sfx)                                                         \
+  for (size_t b = 0; b < sizeof(bmarks_##sfx) / sizeof(bmarks_##sfx[0]);      \
+       ++b) {                                                                  \
+    const bmark_##sfx##_t *p = &bmarks_##sfx[b];                               \
+    start_timer();                                                             \
+    p->run(p->in, results_##sfx, N);                                           \
+    stop_timer();                                                              \
+    int64_t runtime = get_timer();                                             \
+    uint64_t max_ulp = 0;                                                      \
+    for (uint64_t i = 0; i < N; ++i) {                                         \
+      uint64_t u = ulp_##sfx(results_##sfx[i], p->gold[i]);                    \
+      max_ulp = u > max_ulp ? u : max_ulp;                                     \
+    }                                                                          \
+    int64_t cpe = (100 * runtime) / N;                                         \
+    printf("%-8s %s  %-4s  m%d  %5d.%02d  %10d\n", p->fn, #sfx, p->tier,      \
+           p->lmul, cpe / 100, cpe % 100, max_ulp);                            \
+    if (p->tier[0] == 'u' && max_ulp > MAX_ULP)                                \
+      error++;                                                                 \
+  }
+
+int main() {
+  printf("\n");
+  printf("===========\n");
+  printf("=  VMATH  =\n");
+  printf("===========\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+
+  printf("Running the vector math library on %d elements per point.\n", N);
+  printf("\n");
+  printf("function dtype tier lmul cycles/elem    max-ULP\n");
+
+  RUN_TABLE(f64)
+  RUN_TABLE(f32)
+  RUN_TABLE(f16)
+
+  if (!error)
+    printf("Test result: PASS. ULP-bounded functions within %d ULP.\n",
+           MAX_ULP);
+  else
+    printf("Test result: FAIL. %d ULP-bounded points above %d ULP.\n", error,
+           MAX_ULP);
+
+  return error;
+}
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+# Copyright 2026 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# arg1: number of elements per function and data type
+
+import numpy as np
+import sys
+
+def emit(name, array, alignment='8'):
+  print(".global %s" % name)
+  print(".balign " + alignment)
+  print("%s:" % name)
+  bs = array.tobytes()
+  for i in range(0, len(bs), 4):
+    s = ""
+    for n in range(4):
+      s += "%02x" % bs[i+3-n]
+    print("    .word 0x%s" % s)
+
+def sigmoid(x):
+  return 1 / (1 + np.exp(-x))
+
+# Input generators and reference functions, evaluated in float64
+funcs = {
+  'exp':     (lambda n, lim: np.random.uniform(-lim, lim, n),     np.exp),
+  'log':     (lambda n, lim: np.exp(np.random.uniform(-lim, lim, n)), np.log),
+  'sin':     (lambda n, lim: np.random.uniform(-lim, lim, n),     np.sin),
+  'cos':     (lambda n, lim: np.random.uniform(-lim, lim, n),     np.cos),
+  'tanh':    (lambda n, lim: np.random.uniform(-5, 5, n),         np.tanh),
+  'sigmoid': (lambda n, lim: np.random.uniform(-lim, lim, n),     sigmoid),
+}
+
+# Input range per data type, kept inside the representable output range
+dtypes = {
+  'f64': (np.float64, 20),
+  'f32': (np.float32, 20),
+  'f16': (np.float16, 8),
+}
+
+############
+## SCRIPT ##
+############
+
+if len(sys.argv) == 2:
+  N = int(sys.argv[1])
+else:
+  print("Error. Give me one argument: the number of vector elements.")
+  sys.exit()
+
+# Keep the f16 arrays word-aligned
+N += N % 2
+
+np.random.seed(42)
+
+print(".section .data,\"aw\",@progbits")
+emit("N", np.array(N, dtype=np.uint64))
+for dname, (dtype, lim) in dtypes.items():
+  for fname, (gen, ref) in funcs.items():
+    x = gen(N, lim).astype(dtype)
+    gold = ref(x.astype(np.float64)).astype(dtype)
+    emit("%s_in_%s" % (fname, dname), x, 'NR_LANES*4')
+    emit("%s_gold_%s" % (fname, dname), gold, 'NR_LANES*4')
+  emit("results_%s" % dname, np.zeros(N, dtype=dtype), 'NR_LANES*4')
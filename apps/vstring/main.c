@@ -0,0 +1,150 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// string.h microbenchmark. Time memcpy, memset, memcmp, strlen and strcmp of
+// the runtime for several sizes, check their results and print the bytes
+// processed per cycle. Build with RUNTIME_VSTRING=1 for the vector routines.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+
+#ifdef SPIKE
+#include <stdio.h>
+#elif defined ARA_LINUX
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+#define MAX_SIZE 16384
+
+// One extra byte for the string terminator, and an offset to test
+// misaligned buffers
+static uint8_t src[MAX_SIZE + 8] __attribute__((aligned(4 * NR_LANES)));
+static uint8_t dst[MAX_SIZE + 8] __attribute__((aligned(4 * NR_LANES)));
+
+static const size_t sizes[] = {8, 31, 64, 256, 1024, 4096, MAX_SIZE};
+#define N_SIZES (sizeof(sizes) / sizeof(sizes[0]))
+
+static void print_row(const char *name, size_t size, size_t offset,
+                      int64_t runtime) {
+  printf("%-7s  %6d  %6d  %9d  %8f\n", name, size, offset, runtime,
+         (float)size / runtime);
+}
+
+int main() {
+  printf("\n");
+  printf("=============\n");
+  printf("=  VSTRING  =\n");
+  printf("=============\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+  int64_t runtime;
+  volatile int res;
+  volatile size_t len;
+
+#ifdef RUNTIME_VSTRING
+  printf("Vector string routines.\n");
+#else
+  printf("Scalar string routines.\n");
+#endif
+  printf("routine    bytes  offset     cycles  B/cycle\n");
+
+  for (size_t o = 0; o < 2; ++o) {
+    // Aligned buffers, then source and destination misaligned differently
+    const size_t so = o ? 3 : 0;
+    const size_t dofs = o ? 5 : 0;
+    uint8_t *s = src + so;
+    uint8_t *d = dst + dofs;
+
+    for (size_t i = 0; i < N_SIZES; ++i) {
+      const size_t n = sizes[i];
+
+      for (size_t j = 0; j < n; ++j)
+        s[j] = (uint8_t)(j % 251 + 1);
+      s[n] = 0;
+
+      // memset
+      start_timer();
+      memset(d, 0xA5, n + 1);
+      stop_timer();
+      runtime = get_timer();
+      print_row("memset", n, so, runtime);
+      for (size_t j = 0; j <= n; ++j)
+        if (d[j] != 0xA5) {
+          printf("Error: memset, size %d, byte %d\n", n, j);
+          error++;
+          break;
+        }
+
+      // memcpy, with the terminator
+      start_timer();
+      memcpy(d, s, n + 1);
+      stop_timer();
+      runtime = get_timer();
+      print_row("memcpy", n, so, runtime);
+      for (size_t j = 0; j <= n; ++j)
+        if (d[j] != s[j]) {
+          printf("Error: memcpy, size %d, byte %d\n", n, j);
+          error++;
+          break;
+        }
+
+      // memcmp and strcmp of equal buffers, then differing in the last byte
+      start_timer();
+      res = memcmp(d, s, n);
+      stop_timer();
+      runtime = get_timer();
+      print_row("memcmp", n, so, runtime);
+      error += res != 0;
+
+      start_timer();
+      res = strcmp((const char *)d, (const char *)s);
+      stop_timer();
+      runtime = get_timer();
+      print_row("strcmp", n, so, runtime);
+      error += res != 0;
+
+      d[n - 1] = 0xFF;
+      if (memcmp(d, s, n) <= 0 || strcmp((char *)s, (char *)d) >= 0) {
+        printf("Error: memcmp/strcmp, size %d, last byte differs\n", n);
+        error++;
+      }
+
+      // strlen
+      start_timer();
+      len = strlen((const char *)s);
+      stop_timer();
+      runtime = get_timer();
+      print_row("strlen", n, so, runtime);
+      if (len != n) {
+        printf("Error: strlen, size %d: %d\n", n, len);
+        error++;
+      }
+    }
+  }
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+  else
+    printf("Test result: FAIL. %d errors found.\n", error);
+
+  return error;
+}
@@ -0,0 +1,28 @@
+# Copyright 2020 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Author: Samuel Riedel, ETH Zurich
+#         Matheus Cavalcante, ETH Zurich
+
+# Number of vector lanes
+nr_lanes ?= 32
+
+# Length of each vector register (in bits)
+# Constraints: VLEN > 128
+vlen ?= 32768
+
+# Lanes of a cluster of the slide unit's datapath (16 clusters)
+lanes_per_cluster ?= 2
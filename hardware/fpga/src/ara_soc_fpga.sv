@@ -593,7 +593,9 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     .dram_base_addr_o     (/* Unused */                ),
     .dram_end_addr_o      (/* Unused */                ),
     .exit_o               (exit_o                      ),
-    .event_trigger_o      (event_trigger)
+    .event_trigger_o      (event_trigger),
+    // No performance events on the FPGA flow
+    .perf_i               ('0                          )
   );
 
   axi_dw_converter #(
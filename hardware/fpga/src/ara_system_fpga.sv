@@ -213,13 +213,20 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
     .slv_resp_o   (ara_axi_resp      ),
     .mst_req_o    (ara_axi_req_inval ),
     .mst_resp_i   (ara_axi_resp_inval),
+    // No L1 tag shadow on FPGA: every written line is invalidated
+    .snoop_ar_i      ('0             ),
+    .snoop_ar_valid_i(1'b0           ),
+    .snoop_r_last_i  (1'b0           ),
+    .snoop_ar_stall_o(/* Unused */   ),
     .inval_addr_o (inval_addr        ),
     .inval_valid_o(inval_valid       ),
 `ifdef IDEAL_DISPATCHER
-    .inval_ready_i(1'b0              )
+    .inval_ready_i(1'b0              ),
 `else
-    .inval_ready_i(inval_ready       )
+    .inval_ready_i(inval_ready       ),
 `endif
+    .inval_skipped_o(/* Unused */    ),
+    .aw_stall_o     (/* Unused */    )
   );
 
   ara #(
@@ -256,7 +263,11 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
     .acc_req_i       (acc_req       ),
     .acc_resp_o      (acc_resp      ),
     .axi_req_o       (ara_axi_req   ),
-    .axi_resp_i      (ara_axi_resp  )
+    .axi_resp_i      (ara_axi_resp  ),
+    // No prefetcher on FPGA: nothing to snoop
+    .snoop_valid_i   ('0            ),
+    .snoop_addr_i    ('0            ),
+    .perf_o          (/* Unused */  )
   );
 
   axi_mux #(
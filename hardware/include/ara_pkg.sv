@@ -22,7 +22,7 @@ package ara_pkg;
   localparam int unsigned NrVInsn = 8;
 
   // Maximum number of lanes that Ara can support.
-  localparam int unsigned MaxNrLanes = 16;
+  localparam int unsigned MaxNrLanes = 32;
 
   // Ara Features.
 
@@ -45,16 +45,24 @@ package ara_pkg;
     FPExtSupportEnable  = 1'b1
   } fpext_support_e;
 
+  // Widening dot product (vfwdotp), on the DOTP unit of the FPU
+  typedef enum logic {
+    FDotpSupportDisable = 1'b0,
+    FDotpSupportEnable  = 1'b1
+  } fdotp_support_e;
+
   // The six bits correspond to {RVVD, RVVF, RVVH, RVVHA, RVVB, RVVBA}
   typedef enum logic [5:0] {
-    FPUSupportNone             = 6'b000000,
-    FPUSupportHalf             = 6'b001000,
-    FPUSupportSingle           = 6'b010000,
-    FPUSupportHalfSingle       = 6'b011000,
-    FPUSupportDouble           = 6'b100000,
-    FPUSupportSingleDouble     = 6'b110000,
-    FPUSupportHalfSingleDouble = 6'b111000,
-    FPUSupportAll              = 6'b111111
+    FPUSupportNone                   = 6'b000000,
+    FPUSupportHalf                   = 6'b001000,
+    FPUSupportSingle                 = 6'b010000,
+    FPUSupportHalfSingle             = 6'b011000,
+    FPUSupportDouble                 = 6'b100000,
+    FPUSupportSingleDouble           = 6'b110000,
+    FPUSupportHalfSingleDouble       = 6'b111000,
+    // BF16 is selected with vtype.altfmt, at SEW = 16
+    FPUSupportHalfBFloatSingleDouble = 6'b111100,
+    FPUSupportAll                    = 6'b111111
   } fpu_support_e;
 
   function automatic logic RVVD(fpu_support_e e);
@@ -95,7 +103,7 @@ package ara_pkg;
   localparam int unsigned LatFDivSqrt     = 'd3;
   localparam int unsigned LatFNonComp     = 'd1;
   localparam int unsigned LatFConv        = 'd2;
-  localparam int unsigned LatFDotp        = 'd0;
+  localparam int unsigned LatFDotp        = 'd3;
   // Define the maximum FPU latency
   localparam int unsigned LatFMax = LatFCompEW64;
 
@@ -144,7 +152,7 @@ package ara_pkg;
     VDIVU, VDIV, VREMU, VREM,
     // FPU
     VFADD, VFSUB, VFRSUB, VFMUL, VFDIV, VFRDIV, VFMACC, VFNMACC, VFMSAC, VFNMSAC, VFMADD, VFNMADD, VFMSUB,
-    VFNMSUB, VFSQRT, VFMIN, VFMAX, VFREC7, VFRSQRT7, VFCLASS, VFSGNJ, VFSGNJN, VFSGNJX, VFCVTXUF, VFCVTXF, VFCVTFXU, VFCVTFX,
+    VFNMSUB, VFSQRT, VFMIN, VFMAX, VFREC7, VFRSQRT7, VFCLASS, VFSGNJ, VFSGNJN, VFSGNJX, VFWDOTP, VFCVTXUF, VFCVTXF, VFCVTFXU, VFCVTFX,
     VFCVTRTZXUF, VFCVTRTZXF, VFNCVTRODFF, VFCVTFF,
     // Floating-point reductions
     VFREDUSUM, VFREDOSUM, VFREDMIN, VFREDMAX, VFWREDUSUM, VFWREDOSUM,
@@ -820,7 +828,18 @@ typedef struct packed {
             return idx[byte_idx[6:0]];
           end
         endcase
-      default: $error("Error. Supported number of lanes are 1, 2, 4, 8, 16.");
+      // Too large to tabulate. Element e goes to lane e % NrLanes, at the bit-reversed position
+      // e / NrLanes within the lane's 64-bit word.
+      32: begin
+        automatic int unsigned eb  = 1 << int'(ew);
+        automatic int unsigned e   = byte_idx[7:0] >> int'(ew);
+        automatic int unsigned k   = e / NrLanes;
+        automatic int unsigned pos = 0;
+        for (int unsigned i = 0; i < 3 - int'(ew); i++)
+          pos |= ((k >> i) & 1) << (2 - int'(ew) - i);
+        return 8 * (e % NrLanes) + pos * eb + (byte_idx[7:0] & (eb - 1));
+      end
+      default: $error("Error. Supported number of lanes are 1, 2, 4, 8, 16, 32.");
     endcase
 
   /*automatic logic [$clog2(ELENB*NrLanes)-1:0] [8*MaxNrLanes-1:0] element_shuffle_index;
@@ -881,6 +900,12 @@ typedef struct packed {
           index[shuffle_index(b, NrLanes, ew)] = b;
         return index[byte_index[6:0]];
       end
+      32: begin
+        automatic logic [$clog2(256)-1:0] index [255:0];
+        for (int b = 0; b < 256; b++)
+          index[shuffle_index(b, NrLanes, ew)] = b;
+        return index[byte_index[7:0]];
+      end
       default: begin
         automatic logic [$clog2(32)-1:0] index [31:0];
         for (int b = 0; b < 32; b++)
@@ -1018,6 +1043,72 @@ typedef struct packed {
     logic is_last_req;
   } vrgat_req_t;
 
+  ////////////////////////////
+  //  Performance counters  //
+  ////////////////////////////
+
+  // Events raised by Ara every cycle, and accumulated by the performance counters in the
+  // control registers. The lane events are summed over the lanes. Nothing in Ara depends on them.
+  typedef struct packed {
+    // The sequencer issues an instruction, and issues one past an older, parked instruction
+    logic ooo_issue;
+    logic vinsn_issue;
+    // Raised by the banked L2 of ara_soc: requests served by the banks, and requests waiting for
+    // a bank served to another requester
+    logic [15:0] l2_conflict;
+    logic [15:0] l2_access;
+    // Load beats answered by the stream prefetcher of the VLSU, or by the memory
+    logic pf_miss;
+    logic pf_hit;
+    // The dispatcher decodes a vsetvl, or waits for the backend to drain after one
+    logic vsetvl;
+    // Raised by the L1 invalidation filter of ara_system: Ara's AW waits for the filter, lines
+    // written by Ara but absent from the L1, and invalidations accepted by the L1
+    logic inval_aw_stall;
+    logic [15:0] inval_skipped;
+    logic inval_req;
+    // Bytes transferred on Ara's AXI R and W channels
+    logic [15:0] axi_w_bytes;
+    logic [15:0] axi_r_bytes;
+    // VRF banks requested by more than one master
+    logic [15:0] vrf_bank_conflict;
+    // Operand requesters with a pending request waiting for a full operand queue
+    logic [15:0] opqueue_stall;
+    // The dispatcher injected a reshuffle micro-operation
+    logic reshuffle;
+    // The sequencer waits for the operand requesters to accept the last request
+    logic opreq_stall;
+    // The sequencer holds an instruction back because of a hazard
+    logic hazard_stall;
+    // The sequencer holds an instruction back because the instruction queue of the VFU is full
+    logic [VFU_None-1:0] vfu_stall;
+    // The VFU has at least one instruction in flight
+    logic [VFU_None-1:0] vfu_busy;
+  } ara_perf_t;
+
+  // Counters in the control registers, in the order of the memory map:
+  //  [0]     cycles
+  //  [1:6]   vfu_busy, in vfu_e order (ALU, MFPU, SLDU, MASKU, VLDU, VSTU)
+  //  [7:12]  vfu_stall, in vfu_e order
+  //  [13]    hazard_stall
+  //  [14]    opreq_stall
+  //  [15]    opqueue_stall
+  //  [16]    vrf_bank_conflict
+  //  [17]    axi_r_bytes
+  //  [18]    axi_w_bytes
+  //  [19]    reshuffle
+  //  [20]    inval_req
+  //  [21]    inval_skipped
+  //  [22]    inval_aw_stall
+  //  [23]    vsetvl
+  //  [24]    pf_hit
+  //  [25]    pf_miss
+  //  [26]    l2_access
+  //  [27]    l2_conflict
+  //  [28]    vinsn_issue
+  //  [29]    ooo_issue
+  localparam int unsigned NrPerfCounters = 30;
+
   ////////////////////////
   // VFREC7 & VFRSQRT7 //
   ///////////////////////
@@ -42,6 +42,8 @@ package rvv_pkg;
   // Vector type register
   typedef struct packed {
     logic vill;
+    // Alternative FP format: BF16 instead of FP16 at SEW = 16 (vtype[8], as in Zvfbfa)
+    logic altfmt;
     logic vma;
     logic vta;
     vew_e vsew;
@@ -15,10 +15,28 @@ module ara import ara_pkg::*; #(
     parameter  fpu_support_e          FPUSupport   = FPUSupportHalfSingleDouble,
     // External support for vfrec7, vfrsqrt7
     parameter  fpext_support_e        FPExtSupport = FPExtSupportEnable,
+    // Support for the widening dot product vfwdotp
+    parameter  fdotp_support_e        FDotpSupport = FDotpSupportEnable,
     // Support for fixed-point data types
     parameter  fixpt_support_e        FixPtSupport = FixedPointEnable,
     // Support for segment memory operations
     parameter  seg_support_e          SegSupport   = SegSupportEnable,
+    // Low-latency path for the scalar results of vmv.x.s, vfmv.f.s, vcpop, and vfirst. Adds
+    // combinational paths from the VRF and the mask unit to CVA6, hence off by default.
+    parameter  bit                    ScalarFastPath = 1'b0,
+    // Consumers of a load read each VRF word as soon as the load wrote it
+    parameter  bit                    LoadChaining = 1'b0,
+    // Issue the independent instructions past one waiting for a full VFU queue
+    parameter  bit                    OutOfOrderIssue = 1'b0,
+    // Lanes of a cluster of the slide unit's datapath, past 16 lanes
+    parameter  int           unsigned LanesPerCluster = 4,
+    // Blocks in the buffer of the VLSU's stream prefetcher. 0 disables the prefetcher.
+    parameter  int           unsigned PrefetchEntries = 0,
+    // Write ports of the memory snooped by the prefetcher, and the bits of their addresses
+    parameter  int           unsigned NrSnoopPorts = 1,
+    parameter  int           unsigned SnoopAddrWidth = 64,
+    // Serial dividers per lane, dividing elements in parallel
+    parameter  int           unsigned NrDivUnits   = 1,
     // CVA6 configuration
     parameter  config_pkg::cva6_cfg_t CVA6Cfg      = cva6_config_pkg::cva6_cfg,
     // CVA6-related parameters
@@ -59,7 +77,12 @@ module ara import ara_pkg::*; #(
     output acc_to_cva6_t      acc_resp_o,
     // AXI interface
     output axi_req_t          axi_req_o,
-    input  axi_resp_t         axi_resp_i
+    input  axi_resp_t         axi_resp_i,
+    // Writes that landed in the memory, to keep the prefetch buffer coherent
+    input  logic [NrSnoopPorts-1:0]                     snoop_valid_i,
+    input  logic [NrSnoopPorts-1:0][SnoopAddrWidth-1:0] snoop_addr_i,
+    // Performance events
+    output ara_perf_t         perf_o
   );
 
   `include "common_cells/registers.svh"
@@ -203,6 +226,7 @@ module ara import ara_pkg::*; #(
     .NrLanes           (NrLanes           ),
     .VLEN              (VLEN              ),
     .FPUSupport        (FPUSupport        ),
+    .FDotpSupport      (FDotpSupport      ),
     .SegSupport        (SegSupport        ),
     .ara_req_t         (ara_req_t         ),
     .ara_resp_t        (ara_resp_t        ),
@@ -233,7 +257,10 @@ module ara import ara_pkg::*; #(
     .core_st_pending_o (core_st_pending ),
     .load_complete_i   (load_complete   ),
     .store_complete_i  (store_complete  ),
-    .store_pending_i   (store_pending   )
+    .store_pending_i   (store_pending   ),
+    // Performance events
+    .perf_reshuffle_o  (perf_o.reshuffle),
+    .perf_vsetvl_o     (perf_o.vsetvl   )
   );
 
   /////////////////
@@ -279,7 +306,8 @@ module ara import ara_pkg::*; #(
     .ara_resp_t (ara_resp_t),
     .pe_req_t   (pe_req_t  ),
     .pe_resp_t  (pe_resp_t ),
-    .exception_t(exception_t)
+    .exception_t(exception_t),
+    .OutOfOrderIssue(OutOfOrderIssue)
   ) i_sequencer (
     .clk_i                 (clk_i                    ),
     .rst_ni                (rst_ni                   ),
@@ -309,7 +337,14 @@ module ara import ara_pkg::*; #(
     .addrgen_exception_i   (addrgen_exception        ),
     .addrgen_exception_vstart_i(addrgen_exception_vstart),
     .addrgen_fof_exception_i(addrgen_fof_exception),
-    .lsu_current_burst_exception_i(lsu_current_burst_exception)
+    .lsu_current_burst_exception_i(lsu_current_burst_exception),
+    // Performance events
+    .perf_vfu_busy_o       (perf_o.vfu_busy          ),
+    .perf_vfu_stall_o      (perf_o.vfu_stall         ),
+    .perf_hazard_stall_o   (perf_o.hazard_stall      ),
+    .perf_opreq_stall_o    (perf_o.opreq_stall       ),
+    .perf_vinsn_issue_o    (perf_o.vinsn_issue       ),
+    .perf_ooo_issue_o      (perf_o.ooo_issue         )
   );
 
   // Scalar move support
@@ -365,6 +400,9 @@ module ara import ara_pkg::*; #(
   logic      [NrLanes-1:0]                     masku_vrgat_req_valid;
   logic      [NrLanes-1:0]                     masku_vrgat_req_ready;
   vrgat_req_t                                  masku_vrgat_req;
+  // Performance events
+  logic      [NrLanes-1:0][NrVRFBanksPerLane-1:0] perf_bank_conflict;
+  logic      [NrLanes-1:0][NrOperandQueues-1:0]   perf_opqueue_stall;
 
   for (genvar lane = 0; lane < NrLanes; lane++) begin: gen_lanes
     lane #(
@@ -373,7 +411,11 @@ module ara import ara_pkg::*; #(
       .CVA6Cfg              (CVA6Cfg              ),
       .FPUSupport           (FPUSupport           ),
       .FPExtSupport         (FPExtSupport         ),
+      .FDotpSupport         (FDotpSupport         ),
       .FixPtSupport         (FixPtSupport         ),
+      .ScalarFastPath       (ScalarFastPath       ),
+      .LoadChaining         (LoadChaining         ),
+      .NrDivUnits           (NrDivUnits           ),
       .pe_req_t_bits        ($bits(pe_req_t)      ),
       .pe_resp_t_bits       ($bits(pe_resp_t)     )
     ) i_lane (
@@ -444,7 +486,9 @@ module ara import ara_pkg::*; #(
       .masku_vrgat_req_i               (masku_vrgat_req                     ),
       .mask_i                          (mask[lane]                          ),
       .mask_valid_i                    (mask_valid[lane] & mask_valid_lane  ),
-      .mask_ready_o                    (lane_mask_ready[lane]               )
+      .mask_ready_o                    (lane_mask_ready[lane]               ),
+      .perf_bank_conflict_o            (perf_bank_conflict[lane]            ),
+      .perf_opqueue_stall_o            (perf_opqueue_stall[lane]            )
     );
   end: gen_lanes
 
@@ -509,7 +553,10 @@ module ara import ara_pkg::*; #(
     .pe_req_t    (pe_req_t    ),
     .pe_resp_t   (pe_resp_t   ),
     .CVA6Cfg     (CVA6Cfg     ),
-    .exception_t (exception_t )
+    .exception_t (exception_t ),
+    .PrefetchEntries(PrefetchEntries),
+    .NrSnoopPorts(NrSnoopPorts),
+    .SnoopAddrWidth(SnoopAddrWidth)
   ) i_vlsu (
     .clk_i                      (clk_i                                                 ),
     .rst_ni                     (rst_ni                                                ),
@@ -518,6 +565,8 @@ module ara import ara_pkg::*; #(
     .axi_resp_i                 (axi_resp_i                                            ),
     // Interface with the dispatcher
     .core_st_pending_i          (core_st_pending                                       ),
+    .snoop_valid_i              (snoop_valid_i                                         ),
+    .snoop_addr_i               (snoop_addr_i                                          ),
     .load_complete_o            (load_complete                                         ),
     .store_complete_o           (store_complete                                        ),
     .store_pending_o            (store_pending                                         ),
@@ -535,6 +584,8 @@ module ara import ara_pkg::*; #(
     .addrgen_exception_vstart_o (addrgen_exception_vstart                              ),
     .addrgen_fof_exception_o    (addrgen_fof_exception                                 ),
     .lsu_current_burst_exception_o (lsu_current_burst_exception),
+    .perf_pf_hit_o              (perf_o.pf_hit                                         ),
+    .perf_pf_miss_o             (perf_o.pf_miss                                        ),
     // Interface with the Mask unit
     .mask_i                     (mask                                                  ),
     .mask_valid_i               (mask_valid                                            ),
@@ -579,11 +630,12 @@ module ara import ara_pkg::*; #(
   logic sldu_mask_ready;
 
   sldu #(
-    .NrLanes  (NrLanes  ),
-    .VLEN     (VLEN     ),
-    .vaddr_t  (vaddr_t  ),
-    .pe_req_t (pe_req_t ),
-    .pe_resp_t(pe_resp_t)
+    .NrLanes        (NrLanes        ),
+    .VLEN           (VLEN           ),
+    .LanesPerCluster(LanesPerCluster),
+    .vaddr_t        (vaddr_t        ),
+    .pe_req_t       (pe_req_t       ),
+    .pe_resp_t      (pe_resp_t      )
   ) i_sldu (
     .clk_i                   (clk_i                            ),
     .rst_ni                  (rst_ni                           ),
@@ -617,11 +669,12 @@ module ara import ara_pkg::*; #(
   /////////////////
 
   masku #(
-    .NrLanes  (NrLanes  ),
-    .VLEN     (VLEN     ),
-    .vaddr_t  (vaddr_t  ),
-    .pe_req_t (pe_req_t ),
-    .pe_resp_t(pe_resp_t)
+    .NrLanes       (NrLanes       ),
+    .VLEN          (VLEN          ),
+    .ScalarFastPath(ScalarFastPath),
+    .vaddr_t       (vaddr_t       ),
+    .pe_req_t      (pe_req_t      ),
+    .pe_resp_t     (pe_resp_t     )
   ) i_masku (
     .clk_i                   (clk_i                           ),
     .rst_ni                  (rst_ni                          ),
@@ -657,6 +710,55 @@ module ara import ara_pkg::*; #(
     .sldu_mask_ready_i       (sldu_mask_ready                 )
   );
 
+  ///////////////////////////
+  //  Performance events  //
+  ///////////////////////////
+
+  // The dispatcher and the sequencer drive their events directly. Here, sum the lane events
+  // over the lanes, and count the bytes crossing Ara's AXI data channels.
+
+  localparam int unsigned NrPerfLaneBanks  = NrLanes * NrVRFBanksPerLane;
+  localparam int unsigned NrPerfLaneQueues = NrLanes * NrOperandQueues;
+
+  logic [idx_width(NrPerfLaneBanks):0]  perf_bank_conflict_cnt;
+  logic [idx_width(NrPerfLaneQueues):0] perf_opqueue_stall_cnt;
+  logic [idx_width(AxiDataWidth/8):0]   perf_axi_w_strb_cnt;
+
+  popcount #(
+    .INPUT_WIDTH(NrPerfLaneBanks)
+  ) i_perf_bank_conflict_popcount (
+    .data_i    (perf_bank_conflict    ),
+    .popcount_o(perf_bank_conflict_cnt)
+  );
+
+  popcount #(
+    .INPUT_WIDTH(NrPerfLaneQueues)
+  ) i_perf_opqueue_stall_popcount (
+    .data_i    (perf_opqueue_stall    ),
+    .popcount_o(perf_opqueue_stall_cnt)
+  );
+
+  popcount #(
+    .INPUT_WIDTH(AxiDataWidth/8)
+  ) i_perf_axi_w_strb_popcount (
+    .data_i    (axi_req_o.w.strb   ),
+    .popcount_o(perf_axi_w_strb_cnt)
+  );
+
+  assign perf_o.vrf_bank_conflict = 16'(perf_bank_conflict_cnt);
+  assign perf_o.opqueue_stall     = 16'(perf_opqueue_stall_cnt);
+  // Every R beat carries a full bus word, and the W beats count their enabled bytes
+  assign perf_o.axi_r_bytes = (axi_resp_i.r_valid && axi_req_o.r_ready) ? 16'(AxiDataWidth/8) : '0;
+  assign perf_o.axi_w_bytes = (axi_req_o.w_valid && axi_resp_i.w_ready) ?
+                              16'(perf_axi_w_strb_cnt) : '0;
+  // Raised outside of Ara, by the invalidation filter of ara_system
+  assign perf_o.inval_req      = 1'b0;
+  assign perf_o.inval_skipped  = '0;
+  assign perf_o.inval_aw_stall = 1'b0;
+  // Raised outside of Ara, by the L2 of ara_soc
+  assign perf_o.l2_access      = '0;
+  assign perf_o.l2_conflict    = '0;
+
   //////////////////
   //  Assertions  //
   //////////////////
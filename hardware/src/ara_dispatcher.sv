@@ -22,6 +22,8 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
     parameter fpu_support_e          FPUSupport   = FPUSupportHalfSingleDouble,
     // External support for vfrec7, vfrsqrt7
     parameter fpext_support_e        FPExtSupport = FPExtSupportEnable,
+    // Support for the widening dot product vfwdotp
+    parameter fdotp_support_e        FDotpSupport = FDotpSupportEnable,
     // Support for fixed-point data types
     parameter fixpt_support_e        FixPtSupport = FixedPointEnable,
     // Support for segment memory operations
@@ -56,7 +58,10 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
     output logic                                 core_st_pending_o,
     input  logic                                 load_complete_i,
     input  logic                                 store_complete_i,
-    input  logic                                 store_pending_i
+    input  logic                                 store_pending_i,
+    // Performance events
+    output logic                                 perf_reshuffle_o,
+    output logic                                 perf_vsetvl_o
   );
 
   import cf_math_pkg::idx_width;
@@ -82,14 +87,15 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
   `FF(csr_vxrm_q, csr_vxrm_d, '0)
   // Converts between the internal representation of `vtype_t` and the full XLEN-bit CSR.
   function automatic xlen_t xlen_vtype(vtype_t vtype);
-    xlen_vtype = {vtype.vill, {CVA6Cfg.XLEN-9{1'b0}}, vtype.vma, vtype.vta, vtype.vsew,
-      vtype.vlmul[2:0]};
+    xlen_vtype = {vtype.vill, {CVA6Cfg.XLEN-10{1'b0}}, vtype.altfmt, vtype.vma, vtype.vta,
+      vtype.vsew, vtype.vlmul[2:0]};
   endfunction: xlen_vtype
 
   // Converts between the XLEN-bit vtype CSR and its internal representation
   function automatic vtype_t vtype_xlen(xlen_t xlen);
     vtype_xlen = '{
       vill  : xlen[CVA6Cfg.XLEN-1],
+      altfmt: xlen[8],
       vma   : xlen[7],
       vta   : xlen[6],
       vsew  : vew_e'(xlen[5:3]),
@@ -168,6 +174,19 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
   state_e state_d, state_q, state_qq;
   // state_qq is the previous state signal. Useful to know from which state we come from.
 
+  // A reshuffle uop is handed to the backend
+  assign perf_reshuffle_o = (state_q == RESHUFFLE) && ara_req_valid && ara_req_ready_i;
+
+  // Cycles lost to vsetvl: decoding one, or waiting for the backend to drain after a vtype
+  // change that needs it
+  logic is_vsetvl, vsetvl_wait_set;
+  logic vsetvl_wait_d, vsetvl_wait_q;
+
+  assign vsetvl_wait_d = vsetvl_wait_set || (vsetvl_wait_q && state_q == WAIT_IDLE);
+  assign perf_vsetvl_o = is_vsetvl || (vsetvl_wait_q && state_q == WAIT_IDLE);
+
+  `FF(vsetvl_wait_q, vsetvl_wait_d, 1'b0)
+
   // We need to memorize the element width used to store each vector on the lanes, so that we are
   // able to deshuffle it when needed.
   rvv_pkg::vew_e [31:0] eew_d, eew_q;
@@ -194,6 +213,15 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
   riscv::instruction_t instr;
   assign instr = riscv::instruction_t'(acc_req_i.insn);
 
+  // Configuration instructions only update the CSRs of the dispatcher, and do not need the
+  // backend: accept them even if the backend cannot take a new request, so that the
+  // vsetvli of a strip-mined loop does not wait for the previous vector instruction to issue.
+  rvv_instruction_t instr_rvv;
+  logic             instr_is_vsetvl;
+  assign instr_rvv       = rvv_instruction_t'(acc_req_i.insn);
+  assign instr_is_vsetvl = (instr.itype.opcode == riscv::OpcodeVec) &&
+                           (instr_rvv.varith_type.func3 == OPCFG);
+
   always_ff @(posedge clk_i or negedge rst_ni) begin
     if (!rst_ni) begin
       state_q              <= NORMAL_OPERATION;
@@ -453,6 +481,8 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
     ara_req_valid = 1'b0;
 
     is_config            = 1'b0;
+    is_vsetvl            = 1'b0;
+    vsetvl_wait_set      = 1'b0;
     ignore_zero_vl_check = 1'b0;
 
     // Saturation in any lane will raise vxsat flag
@@ -604,7 +634,7 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
     endcase
 
     if (state_d == NORMAL_OPERATION && state_q != RESHUFFLE) begin
-      if (acc_req_i.req_valid && ara_req_ready_i && acc_req_i.resp_ready) begin
+      if (acc_req_i.req_valid && (ara_req_ready_i || instr_is_vsetvl) && acc_req_i.resp_ready) begin
         // Decoding
         is_decoding = 1'b1;
         // Acknowledge the request
@@ -630,6 +660,7 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
                 // These can be acknowledged regardless of the state of Ara
                 // NOTE: unless there is a pending fault-only first vector load
                 is_config       = 1'b1;
+                is_vsetvl       = 1'b1;
 
                 // Update vtype
                 if (insn.vsetvli_type.func1 == 1'b0) begin // vsetvli
@@ -637,7 +668,7 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
                 end else if (insn.vsetivli_type.func2 == 2'b11) begin // vsetivli
                   csr_vtype_d = vtype_xlen(xlen_t'(insn.vsetivli_type.zimm10));
                 end else if (insn.vsetvl_type.func7 == 7'b100_0000) begin // vsetvl
-                  csr_vtype_d = vtype_xlen(xlen_t'(acc_req_i.rs2[7:0]));
+                  csr_vtype_d = vtype_xlen(xlen_t'(acc_req_i.rs2[8:0]));
                 end else
                   illegal_insn = 1'b1;
 
@@ -645,7 +676,9 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
                 if ((csr_vtype_d.vsew > rvv_pkg::vew_e'($clog2(ELENB))) || // SEW <= ELEN
                     (csr_vtype_d.vlmul == LMUL_RSVD) ||                    // reserved value
                     // LMUL >= SEW/ELEN
-                    (signed'($clog2(ELENB)) + signed'(csr_vtype_d.vlmul) < signed'(csr_vtype_d.vsew))) begin
+                    (signed'($clog2(ELENB)) + signed'(csr_vtype_d.vlmul) < signed'(csr_vtype_d.vsew)) ||
+                    // The alternative FP format is BF16, at SEW = 16 only
+                    (csr_vtype_d.altfmt && !(RVVHA(FPUSupport) && csr_vtype_d.vsew == EW16))) begin
                   csr_vtype_d = '{vill: 1'b1, vsew: EW8, vlmul: LMUL_1, default: '0};
                   csr_vl_d    = '0;
                 end
@@ -692,8 +725,10 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
                 // Checking only lmul_q is a trick: we want to stall only if both lmuls have
                 // zero MSB. If lmul_q has zero MSB, it's greater than lmul_d only if also
                 // lmul_d has zero MSB since the slice comparison is intrinsically unsigned
-                if (!csr_vtype_q.vlmul[2] && (csr_vtype_d.vlmul[2:0] < csr_vtype_q.vlmul[2:0]))
-                  state_d = WAIT_IDLE;
+                if (!csr_vtype_q.vlmul[2] && (csr_vtype_d.vlmul[2:0] < csr_vtype_q.vlmul[2:0])) begin
+                  state_d         = WAIT_IDLE;
+                  vsetvl_wait_set = 1'b1;
+                end
               end
 
               OPIVV: begin: opivv
@@ -2499,6 +2534,16 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
                       ara_req.eew_vs2        = csr_vtype_q.vsew.next();
                       ara_req.conversion_vs1 = OpQueueConversionWideFP2;
                     end
+                    6'b111001: begin // VFWDOTP (Ara-specific)
+                      ara_req.op        = ara_pkg::VFWDOTP;
+                      ara_req.use_vd_op = 1'b1;
+                      // The source elements are pairs of FP8 (SEW = 16) or FP16 (SEW = 32) values
+                      unique case (csr_vtype_q.vsew)
+                        EW16: if (!RVVB(FPUSupport)) illegal_insn = 1'b1;
+                        EW32: if (!RVVH(FPUSupport)) illegal_insn = 1'b1;
+                        default: illegal_insn = 1'b1;
+                      endcase
+                    end
                     6'b111000: begin // VFWMUL
                       ara_req.op             = ara_pkg::VFMUL;
                       ara_req.emul           = next_lmul(csr_vtype_q.vlmul);
@@ -2577,7 +2622,8 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
                   unique case (FPUSupport)
                     FPUSupportAll: if (int'(csr_vtype_q.vsew) > int'(EW64) || int'(ara_req.eew_vs2) > int'(EW64))
                           illegal_insn = 1'b1;
-                    FPUSupportHalfSingleDouble: if (int'(csr_vtype_q.vsew) < int'(EW16) ||
+                    FPUSupportHalfSingleDouble, FPUSupportHalfBFloatSingleDouble:
+                      if (int'(csr_vtype_q.vsew) < int'(EW16) ||
                           int'(csr_vtype_q.vsew) > int'(EW64) || int'(ara_req.eew_vs2) > int'(EW64))
                           illegal_insn = 1'b1;
                     FPUSupportHalfSingle: if (int'(csr_vtype_q.vsew) < int'(EW16) ||
@@ -2787,6 +2833,16 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
                       ara_req.eew_vs2        = csr_vtype_q.vsew.next();
                       ara_req.wide_fp_imm    = 1'b1;
                     end
+                    6'b111001: begin // VFWDOTP (Ara-specific)
+                      ara_req.op        = ara_pkg::VFWDOTP;
+                      ara_req.use_vd_op = 1'b1;
+                      // The source elements are pairs of FP8 (SEW = 16) or FP16 (SEW = 32) values
+                      unique case (csr_vtype_q.vsew)
+                        EW16: if (!RVVB(FPUSupport)) illegal_insn = 1'b1;
+                        EW32: if (!RVVH(FPUSupport)) illegal_insn = 1'b1;
+                        default: illegal_insn = 1'b1;
+                      endcase
+                    end
                     6'b111000: begin // VFWMUL
                       ara_req.op             = ara_pkg::VFMUL;
                       ara_req.emul           = next_lmul(csr_vtype_q.vlmul);
@@ -2835,7 +2891,9 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
 
                   // Check if the FP scalar operand is NaN-boxed. If not, replace it with a NaN.
                   case (csr_vtype_q.vsew)
-                    EW16: if (~(&acc_req_i.rs1[63:16])) ara_req.scalar_op = 64'h0000000000007e00;
+                    EW16: if (~(&acc_req_i.rs1[63:16])) ara_req.scalar_op = csr_vtype_q.altfmt
+                                                                            ? 64'h0000000000007fc0
+                                                                            : 64'h0000000000007e00;
                     EW32: if (~(&acc_req_i.rs1[63:32])) ara_req.scalar_op = 64'h000000007fc00000;
                   endcase
 
@@ -2863,7 +2921,8 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
                   // Ara cannot support instructions who operates on more than 64 bits.
                   unique case (FPUSupport)
                     FPUSupportAll: if (int'(csr_vtype_q.vsew) > int'(EW64)) illegal_insn = 1'b1;
-                    FPUSupportHalfSingleDouble: if (int'(csr_vtype_q.vsew) < int'(EW16) ||
+                    FPUSupportHalfSingleDouble, FPUSupportHalfBFloatSingleDouble:
+                      if (int'(csr_vtype_q.vsew) < int'(EW16) ||
                           int'(csr_vtype_q.vsew) > int'(EW64)) illegal_insn = 1'b1;
                     FPUSupportHalfSingle: if (int'(csr_vtype_q.vsew) < int'(EW16) ||
                           int'(csr_vtype_q.vsew) > int'(EW32)) illegal_insn = 1'b1;
@@ -3614,6 +3673,14 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
       if (ara_req_valid && (ara_req.op inside {VFREC7, VFRSQRT7}) && (FPExtSupport == FPExtSupportDisable))
         illegal_insn = 1'b1;
 
+      // vfrec7 and vfrsqrt7 have no BF16 tables
+      if (ara_req_valid && (ara_req.op inside {VFREC7, VFRSQRT7}) && csr_vtype_q.altfmt)
+        illegal_insn = 1'b1;
+
+      // Check that we have the dot-product unit for vfwdotp
+      if (ara_req_valid && (ara_req.op == VFWDOTP) && (FDotpSupport == FDotpSupportDisable))
+        illegal_insn = 1'b1;
+
       // Raise an illegal instruction exception
       if ( illegal_insn || illegal_insn_load || illegal_insn_store ) begin
         ara_req_valid            = 1'b0;
@@ -0,0 +1,69 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Free-running performance counters, accumulating the events raised by Ara.
+// The counters are never cleared: software takes a snapshot before and after
+// the region of interest and subtracts them. The events are registered once,
+// to keep Ara's internal paths away from the SoC periphery.
+
+module ara_perf_counters import ara_pkg::*; #(
+    parameter int unsigned CntWidth = 64
+  ) (
+    input  logic                                      clk_i,
+    input  logic                                      rst_ni,
+    // Events from Ara
+    input  ara_perf_t                                 perf_i,
+    // Counters, see NrPerfCounters in ara_pkg for the order
+    output logic      [NrPerfCounters-1:0][CntWidth-1:0] cnt_o
+  );
+
+  `include "common_cells/registers.svh"
+
+  ara_perf_t perf_q;
+  `FF(perf_q, perf_i, '0);
+
+  // Increment of each counter
+  logic [NrPerfCounters-1:0][15:0] inc;
+
+  always_comb begin : p_inc
+    inc = '0;
+
+    inc[0] = 16'd1;
+    for (int unsigned vfu = 0; vfu < VFU_None; vfu++) begin
+      inc[1 + vfu]            = 16'(perf_q.vfu_busy[vfu]);
+      inc[1 + VFU_None + vfu] = 16'(perf_q.vfu_stall[vfu]);
+    end
+    inc[13] = 16'(perf_q.hazard_stall);
+    inc[14] = 16'(perf_q.opreq_stall);
+    inc[15] = perf_q.opqueue_stall;
+    inc[16] = perf_q.vrf_bank_conflict;
+    inc[17] = perf_q.axi_r_bytes;
+    inc[18] = perf_q.axi_w_bytes;
+    inc[19] = 16'(perf_q.reshuffle);
+    inc[20] = 16'(perf_q.inval_req);
+    inc[21] = perf_q.inval_skipped;
+    inc[22] = 16'(perf_q.inval_aw_stall);
+    inc[23] = 16'(perf_q.vsetvl);
+    inc[24] = 16'(perf_q.pf_hit);
+    inc[25] = 16'(perf_q.pf_miss);
+    inc[26] = perf_q.l2_access;
+    inc[27] = perf_q.l2_conflict;
+    inc[28] = 16'(perf_q.vinsn_issue);
+    inc[29] = 16'(perf_q.ooo_issue);
+  end : p_inc
+
+  for (genvar c = 0; c < NrPerfCounters; c++) begin : gen_counters
+    logic [CntWidth-1:0] cnt_d, cnt_q;
+
+    assign cnt_d    = cnt_q + CntWidth'(inc[c]);
+    assign cnt_o[c] = cnt_q;
+
+    `FF(cnt_q, cnt_d, '0);
+  end : gen_counters
+
+  if (2 * VFU_None + 18 != NrPerfCounters)
+    $error("[ara_perf_counters] The counter map does not match the events in ara_perf_t.");
+
+endmodule : ara_perf_counters
@@ -6,6 +6,8 @@
 // Description:
 // Ara's sequencer controls the ordering and the dependencies between the
 // parallel vector instructions in execution.
+// With OutOfOrderIssue, an instruction waiting for the queue of its unit does
+// not hold back the younger, independent instructions for the other units.
 
 module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width; #(
     // RVV Parameters
@@ -16,6 +18,8 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
     parameter  type         pe_req_t    = logic,
     parameter  type         pe_resp_t   = logic,
     parameter  type         exception_t = logic,
+    // Issue the independent instructions past one waiting for a full VFU queue
+    parameter  bit          OutOfOrderIssue = 1'b0,
     // Dependant parameters. DO NOT CHANGE!
     // Ara has NrLanes + 3 processing elements: each one of the lanes, the vector load unit, the
     // vector store unit, the slide unit, and the mask unit.
@@ -51,7 +55,14 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
     input  vlen_t                           addrgen_exception_vstart_i,
     input  logic                            addrgen_fof_exception_i,
     // Interface with the store unit
-    input  logic                            lsu_current_burst_exception_i
+    input  logic                            lsu_current_burst_exception_i,
+    // Performance events
+    output logic             [VFU_None-1:0] perf_vfu_busy_o,
+    output logic             [VFU_None-1:0] perf_vfu_stall_o,
+    output logic                            perf_hazard_stall_o,
+    output logic                            perf_opreq_stall_o,
+    output logic                            perf_vinsn_issue_o,
+    output logic                            perf_ooo_issue_o
   );
 
   `include "common_cells/registers.svh"
@@ -74,8 +85,9 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
   // Transpose the matrix, as vertical slices are not allowed in System Verilog
   logic [NrVInsn-1:0][NrPEs-1:0] pe_vinsn_running_q_trns;
 
-  // Ara is idle if no instruction is currently running on it.
-  assign ara_idle_o = !(|vinsn_running_q);
+  // Ara is idle if no instruction is currently running on it, nor parked.
+  logic parked_valid_q;
+  assign ara_idle_o = !(|vinsn_running_q) && !parked_valid_q;
 
   lzc #(.WIDTH(NrVInsn)) i_next_id (
     .in_i   (~vinsn_running_q  ),
@@ -352,6 +364,92 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
   // Update the token only upon new instructions
   assign ara_req_token_d = (ara_req_valid_i) ? ara_req_i.token : ara_req_token_q;
 
+  //////////////////////////
+  //  Out-of-order issue  //
+  //////////////////////////
+
+  // With OutOfOrderIssue, an instruction that waits for the queue of one of its VFUs is parked,
+  // and acknowledged to the dispatcher. The younger instructions that target none of its VFUs and
+  // access none of the vector registers it writes, nor write the ones it reads, are then issued
+  // before it. The parked instruction is issued as soon as its VFUs have room, before any younger
+  // instruction. Only the instructions without a response to CVA6 are parked (no loads, stores,
+  // nor scalar results): they cannot raise an exception, and CVA6 commits them in order on their
+  // acknowledgment. The vstart of a faulting load or store stays precise.
+
+  ara_req_t          parked_req_d, parked_req_q;
+  logic              parked_valid_d;
+  logic [NrVFUs-1:0] parked_target_vfus_d, parked_target_vfus_q;
+  // The parked instruction can be issued
+  logic [NrVFUs-1:0] parked_queue_issue;
+  logic              parked_issue;
+  // The incoming instruction must wait for the parked one
+  logic              parked_conflict;
+  // Instruction issued this cycle: the parked one, or the incoming one
+  ara_req_t          issue_req;
+
+  // Vector registers of a group starting at vreg with the given EMUL. The group is doubled, to
+  // cover the wider operands of the widening and narrowing instructions.
+  function automatic logic [31:0] vreg_group(logic [4:0] vreg, rvv_pkg::vlmul_e emul);
+    automatic int unsigned nr_vregs = emul inside {LMUL_1, LMUL_2, LMUL_4, LMUL_8} ? 2 << emul : 2;
+    vreg_group = '0;
+    for (int unsigned v = 0; v < 32; v++)
+      vreg_group[v] = v >= vreg && v < vreg + nr_vregs;
+  endfunction : vreg_group
+
+  // Vector registers read by a request. Segment, whole-register, and indexed memory operations
+  // are assumed to access all of them.
+  function automatic logic [31:0] vregs_read(ara_req_t req);
+    vregs_read = '0;
+    if (req.use_vs1)   vregs_read |= vreg_group(req.vs1, req.emul);
+    if (req.use_vs2)   vregs_read |= vreg_group(req.vs2, req.emul);
+    if (req.use_vd_op) vregs_read |= vreg_group(req.vd, req.emul);
+    if (!req.vm)       vregs_read[VMASK] = 1'b1;
+    if ((is_load(req.op) || is_store(req.op)) && (req.nf != '0 || req.op inside {VLXE, VSXE}))
+      vregs_read = '1;
+  endfunction : vregs_read
+
+  // Vector registers written by a request
+  function automatic logic [31:0] vregs_written(ara_req_t req);
+    vregs_written = req.use_vd ? vreg_group(req.vd, req.emul) : '0;
+    if (is_load(req.op) && req.nf != '0)
+      vregs_written = '1;
+  endfunction : vregs_written
+
+  // Instructions that can be parked
+  function automatic logic parkable(ara_req_t req);
+    parkable = req.use_vd && !is_load(req.op) && !is_store(req.op) &&
+               vfu(req.op) inside {VFU_Alu, VFU_MFpu, VFU_SlideUnit, VFU_MaskUnit};
+  endfunction : parkable
+
+  if (OutOfOrderIssue) begin : gen_parking
+    for (genvar i = 0; i < NrVFUs; i++) begin : gen_parked_queue_issue
+      // The parked instruction and, if already registered, the incoming one are in the counter
+      logic younger;
+      assign younger = ara_req_valid_i && target_vfus_vec[i] && (ara_req_token_q == ara_req_i.token);
+      assign parked_queue_issue[i] = ~parked_target_vfus_q[i] |
+                                     (insn_queue_cnt_q[i] <= InsnQueueDepth[i] + younger);
+    end : gen_parked_queue_issue
+
+    assign parked_issue    = parked_valid_q && &parked_queue_issue && !stall_lanes_desynch &&
+                             !vinsn_running_full;
+    assign parked_conflict = parked_valid_q && (|(target_vfus_vec & parked_target_vfus_q) ||
+      |(vregs_written(ara_req_i) & (vregs_read(parked_req_q) | vregs_written(parked_req_q))) ||
+      |(vregs_read(ara_req_i) & vregs_written(parked_req_q)));
+
+    `FF(parked_valid_q, parked_valid_d, 1'b0, clk_i, rst_ni);
+    `FF(parked_req_q, parked_req_d, '0, clk_i, rst_ni);
+    `FF(parked_target_vfus_q, parked_target_vfus_d, '0, clk_i, rst_ni);
+  end : gen_parking else begin : gen_no_parking
+    assign parked_queue_issue   = '0;
+    assign parked_issue         = 1'b0;
+    assign parked_conflict      = 1'b0;
+    assign parked_valid_q       = 1'b0;
+    assign parked_req_q         = '0;
+    assign parked_target_vfus_q = '0;
+  end : gen_no_parking
+
+  assign issue_req = parked_issue ? parked_req_q : ara_req_i;
+
   always_comb begin: p_sequencer
     // Default assignments
     state_d               = state_q;
@@ -374,6 +472,18 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
     // Not ready by default
     pe_scalar_resp_ready_o = 1'b0;
 
+    // No stalls
+    perf_vfu_stall_o    = '0;
+    perf_hazard_stall_o = 1'b0;
+    perf_opreq_stall_o  = 1'b0;
+    perf_vinsn_issue_o  = 1'b0;
+    perf_ooo_issue_o    = 1'b0;
+
+    // Maintain the parked instruction
+    parked_valid_d       = parked_valid_q;
+    parked_req_d         = parked_req_q;
+    parked_target_vfus_d = parked_target_vfus_q;
+
     // Update vector register's access list
     for (int unsigned v = 0; v < 32; v++) begin
       read_list_d[v].valid &= vinsn_running_q[read_list_q[v].vid] ;
@@ -398,34 +508,37 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
             pe_req_valid_d = 1'b0;
 
           // We are not ready
-          ara_req_ready_o = 1'b0;
-        // Received a new request
-        end else if (ara_req_valid_i) begin
+          ara_req_ready_o    = 1'b0;
+          perf_opreq_stall_o = 1'b1;
+        // Issue the parked instruction, or a new request
+        end else if (parked_issue || ara_req_valid_i) begin
           // The target PE is ready, and we can handle another running vector instruction
           // Let instructions with priority pass be issued
-          if (&vinsn_queue_issue && !stall_lanes_desynch && !vinsn_running_full) begin
+          // The new request must be independent of the parked instruction
+          if (parked_issue ||
+             (&vinsn_queue_issue && !stall_lanes_desynch && !vinsn_running_full && !parked_conflict)) begin
             ///////////////
             //  Hazards  //
             ///////////////
 
             // RAW
-            if (ara_req_i.use_vs1) pe_req_d.hazard_vs1[write_list_d[ara_req_i.vs1].vid] |=
-              write_list_d[ara_req_i.vs1].valid;
-            if (ara_req_i.use_vs2) pe_req_d.hazard_vs2[write_list_d[ara_req_i.vs2].vid] |=
-              write_list_d[ara_req_i.vs2].valid;
-            if (!ara_req_i.vm) pe_req_d.hazard_vm[write_list_d[VMASK].vid] |=
+            if (issue_req.use_vs1) pe_req_d.hazard_vs1[write_list_d[issue_req.vs1].vid] |=
+              write_list_d[issue_req.vs1].valid;
+            if (issue_req.use_vs2) pe_req_d.hazard_vs2[write_list_d[issue_req.vs2].vid] |=
+              write_list_d[issue_req.vs2].valid;
+            if (!issue_req.vm) pe_req_d.hazard_vm[write_list_d[VMASK].vid] |=
               write_list_d[VMASK].valid;
 
             // WAR
-            if (ara_req_i.use_vd) begin
-              pe_req_d.hazard_vs1[read_list_d[ara_req_i.vd].vid] |= read_list_d[ara_req_i.vd].valid;
-              pe_req_d.hazard_vs2[read_list_d[ara_req_i.vd].vid] |= read_list_d[ara_req_i.vd].valid;
-              pe_req_d.hazard_vm[read_list_d[ara_req_i.vd].vid] |= read_list_d[ara_req_i.vd].valid;
+            if (issue_req.use_vd) begin
+              pe_req_d.hazard_vs1[read_list_d[issue_req.vd].vid] |= read_list_d[issue_req.vd].valid;
+              pe_req_d.hazard_vs2[read_list_d[issue_req.vd].vid] |= read_list_d[issue_req.vd].valid;
+              pe_req_d.hazard_vm[read_list_d[issue_req.vd].vid] |= read_list_d[issue_req.vd].valid;
             end
 
             // WAW
-            if (ara_req_i.use_vd) pe_req_d.hazard_vd[write_list_d[ara_req_i.vd].vid] |=
-              write_list_d[ara_req_i.vd].valid;
+            if (issue_req.use_vd) pe_req_d.hazard_vd[write_list_d[issue_req.vd].vid] |=
+              write_list_d[issue_req.vd].valid;
 
             /////////////
             //  Issue  //
@@ -434,38 +547,38 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
             // Populate the PE request
             pe_req_d = '{
               id            : vinsn_id_n,
-              op            : ara_req_i.op,
-              vm            : ara_req_i.vm,
-              eew_vmask     : ara_req_i.eew_vmask,
-              vfu           : vfu(ara_req_i.op),
-              vs1           : ara_req_i.vs1,
-              use_vs1       : ara_req_i.use_vs1,
-              conversion_vs1: ara_req_i.conversion_vs1,
-              eew_vs1       : ara_req_i.eew_vs1,
-              old_eew_vs1   : ara_req_i.old_eew_vs1,
-              vs2           : ara_req_i.vs2,
-              use_vs2       : ara_req_i.use_vs2,
-              conversion_vs2: ara_req_i.conversion_vs2,
-              eew_vs2       : ara_req_i.eew_vs2,
-              use_vd_op     : ara_req_i.use_vd_op,
-              eew_vd_op     : ara_req_i.eew_vd_op,
-              scalar_op     : ara_req_i.scalar_op,
-              use_scalar_op : ara_req_i.use_scalar_op,
-              swap_vs2_vd_op: ara_req_i.swap_vs2_vd_op,
-              stride        : ara_req_i.stride,
-              is_stride_np2 : ara_req_i.is_stride_np2,
-              vd            : ara_req_i.vd,
-              use_vd        : ara_req_i.use_vd,
-              emul          : ara_req_i.emul,
-              fp_rm         : ara_req_i.fp_rm,
-              wide_fp_imm   : ara_req_i.wide_fp_imm,
-              cvt_resize    : ara_req_i.cvt_resize,
-              scale_vl      : ara_req_i.scale_vl,
+              op            : issue_req.op,
+              vm            : issue_req.vm,
+              eew_vmask     : issue_req.eew_vmask,
+              vfu           : vfu(issue_req.op),
+              vs1           : issue_req.vs1,
+              use_vs1       : issue_req.use_vs1,
+              conversion_vs1: issue_req.conversion_vs1,
+              eew_vs1       : issue_req.eew_vs1,
+              old_eew_vs1   : issue_req.old_eew_vs1,
+              vs2           : issue_req.vs2,
+              use_vs2       : issue_req.use_vs2,
+              conversion_vs2: issue_req.conversion_vs2,
+              eew_vs2       : issue_req.eew_vs2,
+              use_vd_op     : issue_req.use_vd_op,
+              eew_vd_op     : issue_req.eew_vd_op,
+              scalar_op     : issue_req.scalar_op,
+              use_scalar_op : issue_req.use_scalar_op,
+              swap_vs2_vd_op: issue_req.swap_vs2_vd_op,
+              stride        : issue_req.stride,
+              is_stride_np2 : issue_req.is_stride_np2,
+              vd            : issue_req.vd,
+              use_vd        : issue_req.use_vd,
+              emul          : issue_req.emul,
+              fp_rm         : issue_req.fp_rm,
+              wide_fp_imm   : issue_req.wide_fp_imm,
+              cvt_resize    : issue_req.cvt_resize,
+              scale_vl      : issue_req.scale_vl,
               start_lane    : start_lane,
               end_lane      : end_lane,
-              vl            : ara_req_i.vl,
-              vstart        : ara_req_i.vstart,
-              vtype         : ara_req_i.vtype,
+              vl            : issue_req.vl,
+              vstart        : issue_req.vstart,
+              vtype         : issue_req.vtype,
               hazard_vd     : pe_req_d.hazard_vd,
               hazard_vm     : pe_req_d.hazard_vm,
               hazard_vs1    : pe_req_d.hazard_vs1,
@@ -480,19 +593,20 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
             // We only issue instructions that take no operands if they have no hazards.
             // Moreover, SLIDE instructions cannot be always chained
             // ToDo: optimize the case for vslide1down, vslide1up (wait 2 cycles, then chain)
-            if (!(|{ara_req_i.use_vs1, ara_req_i.use_vs2, ara_req_i.use_vd_op, !ara_req_i.vm}) &&
+            if (!(|{issue_req.use_vs1, issue_req.use_vs2, issue_req.use_vd_op, !issue_req.vm}) &&
                 |{pe_req_d.hazard_vs1, pe_req_d.hazard_vs2, pe_req_d.hazard_vm, pe_req_d.hazard_vd} ||
                 (pe_req_d.op == VSLIDEUP && |{pe_req_d.hazard_vd, pe_req_d.hazard_vs1, pe_req_d.hazard_vs2}) ||
                 (pe_req_d.op == VSLIDEDOWN && |{pe_req_d.hazard_vs1, pe_req_d.hazard_vs2}))
             begin
-              ara_req_ready_o = 1'b0;
-              pe_req_valid_d  = 1'b0;
+              ara_req_ready_o     = 1'b0;
+              pe_req_valid_d      = 1'b0;
+              perf_hazard_stall_o = 1'b1;
             end else begin
               // Acknowledge instruction
               ara_req_ready_o = 1'b1;
 
               // Remember that the vector instruction is running
-              unique case (vfu(ara_req_i.op))
+              unique case (vfu(issue_req.op))
                 VFU_LoadUnit : pe_vinsn_running_d[NrLanes + OffsetLoad][vinsn_id_n]  = 1'b1;
                 VFU_StoreUnit: pe_vinsn_running_d[NrLanes + OffsetStore][vinsn_id_n] = 1'b1;
                 VFU_SlideUnit: pe_vinsn_running_d[NrLanes + OffsetSlide][vinsn_id_n] = 1'b1;
@@ -504,27 +618,52 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
               endcase
 
               // Masked vector instructions also run on the mask unit
-              pe_vinsn_running_d[NrLanes + OffsetMask][vinsn_id_n] |= !ara_req_i.vm;
+              pe_vinsn_running_d[NrLanes + OffsetMask][vinsn_id_n] |= !issue_req.vm;
 
               // Some instructions need to wait for an acknowledgment
               // before being committed with Ariane
-              if (is_load(ara_req_i.op) || is_store(ara_req_i.op) || !ara_req_i.use_vd) begin
+              if (is_load(issue_req.op) || is_store(issue_req.op) || !issue_req.use_vd) begin
                 ara_req_ready_o = 1'b0;
                 state_d         = WAIT;
               end
 
               // Issue the instruction
-              pe_req_valid_d = 1'b1;
+              pe_req_valid_d     = 1'b1;
+              perf_vinsn_issue_o = 1'b1;
+              perf_ooo_issue_o   = parked_valid_q && !parked_issue;
 
               // Mark that this vector instruction is writing to vector vd
-              if (ara_req_i.use_vd) write_list_d[ara_req_i.vd] = '{vid: vinsn_id_n, valid: 1'b1};
+              if (issue_req.use_vd) write_list_d[issue_req.vd] = '{vid: vinsn_id_n, valid: 1'b1};
 
               // Mark that this loop is reading vs
-              if (ara_req_i.use_vs1) read_list_d[ara_req_i.vs1] = '{vid: vinsn_id_n, valid: 1'b1};
-              if (ara_req_i.use_vs2) read_list_d[ara_req_i.vs2] = '{vid: vinsn_id_n, valid: 1'b1};
-              if (!ara_req_i.vm) read_list_d[VMASK]             = '{vid: vinsn_id_n, valid: 1'b1};
+              if (issue_req.use_vs1) read_list_d[issue_req.vs1] = '{vid: vinsn_id_n, valid: 1'b1};
+              if (issue_req.use_vs2) read_list_d[issue_req.vs2] = '{vid: vinsn_id_n, valid: 1'b1};
+              if (!issue_req.vm) read_list_d[VMASK]             = '{vid: vinsn_id_n, valid: 1'b1};
+
+              // The parked instruction left
+              if (parked_issue) parked_valid_d = 1'b0;
             end
-          end else ara_req_ready_o = 1'b0; // Wait until the PEs are ready
+
+            // The new request waits for the next cycle
+            if (parked_issue) ara_req_ready_o = 1'b0;
+          end else if (parked_conflict) begin
+            // Wait for the parked instruction
+            ara_req_ready_o     = 1'b0;
+            perf_hazard_stall_o = 1'b1;
+          end else begin
+            // Wait until the PEs are ready
+            ara_req_ready_o  = 1'b0;
+            perf_vfu_stall_o = target_vfus_vec[VFU_None-1:0] & ~vinsn_queue_issue[VFU_None-1:0];
+
+            // Park the instruction, and let the younger ones through
+            if (OutOfOrderIssue && !parked_valid_q && !(&vinsn_queue_issue) && parkable(ara_req_i))
+            begin
+              parked_valid_d       = 1'b1;
+              parked_req_d         = ara_req_i;
+              parked_target_vfus_d = target_vfus_vec;
+              ara_req_ready_o      = 1'b1;
+            end
+          end
         end
       end
 
@@ -705,4 +844,9 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
     assign vinsn_queue_issue[i] = ~target_vfus_vec[i] | (vinsn_queue_ready[i] | priority_pass[i]);
   end
 
+  // A VFU is busy as long as its counter tracks an instruction
+  for (genvar i = 0; i < VFU_None; i++) begin : gen_perf_vfu_busy
+    assign perf_vfu_busy_o[i] = insn_queue_cnt_q[i] != '0;
+  end
+
 endmodule : ara_sequencer
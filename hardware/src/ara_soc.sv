@@ -4,7 +4,10 @@
 //
 // Author: Matheus Cavalcante <matheusd@iis.ee.ethz.ch>
 // Description:
-// Ara's SoC, containing CVA6, Ara, and a L2 cache.
+// Ara's SoC, containing CVA6, Ara, a banked L2 memory, and a DMA engine.
+// With NrCores > 1, several CVA6+Ara cores share the L2 over the crossbar. The cores are not
+// coherent with each other: the DRAM window has an alias that CVA6 does not cache, through which
+// the harts exchange the data they read with scalar loads (see apps/common/mt.h).
 
 module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     // RVV Parameters
@@ -19,6 +22,16 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     parameter  fixpt_support_e        FixPtSupport = FixedPointEnable,
     // Support for segment memory operations
     parameter  seg_support_e          SegSupport   = SegSupportEnable,
+    // Low-latency path for the scalar results of vmv.x.s, vfmv.f.s, vcpop, and vfirst
+    parameter  bit                    ScalarFastPath = 1'b0,
+    // Consumers of a load read each VRF word as soon as the load wrote it
+    parameter  bit                    LoadChaining = 1'b0,
+    // Issue the independent instructions past one waiting for a full VFU queue
+    parameter  bit                    OutOfOrderIssue = 1'b0,
+    // Lanes of a cluster of the slide unit's datapath, past 16 lanes
+    parameter  int           unsigned LanesPerCluster = 4,
+    // Blocks in the buffer of the VLSU's stream prefetcher. 0 disables the prefetcher.
+    parameter  int           unsigned PrefetchEntries = 0,
     // AXI Interface
     parameter  int           unsigned AxiDataWidth = 32*NrLanes,
     parameter  int           unsigned AxiAddrWidth = 64,
@@ -28,6 +41,19 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     parameter  int           unsigned AxiRespDelay = 200,
     // Main memory
     parameter  int           unsigned L2NumWords   = (2**22) / NrLanes,
+    // Word-interleaved banks of the main memory
+    parameter  int           unsigned L2NumBanks   = 4,
+    // Register stages in front of the main memory, to model a slower one. Each stage adds two
+    // cycles to the round trip of a read.
+    parameter  int           unsigned L2Latency    = 0,
+    // AXI ports of every Ara towards the L2, each with its own L2 port, and the interleaving
+    // granularity of their bursts (see ara_system)
+    parameter  int           unsigned NrMemPorts   = 1,
+    parameter  int           unsigned MemPageBytes = 512,
+    // Serial dividers per lane of every Ara
+    parameter  int           unsigned NrDivUnits   = 1,
+    // CVA6+Ara cores, with hart IDs 0 to NrCores-1
+    parameter  int           unsigned NrCores      = 1,
     // Dependant parameters. DO NOT CHANGE!
     localparam type                   axi_data_t   = logic [AxiDataWidth-1:0],
     localparam type                   axi_strb_t   = logic [AxiDataWidth/8-1:0],
@@ -64,25 +90,37 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   //  Memory Regions  //
   //////////////////////
 
-  localparam NrAXIMasters = 1; // Actually masters, but slaves on the crossbar
+  localparam NrAXIMasters = NrCores + 1; // Actually masters, but slaves on the crossbar
 
+  // Core c is on port SYSTEM + c
   typedef enum int unsigned {
-    L2MEM = 0,
-    UART  = 1,
-    CTRL  = 2
+    SYSTEM = 0,
+    DMAMST = NrCores
+  } axi_masters_e;
+
+  // The L2 is not on the crossbar: every master reaches it on a path of its own
+  typedef enum int unsigned {
+    UART = 0,
+    CTRL = 1,
+    DMA  = 2
   } axi_slaves_e;
-  localparam NrAXISlaves = CTRL + 1;
+  localparam NrAXISlaves = DMA + 1;
 
   // Memory Map
   // 1GByte of DDR (split between two chips on Genesys2)
   localparam logic [63:0] DRAMLength = 64'h40000000;
   localparam logic [63:0] UARTLength = 64'h1000;
   localparam logic [63:0] CTRLLength = 64'h1000;
+  localparam logic [63:0] DMALength  = 64'h1000;
+  // Uncached alias of the DRAM, within its window. The L2 is aliased every L2 size.
+  localparam logic [63:0] DRAMUncachedLength = 64'h1000_0000;
 
   typedef enum logic [63:0] {
-    DRAMBase = 64'h8000_0000,
-    UARTBase = 64'hC000_0000,
-    CTRLBase = 64'hD000_0000
+    DRAMBase         = 64'h8000_0000,
+    DRAMUncachedBase = 64'h9000_0000,
+    UARTBase         = 64'hC000_0000,
+    CTRLBase         = 64'hD000_0000,
+    DMABase          = 64'hD000_1000
   } soc_bus_start_e;
 
   ///////////
@@ -96,8 +134,9 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   localparam AxiWideDataWidth   = AxiDataWidth;
   localparam AXiWideStrbWidth   = AxiWideDataWidth / 8;
 
-  localparam AxiSocIdWidth  = AxiIdWidth - $clog2(NrAXIMasters);
-  localparam AxiCoreIdWidth = AxiSocIdWidth - 1;
+  // The crossbar extends the IDs of its masters
+  localparam AxiSocIdWidth  = AxiIdWidth + $clog2(NrAXIMasters);
+  localparam AxiCoreIdWidth = AxiIdWidth - 1;
 
   // Internal types
   typedef logic [AxiNarrowDataWidth-1:0] axi_narrow_data_t;
@@ -110,6 +149,7 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   `AXI_TYPEDEF_ALL(ara_axi, axi_addr_t, axi_core_id_t, axi_data_t, axi_strb_t, axi_user_t)
   `AXI_TYPEDEF_ALL(ariane_axi, axi_addr_t, axi_core_id_t, axi_narrow_data_t, axi_narrow_strb_t,
     axi_user_t)
+  `AXI_TYPEDEF_ALL(dma_axi, axi_addr_t, axi_id_t, axi_narrow_data_t, axi_narrow_strb_t, axi_user_t)
   `AXI_TYPEDEF_ALL(soc_narrow, axi_addr_t, axi_soc_id_t, axi_narrow_data_t, axi_narrow_strb_t,
     axi_user_t)
   `AXI_TYPEDEF_ALL(soc_wide, axi_addr_t, axi_soc_id_t, axi_data_t, axi_strb_t, axi_user_t)
@@ -122,11 +162,78 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   system_req_t  system_axi_req;
   system_resp_t system_axi_resp;
 
+  // Masters, and their ports towards the crossbar and towards the L2
+  system_req_t  [NrAXIMasters-1:0] soc_axi_req;
+  system_resp_t [NrAXIMasters-1:0] soc_axi_resp;
+  system_req_t  [NrAXIMasters-1:0] xbar_axi_req;
+  system_resp_t [NrAXIMasters-1:0] xbar_axi_resp;
+  system_req_t  [NrAXIMasters-1:0] l2_axi_req;
+  system_resp_t [NrAXIMasters-1:0] l2_axi_resp;
+
+  // Invalidations of CVA6's L1 lines written by the DMA, broadcast to all the cores
+  logic [AxiAddrWidth-1:0] dma_inval_addr;
+  logic                    dma_inval_valid;
+  logic                    dma_inval_ready;
+  logic [NrCores-1:0]      core_inval_valid;
+  logic [NrCores-1:0]      core_inval_ready;
+
+  // Memory ports of the Ara of every core, reaching the L2 without the crossbar. Port 0 is unused.
+  ara_axi_req_t     [NrCores-1:0][NrMemPorts-1:0] ara_mem_axi_req;
+  ara_axi_resp_t    [NrCores-1:0][NrMemPorts-1:0] ara_mem_axi_resp;
+
   soc_wide_req_t    [NrAXISlaves-1:0] periph_wide_axi_req;
   soc_wide_resp_t   [NrAXISlaves-1:0] periph_wide_axi_resp;
   soc_narrow_req_t  [NrAXISlaves-1:0] periph_narrow_axi_req;
   soc_narrow_resp_t [NrAXISlaves-1:0] periph_narrow_axi_resp;
 
+  /////////////////////////////
+  //  Master Demultiplexers  //
+  /////////////////////////////
+
+  // The accesses of every master to the DRAM window go to its own path into the L2, so that the
+  // masters are served in parallel by the banks. The other ones go to the crossbar.
+  for (genvar m = 0; m < NrAXIMasters; m++) begin : gen_l2_demux
+    logic                aw_to_l2, ar_to_l2;
+    system_req_t  [1:0]  demux_axi_req;
+    system_resp_t [1:0]  demux_axi_resp;
+
+    assign aw_to_l2 = soc_axi_req[m].aw.addr >= DRAMBase &&
+                      soc_axi_req[m].aw.addr <  DRAMBase + DRAMLength;
+    assign ar_to_l2 = soc_axi_req[m].ar.addr >= DRAMBase &&
+                      soc_axi_req[m].ar.addr <  DRAMBase + DRAMLength;
+
+    axi_demux #(
+      .AxiIdWidth (AxiIdWidth      ),
+      .AtopSupport(1'b1            ),
+      .aw_chan_t  (system_aw_chan_t),
+      .w_chan_t   (system_w_chan_t ),
+      .b_chan_t   (system_b_chan_t ),
+      .ar_chan_t  (system_ar_chan_t),
+      .r_chan_t   (system_r_chan_t ),
+      .axi_req_t  (system_req_t    ),
+      .axi_resp_t (system_resp_t   ),
+      .NoMstPorts (2               ),
+      .MaxTrans   (4               ),
+      .SpillAw    (1'b0            ),
+      .SpillAr    (1'b0            )
+    ) i_l2_demux (
+      .clk_i          (clk_i          ),
+      .rst_ni         (rst_ni         ),
+      .test_i         (1'b0           ),
+      .slv_req_i      (soc_axi_req[m] ),
+      .slv_aw_select_i(aw_to_l2       ),
+      .slv_ar_select_i(ar_to_l2       ),
+      .slv_resp_o     (soc_axi_resp[m]),
+      .mst_reqs_o     (demux_axi_req  ),
+      .mst_resps_i    (demux_axi_resp )
+    );
+
+    assign xbar_axi_req[m]   = demux_axi_req[0];
+    assign l2_axi_req[m]     = demux_axi_req[1];
+    assign demux_axi_resp[0] = xbar_axi_resp[m];
+    assign demux_axi_resp[1] = l2_axi_resp[m];
+  end : gen_l2_demux
+
   ////////////////
   //  Crossbar  //
   ////////////////
@@ -139,8 +246,8 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     FallThrough       : 1'b0,
     LatencyMode       : axi_pkg::CUT_MST_PORTS,
     PipelineStages    : 0,
-    AxiIdWidthSlvPorts: AxiSocIdWidth,
-    AxiIdUsedSlvPorts : AxiSocIdWidth,
+    AxiIdWidthSlvPorts: AxiIdWidth,
+    AxiIdUsedSlvPorts : AxiIdWidth,
     UniqueIds         : 1'b0,
     AxiAddrWidth      : AxiAddrWidth,
     AxiDataWidth      : AxiWideDataWidth,
@@ -150,9 +257,9 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
 
   axi_pkg::xbar_rule_64_t [NrAXISlaves-1:0] routing_rules;
   assign routing_rules = '{
+    '{idx: DMA, start_addr: DMABase, end_addr: DMABase + DMALength},
     '{idx: CTRL, start_addr: CTRLBase, end_addr: CTRLBase + CTRLLength},
-    '{idx: UART, start_addr: UARTBase, end_addr: UARTBase + UARTLength},
-    '{idx: L2MEM, start_addr: DRAMBase, end_addr: DRAMBase + DRAMLength}
+    '{idx: UART, start_addr: UARTBase, end_addr: UARTBase + UARTLength}
   };
 
   axi_xbar #(
@@ -175,8 +282,8 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     .clk_i                (clk_i               ),
     .rst_ni               (rst_ni              ),
     .test_i               (1'b0                ),
-    .slv_ports_req_i      (system_axi_req      ),
-    .slv_ports_resp_o     (system_axi_resp     ),
+    .slv_ports_req_i      (xbar_axi_req        ),
+    .slv_ports_resp_o     (xbar_axi_resp       ),
     .mst_ports_req_o      (periph_wide_axi_req ),
     .mst_ports_resp_i     (periph_wide_axi_resp),
     .addr_map_i           (routing_rules       ),
@@ -184,82 +291,298 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     .default_mst_port_i   ('0                  )
   );
 
+  assign soc_axi_req[SYSTEM] = system_axi_req;
+  assign system_axi_resp     = soc_axi_resp[SYSTEM];
+
   //////////
   //  L2  //
   //////////
 
-  // The L2 memory does not support atomics
-
-  soc_wide_req_t  l2mem_wide_axi_req_wo_atomics;
-  soc_wide_resp_t l2mem_wide_axi_resp_wo_atomics;
-  axi_atop_filter #(
-    .AxiIdWidth     (AxiSocIdWidth  ),
-    .AxiMaxWriteTxns(4              ),
-    .axi_req_t      (soc_wide_req_t ),
-    .axi_resp_t     (soc_wide_resp_t)
-  ) i_l2mem_atop_filter (
-    .clk_i     (clk_i                         ),
-    .rst_ni    (rst_ni                        ),
-    .slv_req_i (periph_wide_axi_req[L2MEM]    ),
-    .slv_resp_o(periph_wide_axi_resp[L2MEM]   ),
-    .mst_req_o (l2mem_wide_axi_req_wo_atomics ),
-    .mst_resp_i(l2mem_wide_axi_resp_wo_atomics)
-  );
-
-  logic                      l2_req;
-  logic                      l2_we;
-  logic [AxiAddrWidth-1:0]   l2_addr;
-  logic [AxiDataWidth/8-1:0] l2_be;
-  logic [AxiDataWidth-1:0]   l2_wdata;
-  logic [AxiDataWidth-1:0]   l2_rdata;
-  logic                      l2_rvalid;
-
-  axi_to_mem #(
-    .AddrWidth (AxiAddrWidth   ),
-    .DataWidth (AxiDataWidth   ),
-    .IdWidth   (AxiSocIdWidth  ),
-    .NumBanks  (1              ),
-    .axi_req_t (soc_wide_req_t ),
-    .axi_resp_t(soc_wide_resp_t)
-  ) i_axi_to_mem (
-    .clk_i       (clk_i                         ),
-    .rst_ni      (rst_ni                        ),
-    .axi_req_i   (l2mem_wide_axi_req_wo_atomics ),
-    .axi_resp_o  (l2mem_wide_axi_resp_wo_atomics),
-    .mem_req_o   (l2_req                        ),
-    .mem_gnt_i   (l2_req                        ), // Always available
-    .mem_we_o    (l2_we                         ),
-    .mem_addr_o  (l2_addr                       ),
-    .mem_strb_o  (l2_be                         ),
-    .mem_wdata_o (l2_wdata                      ),
-    .mem_rdata_i (l2_rdata                      ),
-    .mem_rvalid_i(l2_rvalid                     ),
-    .mem_atop_o  (/* Unused */                  ),
-    .busy_o      (/* Unused */                  )
+  // The L2 is reached through the path of every master, and through the memory ports 1 to
+  // NrMemPorts-1 of the Ara of every core. Every path and port has a read and a write requester
+  // into the banks: requesters 2m and 2m+1 serve the reads and writes of master m, requesters
+  // 2(NrAXIMasters+q) and 2(NrAXIMasters+q)+1 those of memory port p of core c, with
+  // q = c*(NrMemPorts-1) + p-1.
+  localparam int unsigned NrL2Ports = 2 * NrAXIMasters + 2 * NrCores * (NrMemPorts - 1);
+
+  logic [NrL2Ports-1:0]                          l2_req;
+  logic [NrL2Ports-1:0]                          l2_gnt;
+  logic [NrL2Ports-1:0]                          l2_we;
+  logic [NrL2Ports-1:0][AxiAddrWidth-1:0]        l2_addr;
+  logic [NrL2Ports-1:0][$clog2(L2NumWords)-1:0]  l2_word;
+  logic [NrL2Ports-1:0][AxiDataWidth/8-1:0]      l2_be;
+  logic [NrL2Ports-1:0][AxiDataWidth-1:0]        l2_wdata;
+  logic [NrL2Ports-1:0][AxiDataWidth-1:0]        l2_rdata;
+  logic [NrL2Ports-1:0]                          l2_rvalid;
+  logic [NrL2Ports-1:0]                          l2_conflict;
+
+  for (genvar m = 0; m < NrAXIMasters; m++) begin : gen_l2_masters
+    system_req_t         cut_axi_req;
+    system_resp_t        cut_axi_resp;
+    system_req_t         wo_atomics_axi_req;
+    system_resp_t        wo_atomics_axi_resp;
+    system_req_t   [1:0] rw_axi_req;
+    system_resp_t  [1:0] rw_axi_resp;
+
+    // Register stages in front of the L2, which model a slower memory
+    axi_multicut #(
+      .NoCuts    (L2Latency       ),
+      .aw_chan_t (system_aw_chan_t),
+      .w_chan_t  (system_w_chan_t ),
+      .b_chan_t  (system_b_chan_t ),
+      .ar_chan_t (system_ar_chan_t),
+      .r_chan_t  (system_r_chan_t ),
+      .axi_req_t (system_req_t    ),
+      .axi_resp_t(system_resp_t   )
+    ) i_multicut (
+      .clk_i     (clk_i         ),
+      .rst_ni    (rst_ni        ),
+      .slv_req_i (l2_axi_req[m] ),
+      .slv_resp_o(l2_axi_resp[m]),
+      .mst_req_o (cut_axi_req   ),
+      .mst_resp_i(cut_axi_resp  )
+    );
+
+    // The L2 memory does not support atomics
+    axi_atop_filter #(
+      .AxiIdWidth     (AxiIdWidth   ),
+      .AxiMaxWriteTxns(4            ),
+      .axi_req_t      (system_req_t ),
+      .axi_resp_t     (system_resp_t)
+    ) i_atop_filter (
+      .clk_i     (clk_i              ),
+      .rst_ni    (rst_ni             ),
+      .slv_req_i (cut_axi_req        ),
+      .slv_resp_o(cut_axi_resp       ),
+      .mst_req_o (wo_atomics_axi_req ),
+      .mst_resp_i(wo_atomics_axi_resp)
+    );
+
+    // Read and write halves of the path
+    always_comb begin : p_rw_split
+      rw_axi_req             = '0;
+      rw_axi_req[0].ar       = wo_atomics_axi_req.ar;
+      rw_axi_req[0].ar_valid = wo_atomics_axi_req.ar_valid;
+      rw_axi_req[0].r_ready  = wo_atomics_axi_req.r_ready;
+      rw_axi_req[1].aw       = wo_atomics_axi_req.aw;
+      rw_axi_req[1].aw_valid = wo_atomics_axi_req.aw_valid;
+      rw_axi_req[1].w        = wo_atomics_axi_req.w;
+      rw_axi_req[1].w_valid  = wo_atomics_axi_req.w_valid;
+      rw_axi_req[1].b_ready  = wo_atomics_axi_req.b_ready;
+
+      wo_atomics_axi_resp          = '0;
+      wo_atomics_axi_resp.ar_ready = rw_axi_resp[0].ar_ready;
+      wo_atomics_axi_resp.r        = rw_axi_resp[0].r;
+      wo_atomics_axi_resp.r_valid  = rw_axi_resp[0].r_valid;
+      wo_atomics_axi_resp.aw_ready = rw_axi_resp[1].aw_ready;
+      wo_atomics_axi_resp.w_ready  = rw_axi_resp[1].w_ready;
+      wo_atomics_axi_resp.b        = rw_axi_resp[1].b;
+      wo_atomics_axi_resp.b_valid  = rw_axi_resp[1].b_valid;
+    end : p_rw_split
+
+    for (genvar rw = 0; rw < 2; rw++) begin : gen_rw
+      axi_to_mem #(
+        .AddrWidth (AxiAddrWidth ),
+        .DataWidth (AxiDataWidth ),
+        .IdWidth   (AxiIdWidth   ),
+        .NumBanks  (1            ),
+        .axi_req_t (system_req_t ),
+        .axi_resp_t(system_resp_t)
+      ) i_axi_to_mem (
+        .clk_i       (clk_i             ),
+        .rst_ni      (rst_ni            ),
+        .axi_req_i   (rw_axi_req[rw]    ),
+        .axi_resp_o  (rw_axi_resp[rw]   ),
+        .mem_req_o   (l2_req[2*m+rw]    ),
+        .mem_gnt_i   (l2_gnt[2*m+rw]    ),
+        .mem_we_o    (l2_we[2*m+rw]     ),
+        .mem_addr_o  (l2_addr[2*m+rw]   ),
+        .mem_strb_o  (l2_be[2*m+rw]     ),
+        .mem_wdata_o (l2_wdata[2*m+rw]  ),
+        .mem_rdata_i (l2_rdata[2*m+rw]  ),
+        .mem_rvalid_i(l2_rvalid[2*m+rw] ),
+        .mem_atop_o  (/* Unused */      ),
+        .busy_o      (/* Unused */      )
+      );
+    end : gen_rw
+  end : gen_l2_masters
+
+  // Ara does not issue atomics
+  for (genvar q = 0; q < NrCores * (NrMemPorts - 1); q++) begin : gen_l2_ports
+    // Core and memory port of this L2 port
+    localparam int unsigned C = q / (NrMemPorts - 1);
+    localparam int unsigned P = q % (NrMemPorts - 1) + 1;
+    // First requester of this L2 port
+    localparam int unsigned R = 2 * (NrAXIMasters + q);
+
+    ara_axi_req_t        cut_axi_req;
+    ara_axi_resp_t       cut_axi_resp;
+    ara_axi_req_t  [1:0] rw_axi_req;
+    ara_axi_resp_t [1:0] rw_axi_resp;
+
+    axi_multicut #(
+      .NoCuts    (L2Latency        ),
+      .aw_chan_t (ara_axi_aw_chan_t),
+      .w_chan_t  (ara_axi_w_chan_t ),
+      .b_chan_t  (ara_axi_b_chan_t ),
+      .ar_chan_t (ara_axi_ar_chan_t),
+      .r_chan_t  (ara_axi_r_chan_t ),
+      .axi_req_t (ara_axi_req_t    ),
+      .axi_resp_t(ara_axi_resp_t   )
+    ) i_multicut (
+      .clk_i     (clk_i                 ),
+      .rst_ni    (rst_ni                ),
+      .slv_req_i (ara_mem_axi_req[C][P] ),
+      .slv_resp_o(ara_mem_axi_resp[C][P]),
+      .mst_req_o (cut_axi_req           ),
+      .mst_resp_i(cut_axi_resp          )
+    );
+
+    always_comb begin : p_rw_split
+      rw_axi_req             = '0;
+      rw_axi_req[0].ar       = cut_axi_req.ar;
+      rw_axi_req[0].ar_valid = cut_axi_req.ar_valid;
+      rw_axi_req[0].r_ready  = cut_axi_req.r_ready;
+      rw_axi_req[1].aw       = cut_axi_req.aw;
+      rw_axi_req[1].aw_valid = cut_axi_req.aw_valid;
+      rw_axi_req[1].w        = cut_axi_req.w;
+      rw_axi_req[1].w_valid  = cut_axi_req.w_valid;
+      rw_axi_req[1].b_ready  = cut_axi_req.b_ready;
+
+      cut_axi_resp          = '0;
+      cut_axi_resp.ar_ready = rw_axi_resp[0].ar_ready;
+      cut_axi_resp.r        = rw_axi_resp[0].r;
+      cut_axi_resp.r_valid  = rw_axi_resp[0].r_valid;
+      cut_axi_resp.aw_ready = rw_axi_resp[1].aw_ready;
+      cut_axi_resp.w_ready  = rw_axi_resp[1].w_ready;
+      cut_axi_resp.b        = rw_axi_resp[1].b;
+      cut_axi_resp.b_valid  = rw_axi_resp[1].b_valid;
+    end : p_rw_split
+
+    for (genvar rw = 0; rw < 2; rw++) begin : gen_rw
+      axi_to_mem #(
+        .AddrWidth (AxiAddrWidth  ),
+        .DataWidth (AxiDataWidth  ),
+        .IdWidth   (AxiCoreIdWidth),
+        .NumBanks  (1             ),
+        .axi_req_t (ara_axi_req_t ),
+        .axi_resp_t(ara_axi_resp_t)
+      ) i_axi_to_mem (
+        .clk_i       (clk_i             ),
+        .rst_ni      (rst_ni            ),
+        .axi_req_i   (rw_axi_req[rw]    ),
+        .axi_resp_o  (rw_axi_resp[rw]   ),
+        .mem_req_o   (l2_req[R+rw]      ),
+        .mem_gnt_i   (l2_gnt[R+rw]      ),
+        .mem_we_o    (l2_we[R+rw]       ),
+        .mem_addr_o  (l2_addr[R+rw]     ),
+        .mem_strb_o  (l2_be[R+rw]       ),
+        .mem_wdata_o (l2_wdata[R+rw]    ),
+        .mem_rdata_i (l2_rdata[R+rw]    ),
+        .mem_rvalid_i(l2_rvalid[R+rw]   ),
+        .mem_atop_o  (/* Unused */      ),
+        .busy_o      (/* Unused */      )
+      );
+    end : gen_rw
+  end : gen_l2_ports
+
+  for (genvar c = 0; c < NrCores; c++) begin : gen_mem_port0
+    assign ara_mem_axi_resp[c][0] = '0;
+  end : gen_mem_port0
+
+  for (genvar p = 0; p < NrL2Ports; p++) begin : gen_l2_word
+    assign l2_word[p] = l2_addr[p][$clog2(L2NumWords)-1+$clog2(AxiDataWidth/8):$clog2(AxiDataWidth/8)];
+  end : gen_l2_word
+
+  // The words are interleaved over L2NumBanks banks, by the low bits of their index. Each bank
+  // is a memory of its own, which holds word w of the L2 at index w / L2NumBanks.
+  logic [L2NumBanks-1:0]                          bank_req;
+  logic [L2NumBanks-1:0]                          bank_we;
+  logic [L2NumBanks-1:0][$clog2(L2NumWords)-1:0]  bank_word;
+  logic [L2NumBanks-1:0][AxiDataWidth/8-1:0]      bank_be;
+  logic [L2NumBanks-1:0][AxiDataWidth-1:0]        bank_wdata;
+  logic [L2NumBanks-1:0][AxiDataWidth-1:0]        bank_rdata;
+
+  l2_bank_arbiter #(
+    .NrPorts  (NrL2Ports   ),
+    .NrBanks  (L2NumBanks  ),
+    .NumWords (L2NumWords  ),
+    .DataWidth(AxiDataWidth)
+  ) i_l2_bank_arbiter (
+    .clk_i       (clk_i      ),
+    .rst_ni      (rst_ni     ),
+    .req_i       (l2_req     ),
+    .gnt_o       (l2_gnt     ),
+    .we_i        (l2_we      ),
+    .addr_i      (l2_word    ),
+    .be_i        (l2_be      ),
+    .wdata_i     (l2_wdata   ),
+    .rvalid_o    (l2_rvalid  ),
+    .rdata_o     (l2_rdata   ),
+    .bank_req_o  (bank_req   ),
+    .bank_we_o   (bank_we    ),
+    .bank_addr_o (bank_word  ),
+    .bank_be_o   (bank_be    ),
+    .bank_wdata_o(bank_wdata ),
+    .bank_rdata_i(bank_rdata ),
+    .conflict_o  (l2_conflict)
   );
 
 `ifndef SPYGLASS
-  tc_sram #(
-    .NumWords (L2NumWords  ),
-    .NumPorts (1           ),
-    .DataWidth(AxiDataWidth),
-    .SimInit("random")
-  ) i_dram (
-    .clk_i  (clk_i                                                                      ),
-    .rst_ni (rst_ni                                                                     ),
-    .req_i  (l2_req                                                                     ),
-    .we_i   (l2_we                                                                      ),
-    .addr_i (l2_addr[$clog2(L2NumWords)-1+$clog2(AxiDataWidth/8):$clog2(AxiDataWidth/8)]),
-    .wdata_i(l2_wdata                                                                   ),
-    .be_i   (l2_be                                                                      ),
-    .rdata_o(l2_rdata                                                                   )
-  );
+  for (genvar b = 0; b < L2NumBanks; b++) begin : gen_l2_banks
+    logic [$clog2(L2NumWords/L2NumBanks)-1:0] bank_index;
+
+    assign bank_index = bank_word[b][$clog2(L2NumWords)-1:$clog2(L2NumBanks)];
+
+    tc_sram #(
+      .NumWords (L2NumWords / L2NumBanks),
+      .NumPorts (1                      ),
+      .DataWidth(AxiDataWidth           ),
+      .SimInit("random")
+    ) i_bank (
+      .clk_i  (clk_i        ),
+      .rst_ni (rst_ni       ),
+      .req_i  (bank_req[b]  ),
+      .we_i   (bank_we[b]   ),
+      .addr_i (bank_index   ),
+      .wdata_i(bank_wdata[b]),
+      .be_i   (bank_be[b]   ),
+      .rdata_o(bank_rdata[b])
+    );
+  end : gen_l2_banks
 `else
-  assign l2_rdata = '0;
+  assign bank_rdata = '0;
 `endif
 
-  // One-cycle latency
-  `FF(l2_rvalid, l2_req, 1'b0);
+  // Writes of the banks, whoever the master, which keep the prefetch buffers of the cores
+  // coherent. The L2 is aliased every L2 size, and the cores invalidate all the aliases of the
+  // byte offsets written in it.
+  localparam int unsigned L2AddrWidth = $clog2(L2NumWords) + $clog2(AxiDataWidth/8);
+
+  logic [L2NumBanks-1:0]                  l2_snoop_valid;
+  logic [L2NumBanks-1:0][L2AddrWidth-1:0] l2_snoop_addr;
+
+  for (genvar b = 0; b < L2NumBanks; b++) begin : gen_l2_snoop
+    assign l2_snoop_valid[b] = bank_req[b] && bank_we[b];
+    assign l2_snoop_addr[b]  = {bank_word[b], {$clog2(AxiDataWidth/8){1'b0}}};
+  end : gen_l2_snoop
+
+  // Bank accesses and conflicts, for the performance counters
+  logic [$clog2(NrL2Ports):0] l2_access_cnt, l2_conflict_cnt;
+
+  popcount #(
+    .INPUT_WIDTH(NrL2Ports)
+  ) i_l2_access_popcount (
+    .data_i    (l2_gnt       ),
+    .popcount_o(l2_access_cnt)
+  );
+
+  popcount #(
+    .INPUT_WIDTH(NrL2Ports)
+  ) i_l2_conflict_popcount (
+    .data_i    (l2_conflict    ),
+    .popcount_o(l2_conflict_cnt)
+  );
 
   ////////////
   //  UART  //
@@ -372,6 +695,15 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
 
   logic [63:0] event_trigger;
 
+  // Performance events from Ara of core 0, and from the L2
+  ara_perf_t core_perf, ara_perf;
+
+  always_comb begin : p_perf
+    ara_perf             = core_perf;
+    ara_perf.l2_access   = 16'(l2_access_cnt);
+    ara_perf.l2_conflict = 16'(l2_conflict_cnt);
+  end : p_perf
+
   axi_to_axi_lite #(
     .AxiAddrWidth   (AxiAddrWidth          ),
     .AxiDataWidth   (AxiNarrowDataWidth    ),
@@ -410,7 +742,8 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     .dram_base_addr_o     (/* Unused */                ),
     .dram_end_addr_o      (/* Unused */                ),
     .exit_o               (exit_o                      ),
-    .event_trigger_o      (event_trigger)
+    .event_trigger_o      (event_trigger),
+    .perf_i               (ara_perf                    )
   );
 
   axi_dw_converter #(
@@ -461,17 +794,18 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
 //  cfg.XF8ALT                = FPUSupport[0]; // Not supported by OpenHW Group's CVFPU
     cfg.NrPMPEntries          = 0;
     // idempotent region
-    cfg.NrNonIdempotentRules  = 2;
-    cfg.NonIdempotentAddrBase = {UARTBase, CTRLBase};
-    cfg.NonIdempotentLength   = {UARTLength, CTRLLength};
+    cfg.NrNonIdempotentRules  = 3;
+    cfg.NonIdempotentAddrBase = {UARTBase, CTRLBase, DMABase};
+    cfg.NonIdempotentLength   = {UARTLength, CTRLLength, DMALength};
     cfg.NrExecuteRegionRules  = 3;
     //                          DRAM;       Boot ROM;   Debug Module
     cfg.ExecuteRegionAddrBase = {DRAMBase,   64'h1_0000, 64'h0};
     cfg.ExecuteRegionLength   = {DRAMLength, 64'h10000,  64'h1000};
-    // cached region
-    cfg.NrCachedRegionRules   = 1;
-    cfg.CachedRegionAddrBase  = {DRAMBase};
-    cfg.CachedRegionLength    = {DRAMLength};
+    // cached region, all the DRAM but its uncached alias
+    cfg.NrCachedRegionRules   = 2;
+    cfg.CachedRegionAddrBase  = {DRAMBase, DRAMUncachedBase + DRAMUncachedLength};
+    cfg.CachedRegionLength    = {DRAMUncachedBase - DRAMBase,
+                                 DRAMBase + DRAMLength - DRAMUncachedBase - DRAMUncachedLength};
     // Return modified config
     return cfg;
   endfunction
@@ -503,6 +837,18 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     .FPExtSupport      (FPExtSupport         ),
     .FixPtSupport      (FixPtSupport         ),
     .SegSupport        (SegSupport           ),
+    .ScalarFastPath    (ScalarFastPath       ),
+    .LoadChaining      (LoadChaining         ),
+    .OutOfOrderIssue   (OutOfOrderIssue      ),
+    .LanesPerCluster   (LanesPerCluster      ),
+    .PrefetchEntries   (PrefetchEntries      ),
+    .NrSnoopPorts      (L2NumBanks           ),
+    .SnoopAddrWidth    (L2AddrWidth          ),
+    .NrDivUnits        (NrDivUnits           ),
+    .NrMemPorts        (NrMemPorts           ),
+    .MemRegionBase     (DRAMBase             ),
+    .MemRegionLength   (DRAMLength           ),
+    .MemPageBytes      (MemPageBytes         ),
     .CVA6Cfg           (CVA6AraConfig        ),
     .exception_t       (exception_t          ),
     .accelerator_req_t (accelerator_req_t    ),
@@ -540,23 +886,111 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   ara_system
 `endif
   i_system (
-    .clk_i        (clk_i                    ),
-    .rst_ni       (rst_ni                   ),
-    .boot_addr_i  (DRAMBase                 ), // start fetching from DRAM
-    .hart_id_i    (hart_id                  ),
-    .scan_enable_i(1'b0                     ),
-    .scan_data_i  (1'b0                     ),
-    .scan_data_o  (/* Unconnected */        ),
+    .clk_i            (clk_i                    ),
+    .rst_ni           (rst_ni                   ),
+    .boot_addr_i      (DRAMBase                 ), // start fetching from DRAM
+    .hart_id_i        (hart_id                  ),
+    .scan_enable_i    (1'b0                     ),
+    .scan_data_i      (1'b0                     ),
+    .scan_data_o      (/* Unconnected */        ),
 `ifndef TARGET_GATESIM
-    .axi_req_o    (system_axi_req           ),
-    .axi_resp_i   (system_axi_resp          )
+    .axi_req_o        (system_axi_req           ),
+    .axi_resp_i       (system_axi_resp          ),
+    .mem_axi_req_o    (ara_mem_axi_req[0]       ),
+    .mem_axi_resp_i   (ara_mem_axi_resp[0]      ),
+    .ext_inval_addr_i (dma_inval_addr           ),
+    .ext_inval_valid_i(core_inval_valid[0]      ),
+    .ext_inval_ready_o(core_inval_ready[0]      ),
+    .snoop_valid_i    (l2_snoop_valid           ),
+    .snoop_addr_i     (l2_snoop_addr            ),
+    .perf_o           (core_perf                )
   );
 `else
-    .axi_req_o    (system_axi_req_spill     ),
-    .axi_resp_i   (system_axi_resp_spill_del)
+    .axi_req_o        (system_axi_req_spill     ),
+    .axi_resp_i       (system_axi_resp_spill_del)
   );
+
+  // The netlist does not export the performance events, nor take external invalidations
+  assign core_perf           = '0;
+  assign core_inval_ready[0] = 1'b1;
 `endif
 
+  // Further cores, on the next crossbar ports. Only core 0 exports its performance events.
+  for (genvar c = 1; c < NrCores; c++) begin : gen_cores
+    ara_system #(
+      .NrLanes           (NrLanes              ),
+      .VLEN              (VLEN                 ),
+      .OSSupport         (OSSupport            ),
+      .FPUSupport        (FPUSupport           ),
+      .FPExtSupport      (FPExtSupport         ),
+      .FixPtSupport      (FixPtSupport         ),
+      .SegSupport        (SegSupport           ),
+      .ScalarFastPath    (ScalarFastPath       ),
+      .LoadChaining      (LoadChaining         ),
+      .OutOfOrderIssue   (OutOfOrderIssue      ),
+      .LanesPerCluster   (LanesPerCluster      ),
+      .PrefetchEntries   (PrefetchEntries      ),
+      .NrSnoopPorts      (L2NumBanks           ),
+      .SnoopAddrWidth    (L2AddrWidth          ),
+      .NrDivUnits        (NrDivUnits           ),
+      .NrMemPorts        (NrMemPorts           ),
+      .MemRegionBase     (DRAMBase             ),
+      .MemRegionLength   (DRAMLength           ),
+      .MemPageBytes      (MemPageBytes         ),
+      .CVA6Cfg           (CVA6AraConfig        ),
+      .exception_t       (exception_t          ),
+      .accelerator_req_t (accelerator_req_t    ),
+      .accelerator_resp_t(accelerator_resp_t   ),
+      .acc_mmu_req_t     (acc_mmu_req_t        ),
+      .acc_mmu_resp_t    (acc_mmu_resp_t       ),
+      .cva6_to_acc_t     (cva6_to_acc_t        ),
+      .acc_to_cva6_t     (acc_to_cva6_t        ),
+      .AxiAddrWidth      (AxiAddrWidth         ),
+      .AxiIdWidth        (AxiCoreIdWidth       ),
+      .AxiNarrowDataWidth(AxiNarrowDataWidth   ),
+      .AxiWideDataWidth  (AxiDataWidth         ),
+      .ara_axi_ar_t      (ara_axi_ar_chan_t    ),
+      .ara_axi_aw_t      (ara_axi_aw_chan_t    ),
+      .ara_axi_b_t       (ara_axi_b_chan_t     ),
+      .ara_axi_r_t       (ara_axi_r_chan_t     ),
+      .ara_axi_w_t       (ara_axi_w_chan_t     ),
+      .ara_axi_req_t     (ara_axi_req_t        ),
+      .ara_axi_resp_t    (ara_axi_resp_t       ),
+      .ariane_axi_ar_t   (ariane_axi_ar_chan_t ),
+      .ariane_axi_aw_t   (ariane_axi_aw_chan_t ),
+      .ariane_axi_b_t    (ariane_axi_b_chan_t  ),
+      .ariane_axi_r_t    (ariane_axi_r_chan_t  ),
+      .ariane_axi_w_t    (ariane_axi_w_chan_t  ),
+      .ariane_axi_req_t  (ariane_axi_req_t     ),
+      .ariane_axi_resp_t (ariane_axi_resp_t    ),
+      .system_axi_ar_t   (system_ar_chan_t     ),
+      .system_axi_aw_t   (system_aw_chan_t     ),
+      .system_axi_b_t    (system_b_chan_t      ),
+      .system_axi_r_t    (system_r_chan_t      ),
+      .system_axi_w_t    (system_w_chan_t      ),
+      .system_axi_req_t  (system_req_t         ),
+      .system_axi_resp_t (system_resp_t        )
+    ) i_system (
+      .clk_i            (clk_i                       ),
+      .rst_ni           (rst_ni                      ),
+      .boot_addr_i      (DRAMBase                    ), // start fetching from DRAM
+      .hart_id_i        (3'(c)                       ),
+      .scan_enable_i    (1'b0                        ),
+      .scan_data_i      (1'b0                        ),
+      .scan_data_o      (/* Unconnected */           ),
+      .axi_req_o        (soc_axi_req[SYSTEM + c]     ),
+      .axi_resp_i       (soc_axi_resp[SYSTEM + c]    ),
+      .mem_axi_req_o    (ara_mem_axi_req[c]          ),
+      .mem_axi_resp_i   (ara_mem_axi_resp[c]         ),
+      .ext_inval_addr_i (dma_inval_addr              ),
+      .ext_inval_valid_i(core_inval_valid[c]         ),
+      .ext_inval_ready_o(core_inval_ready[c]         ),
+      .snoop_valid_i    (l2_snoop_valid              ),
+      .snoop_addr_i     (l2_snoop_addr               ),
+      .perf_o           (/* Unused */                )
+    );
+  end : gen_cores
+
 
 `ifdef TARGET_GATESIM
   assign #(AxiRespDelay*1ps) system_axi_resp_spill_del = system_axi_resp_spill;
@@ -579,6 +1013,154 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   );
 `endif
 
+  ///////////
+  //  DMA  //
+  ///////////
+
+  // 2D copies within the memory map, programmed through its descriptor registers. Its 64-bit
+  // master is upsized to a crossbar port of its own. The lines it writes are invalidated in the
+  // L1 of every core.
+
+  soc_narrow_lite_req_t  axi_lite_dma_req;
+  soc_narrow_lite_resp_t axi_lite_dma_resp;
+
+  dma_axi_req_t  dma_axi_req, dma_axi_req_inval;
+  dma_axi_resp_t dma_axi_resp, dma_axi_resp_inval;
+
+
+  axi_dw_converter #(
+    .AxiSlvPortDataWidth(AxiWideDataWidth    ),
+    .AxiMstPortDataWidth(AxiNarrowDataWidth  ),
+    .AxiAddrWidth       (AxiAddrWidth        ),
+    .AxiIdWidth         (AxiSocIdWidth       ),
+    .AxiMaxReads        (2                   ),
+    .ar_chan_t          (soc_wide_ar_chan_t  ),
+    .mst_r_chan_t       (soc_narrow_r_chan_t ),
+    .slv_r_chan_t       (soc_wide_r_chan_t   ),
+    .aw_chan_t          (soc_narrow_aw_chan_t),
+    .b_chan_t           (soc_narrow_b_chan_t ),
+    .mst_w_chan_t       (soc_narrow_w_chan_t ),
+    .slv_w_chan_t       (soc_wide_w_chan_t   ),
+    .axi_mst_req_t      (soc_narrow_req_t    ),
+    .axi_mst_resp_t     (soc_narrow_resp_t   ),
+    .axi_slv_req_t      (soc_wide_req_t      ),
+    .axi_slv_resp_t     (soc_wide_resp_t     )
+  ) i_axi_slave_dma_dwc (
+    .clk_i     (clk_i                      ),
+    .rst_ni    (rst_ni                     ),
+    .slv_req_i (periph_wide_axi_req[DMA]   ),
+    .slv_resp_o(periph_wide_axi_resp[DMA]  ),
+    .mst_req_o (periph_narrow_axi_req[DMA] ),
+    .mst_resp_i(periph_narrow_axi_resp[DMA])
+  );
+
+  axi_to_axi_lite #(
+    .AxiAddrWidth   (AxiAddrWidth          ),
+    .AxiDataWidth   (AxiNarrowDataWidth    ),
+    .AxiIdWidth     (AxiSocIdWidth         ),
+    .AxiUserWidth   (AxiUserWidth          ),
+    .AxiMaxReadTxns (1                     ),
+    .AxiMaxWriteTxns(1                     ),
+    .FallThrough    (1'b0                  ),
+    .full_req_t     (soc_narrow_req_t      ),
+    .full_resp_t    (soc_narrow_resp_t     ),
+    .lite_req_t     (soc_narrow_lite_req_t ),
+    .lite_resp_t    (soc_narrow_lite_resp_t)
+  ) i_axi_to_axi_lite_dma (
+    .clk_i     (clk_i                      ),
+    .rst_ni    (rst_ni                     ),
+    .test_i    (1'b0                       ),
+    .slv_req_i (periph_narrow_axi_req[DMA] ),
+    .slv_resp_o(periph_narrow_axi_resp[DMA]),
+    .mst_req_o (axi_lite_dma_req           ),
+    .mst_resp_i(axi_lite_dma_resp          )
+  );
+
+  soc_dma #(
+    .AddrWidth      (AxiAddrWidth          ),
+    .axi_lite_req_t (soc_narrow_lite_req_t ),
+    .axi_lite_resp_t(soc_narrow_lite_resp_t),
+    .axi_req_t      (dma_axi_req_t         ),
+    .axi_resp_t     (dma_axi_resp_t        )
+  ) i_dma (
+    .clk_i                (clk_i            ),
+    .rst_ni               (rst_ni           ),
+    .axi_lite_slave_req_i (axi_lite_dma_req ),
+    .axi_lite_slave_resp_o(axi_lite_dma_resp),
+    .axi_req_o            (dma_axi_req      ),
+    .axi_resp_i           (dma_axi_resp     )
+  );
+
+  // Every line written by the DMA is invalidated
+  axi_inval_filter #(
+    .MaxTxns      (4                                  ),
+    .AddrWidth    (AxiAddrWidth                       ),
+    .L1LineWidth  (CVA6AraConfig.DCACHE_LINE_WIDTH/8  ),
+    .FilterEntries(0                                  ),
+    .aw_chan_t    (dma_axi_aw_chan_t                  ),
+    .ar_chan_t    (dma_axi_ar_chan_t                  ),
+    .req_t        (dma_axi_req_t                      ),
+    .resp_t       (dma_axi_resp_t                     )
+  ) i_dma_inval_filter (
+    .clk_i           (clk_i             ),
+    .rst_ni          (rst_ni            ),
+`ifndef TARGET_GATESIM
+    .en_i            (1'b1              ),
+`else
+    .en_i            (1'b0              ),
+`endif
+    .slv_req_i       (dma_axi_req       ),
+    .slv_resp_o      (dma_axi_resp      ),
+    .mst_req_o       (dma_axi_req_inval ),
+    .mst_resp_i      (dma_axi_resp_inval),
+    .snoop_ar_i      ('0                ),
+    .snoop_ar_valid_i(1'b0              ),
+    .snoop_r_last_i  (1'b0              ),
+    .snoop_ar_stall_o(/* Unused */      ),
+    .inval_addr_o    (dma_inval_addr    ),
+    .inval_valid_o   (dma_inval_valid   ),
+    .inval_ready_i   (dma_inval_ready   ),
+    .inval_skipped_o (/* Unused */      ),
+    .aw_stall_o      (/* Unused */      )
+  );
+
+  stream_fork #(
+    .N_OUP(NrCores)
+  ) i_dma_inval_fork (
+    .clk_i  (clk_i           ),
+    .rst_ni (rst_ni          ),
+    .valid_i(dma_inval_valid ),
+    .ready_o(dma_inval_ready ),
+    .valid_o(core_inval_valid),
+    .ready_i(core_inval_ready)
+  );
+
+  axi_dw_converter #(
+    .AxiSlvPortDataWidth(AxiNarrowDataWidth),
+    .AxiMstPortDataWidth(AxiWideDataWidth  ),
+    .AxiAddrWidth       (AxiAddrWidth      ),
+    .AxiIdWidth         (AxiIdWidth        ),
+    .AxiMaxReads        (2                 ),
+    .ar_chan_t          (system_ar_chan_t  ),
+    .mst_r_chan_t       (system_r_chan_t   ),
+    .slv_r_chan_t       (dma_axi_r_chan_t  ),
+    .aw_chan_t          (system_aw_chan_t  ),
+    .b_chan_t           (system_b_chan_t   ),
+    .mst_w_chan_t       (system_w_chan_t   ),
+    .slv_w_chan_t       (dma_axi_w_chan_t  ),
+    .axi_mst_req_t      (system_req_t      ),
+    .axi_mst_resp_t     (system_resp_t     ),
+    .axi_slv_req_t      (dma_axi_req_t     ),
+    .axi_slv_resp_t     (dma_axi_resp_t    )
+  ) i_axi_master_dma_dwc (
+    .clk_i     (clk_i               ),
+    .rst_ni    (rst_ni              ),
+    .slv_req_i (dma_axi_req_inval   ),
+    .slv_resp_o(dma_axi_resp_inval  ),
+    .mst_req_o (soc_axi_req[DMAMST] ),
+    .mst_resp_i(soc_axi_resp[DMAMST])
+  );
+
   //////////////////
   //  Assertions  //
   //////////////////
@@ -598,6 +1180,20 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   if (AxiIdWidth == 0)
     $error("[ara_soc] The AXI ID width must be greater than zero.");
 
+  if (NrMemPorts == 0 || (NrMemPorts & (NrMemPorts - 1)) != 0)
+    $error("[ara_soc] The number of memory ports of Ara must be a power of two.");
+
+  if (NrCores == 0 || NrCores > 8)
+    $error("[ara_soc] The number of cores must be between 1 and 8.");
+
+  if (L2NumBanks == 0 || (L2NumBanks & (L2NumBanks - 1)) != 0 || L2NumBanks >= L2NumWords)
+    $error("[ara_soc] The L2 banks must be a power of two, with several words each.");
+
+`ifdef TARGET_GATESIM
+  if (NrCores > 1)
+    $error("[ara_soc] The netlist simulation supports a single core.");
+`endif
+
   if (RVVD(FPUSupport) && !CVA6AraConfig.RVD)
     $error(
       "[ara] Cannot support double-precision floating-point on Ara if CVA6 does not support it.");
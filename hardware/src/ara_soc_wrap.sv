@@ -18,6 +18,23 @@ module ara_soc_wrap
   parameter fixpt_support_e FixPtSupport = FixedPointEnable,
   // Support for segment memory operations
   parameter seg_support_e   SegSupport   = SegSupportEnable,
+  // Low-latency path for the scalar results of vmv.x.s, vfmv.f.s, vcpop, and vfirst
+  parameter bit             ScalarFastPath = 1'b0,
+  // Consumers of a load read each VRF word as soon as the load wrote it
+  parameter bit             LoadChaining = 1'b0,
+  // Issue the independent instructions past one waiting for a full VFU queue
+  parameter bit             OutOfOrderIssue = 1'b0,
+  // Lanes of a cluster of the slide unit's datapath, past 16 lanes
+  parameter int unsigned    LanesPerCluster = 4,
+  // Blocks in the buffer of the VLSU's stream prefetcher. 0 disables the prefetcher.
+  parameter int unsigned    PrefetchEntries = 0,
+  // Register stages in front of the main memory, each adding two cycles to a read
+  parameter int unsigned    L2Latency       = 0,
+  // AXI ports of Ara towards the main memory, and the interleaving granularity of their bursts
+  parameter int unsigned    NrMemPorts      = 1,
+  parameter int unsigned    MemPageBytes    = 512,
+  // Serial dividers per lane
+  parameter int unsigned    NrDivUnits      = 1,
 
   // AXI Interface
   parameter int unsigned AxiDataWidth = 32*NrLanes,
@@ -28,8 +45,9 @@ module ara_soc_wrap
   // AXI Resp Delay [ps] for gate-level simulation
   parameter int unsigned AxiRespDelay = 200,
 
-  // Main memory
-  parameter int unsigned L2NumWords   = (2**22) / NrLanes
+  // Main memory, and its word-interleaved banks
+  parameter int unsigned L2NumWords   = (2**22) / NrLanes,
+  parameter int unsigned L2NumBanks   = 4
 )(
   input  logic        clk_i,
   input  logic        rst_ni,
@@ -52,19 +70,29 @@ module ara_soc_wrap
 
   // Direct instantiation of ara_soc, passing through all parameters and ports.
   ara_soc #(
-    .NrLanes      (NrLanes      ),
-    .VLEN         (VLEN         ),
-    .OSSupport    (OSSupport    ),
-    .FPUSupport   (FPUSupport   ),
-    .FPExtSupport (FPExtSupport ),
-    .FixPtSupport (FixPtSupport ),
-    .SegSupport   (SegSupport   ),
-    .AxiDataWidth (AxiDataWidth ),
-    .AxiAddrWidth (AxiAddrWidth ),
-    .AxiUserWidth (AxiUserWidth ),
-    .AxiIdWidth   (AxiIdWidth   ),
-    .AxiRespDelay (AxiRespDelay ),
-    .L2NumWords   (L2NumWords   )
+    .NrLanes         (NrLanes         ),
+    .VLEN            (VLEN            ),
+    .OSSupport       (OSSupport       ),
+    .FPUSupport      (FPUSupport      ),
+    .FPExtSupport    (FPExtSupport    ),
+    .FixPtSupport    (FixPtSupport    ),
+    .SegSupport      (SegSupport      ),
+    .ScalarFastPath  (ScalarFastPath  ),
+    .LoadChaining    (LoadChaining    ),
+    .OutOfOrderIssue (OutOfOrderIssue ),
+    .LanesPerCluster (LanesPerCluster ),
+    .PrefetchEntries (PrefetchEntries ),
+    .L2Latency       (L2Latency       ),
+    .NrMemPorts      (NrMemPorts      ),
+    .MemPageBytes    (MemPageBytes    ),
+    .NrDivUnits      (NrDivUnits      ),
+    .AxiDataWidth    (AxiDataWidth    ),
+    .AxiAddrWidth    (AxiAddrWidth    ),
+    .AxiUserWidth    (AxiUserWidth    ),
+    .AxiIdWidth      (AxiIdWidth      ),
+    .AxiRespDelay    (AxiRespDelay    ),
+    .L2NumWords      (L2NumWords      ),
+    .L2NumBanks      (L2NumBanks      )
   ) i_ara_soc (
     .clk_i         (clk_i         ),
     .rst_ni        (rst_ni        ),
@@ -14,10 +14,41 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
     parameter fpu_support_e                     FPUSupport         = FPUSupportHalfSingleDouble,
     // External support for vfrec7, vfrsqrt7
     parameter fpext_support_e                   FPExtSupport       = FPExtSupportEnable,
+    // Support for the widening dot product vfwdotp
+    parameter fdotp_support_e                   FDotpSupport       = FDotpSupportEnable,
     // Support for fixed-point data types
     parameter fixpt_support_e                   FixPtSupport       = FixedPointEnable,
     // Support for segment memory operations
     parameter seg_support_e                     SegSupport         = SegSupportEnable,
+    // Low-latency path for the scalar results of vmv.x.s, vfmv.f.s, vcpop, and vfirst
+    parameter bit                               ScalarFastPath     = 1'b0,
+    // Consumers of a load read each VRF word as soon as the load wrote it
+    parameter bit                               LoadChaining       = 1'b0,
+    // Issue the independent instructions past one waiting for a full VFU queue
+    parameter bit                               OutOfOrderIssue    = 1'b0,
+    // Lanes of a cluster of the slide unit's datapath, past 16 lanes
+    parameter int                      unsigned LanesPerCluster    = 4,
+    // Sets and ways of the shadow of CVA6's L1 tags filtering the invalidations (0 sets: no
+    // filter)
+    parameter int                      unsigned InvalFilterEntries = 64,
+    parameter int                      unsigned InvalFilterWays    = 4,
+    // Blocks in the buffer of the VLSU's stream prefetcher (0: no prefetcher)
+    parameter int                      unsigned PrefetchEntries    = 0,
+    // Write ports of the memory snooped by the prefetcher, for the writes of the other masters.
+    // Their addresses are offsets in a memory of 2**SnoopAddrWidth bytes, aliased over the
+    // address space.
+    parameter int                      unsigned NrSnoopPorts       = 1,
+    parameter int                      unsigned SnoopAddrWidth     = 64,
+    // Serial dividers per lane (1: one element divided at a time)
+    parameter int                      unsigned NrDivUnits         = 1,
+    // AXI ports of Ara towards the memory, a power of two. The pages of MemPageBytes bytes of the
+    // memory region are interleaved over the ports, and the bursts are cut at their boundaries.
+    // Port 0 is shared with CVA6 on axi_req_o, and carries the accesses outside of the region.
+    // The other ones are mem_axi_req_o[NrMemPorts-1:1].
+    parameter int                      unsigned NrMemPorts         = 1,
+    parameter logic                      [63:0] MemRegionBase      = 64'h8000_0000,
+    parameter logic                      [63:0] MemRegionLength    = 64'h4000_0000,
+    parameter int                      unsigned MemPageBytes       = 512,
     // Ariane configuration
     parameter config_pkg::cva6_cfg_t            CVA6Cfg            = cva6_config_pkg::cva6_cfg,
     // CVA6-related parameters
@@ -65,7 +96,19 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
     output logic                    scan_data_o,
     // AXI Interface
     output system_axi_req_t         axi_req_o,
-    input  system_axi_resp_t        axi_resp_i
+    input  system_axi_resp_t        axi_resp_i,
+    // Additional memory ports of Ara. Port 0 is unused.
+    output ara_axi_req_t  [NrMemPorts-1:0] mem_axi_req_o,
+    input  ara_axi_resp_t [NrMemPorts-1:0] mem_axi_resp_i,
+    // Invalidations of CVA6's L1 lines written by the other masters of the memory
+    input  logic [AxiAddrWidth-1:0] ext_inval_addr_i,
+    input  logic                    ext_inval_valid_i,
+    output logic                    ext_inval_ready_o,
+    // Writes that landed in the memory, to keep Ara's prefetch buffer coherent
+    input  logic [NrSnoopPorts-1:0]                     snoop_valid_i,
+    input  logic [NrSnoopPorts-1:0][SnoopAddrWidth-1:0] snoop_addr_i,
+    // Performance events
+    output ara_perf_t               perf_o
   );
 
   `include "axi/assign.svh"
@@ -77,8 +120,16 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
 
   ariane_axi_req_t  ariane_narrow_axi_req;
   ariane_axi_resp_t ariane_narrow_axi_resp;
+  // CVA6's reads, held back while the L1 tag shadow has no room to track them
+  ariane_axi_req_t  ariane_dwc_axi_req;
+  ariane_axi_resp_t ariane_dwc_axi_resp;
+  logic             ariane_refill_stall;
   ara_axi_req_t     ariane_axi_req, ara_axi_req_inval, ara_axi_req;
   ara_axi_resp_t    ariane_axi_resp, ara_axi_resp_inval, ara_axi_resp;
+  // Memory ports of Ara
+  ara_axi_req_t  [NrMemPorts-1:0] ara_mem_axi_req;
+  ara_axi_resp_t [NrMemPorts-1:0] ara_mem_axi_resp;
+  ara_axi_resp_t                  ara_mem_axi_resp_mux;
 
   //////////////////////
   //  Ara and Ariane  //
@@ -93,6 +144,15 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
   logic              [AxiAddrWidth-1:0] inval_addr;
   logic                                 inval_valid;
   logic                                 inval_ready;
+  // Invalidations of Ara's writes
+  logic              [AxiAddrWidth-1:0] filter_inval_addr;
+  logic                                 filter_inval_valid;
+  logic                                 filter_inval_ready;
+  // Written lines checked per cycle by the invalidation filter
+  localparam int unsigned InvalScanLines = 4;
+  logic [$clog2(InvalScanLines+1)-1:0]  inval_skipped;
+  logic                                 inval_aw_stall;
+  ara_perf_t                            ara_perf;
 
   // Support max 8 cores, for now
   logic [63:0] hart_id;
@@ -108,6 +168,27 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
     acc_cons_en                        = acc_req.acc_req.acc_cons_en;
   end
 
+  // Merge the invalidations of Ara's writes with the external ones. Without coherence, the
+  // external ones are dropped.
+  logic ext_inval_valid, ext_inval_ready;
+
+  assign ext_inval_valid   = ext_inval_valid_i && acc_cons_en;
+  assign ext_inval_ready_o = ext_inval_ready || !acc_cons_en;
+
+  stream_arbiter #(
+    .DATA_T(logic [AxiAddrWidth-1:0]),
+    .N_INP (2                       )
+  ) i_inval_arbiter (
+    .clk_i      (clk_i                                  ),
+    .rst_ni     (rst_ni                                 ),
+    .inp_data_i ({ext_inval_addr_i, filter_inval_addr}  ),
+    .inp_valid_i({ext_inval_valid, filter_inval_valid}  ),
+    .inp_ready_o({ext_inval_ready, filter_inval_ready}  ),
+    .oup_data_o (inval_addr                             ),
+    .oup_valid_o(inval_valid                            ),
+    .oup_ready_i(inval_ready                            )
+  );
+
 `ifdef IDEAL_DISPATCHER
   // Perfect dispatcher to Ara
   accel_dispatcher_ideal i_accel_dispatcher_ideal #(
@@ -185,49 +266,92 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
 `ifdef IDEAL_DISPATCHER
     .slv_req_i ('0                    ),
 `else
-    .slv_req_i (ariane_narrow_axi_req ),
+    .slv_req_i (ariane_dwc_axi_req    ),
 `endif
-    .slv_resp_o(ariane_narrow_axi_resp),
+    .slv_resp_o(ariane_dwc_axi_resp   ),
     .mst_req_o (ariane_axi_req        ),
     .mst_resp_i(ariane_axi_resp       )
   );
 
+  always_comb begin : p_refill_stall
+    ariane_dwc_axi_req     = ariane_narrow_axi_req;
+    ariane_narrow_axi_resp = ariane_dwc_axi_resp;
+    if (ariane_refill_stall) begin
+      ariane_dwc_axi_req.ar_valid     = 1'b0;
+      ariane_narrow_axi_resp.ar_ready = 1'b0;
+    end
+  end : p_refill_stall
+
+  // CVA6's reads are snooped before the width converter, where its refills are single bursts
   axi_inval_filter #(
-    .MaxTxns    (4                              ),
-    .AddrWidth  (AxiAddrWidth                   ),
-    .L1LineWidth(CVA6Cfg.DCACHE_LINE_WIDTH/8    ),
-    .aw_chan_t  (ara_axi_aw_t                   ),
-    .req_t      (ara_axi_req_t                  ),
-    .resp_t     (ara_axi_resp_t                 )
+    .MaxTxns      (4                              ),
+    .AddrWidth    (AxiAddrWidth                   ),
+    .L1LineWidth  (CVA6Cfg.DCACHE_LINE_WIDTH/8    ),
+    .FilterEntries(InvalFilterEntries             ),
+    .FilterWays   (InvalFilterWays                ),
+    .ScanLines    (InvalScanLines                 ),
+    .aw_chan_t    (ara_axi_aw_t                   ),
+    .ar_chan_t    (ariane_axi_ar_t                ),
+    .req_t        (ara_axi_req_t                  ),
+    .resp_t       (ara_axi_resp_t                 )
   ) i_axi_inval_filter (
-    .clk_i        (clk_i             ),
-    .rst_ni       (rst_ni            ),
+    .clk_i           (clk_i                   ),
+    .rst_ni          (rst_ni                  ),
+`ifdef IDEAL_DISPATCHER
+    .en_i            (1'b0                    ),
+`else
+    .en_i            (acc_cons_en             ),
+`endif
+    .slv_req_i       (ara_axi_req             ),
+    .slv_resp_o      (ara_axi_resp            ),
+    .mst_req_o       (ara_axi_req_inval       ),
+    .mst_resp_i      (ara_axi_resp_inval      ),
+    .snoop_ar_i      (ariane_narrow_axi_req.ar),
 `ifdef IDEAL_DISPATCHER
-    .en_i         (1'b0              ),
+    .snoop_ar_valid_i(1'b0                    ),
+    .snoop_r_last_i  (1'b0                    ),
 `else
-    .en_i         (acc_cons_en       ),
+    .snoop_ar_valid_i(ariane_narrow_axi_req.ar_valid && ariane_narrow_axi_resp.ar_ready),
+    .snoop_r_last_i  (ariane_narrow_axi_resp.r_valid && ariane_narrow_axi_req.r_ready &&
+                      ariane_narrow_axi_resp.r.last),
 `endif
-    .slv_req_i    (ara_axi_req       ),
-    .slv_resp_o   (ara_axi_resp      ),
-    .mst_req_o    (ara_axi_req_inval ),
-    .mst_resp_i   (ara_axi_resp_inval),
-    .inval_addr_o (inval_addr        ),
-    .inval_valid_o(inval_valid       ),
+    .snoop_ar_stall_o(ariane_refill_stall     ),
+    .inval_addr_o    (filter_inval_addr       ),
+    .inval_valid_o   (filter_inval_valid      ),
 `ifdef IDEAL_DISPATCHER
-    .inval_ready_i(1'b0              )
+    .inval_ready_i   (1'b0                    ),
 `else
-    .inval_ready_i(inval_ready       )
+    .inval_ready_i   (filter_inval_ready      ),
 `endif
+    .inval_skipped_o (inval_skipped           ),
+    .aw_stall_o      (inval_aw_stall          )
   );
 
+  // Add the events of the invalidation filter to Ara's
+  always_comb begin : p_perf
+    perf_o                = ara_perf;
+    perf_o.inval_req      = inval_valid && inval_ready;
+    perf_o.inval_skipped  = 16'(inval_skipped);
+    perf_o.inval_aw_stall = inval_aw_stall;
+  end : p_perf
+
   ara #(
     .NrLanes           (NrLanes           ),
     .VLEN              (VLEN              ),
     .OSSupport         (OSSupport         ),
     .FPUSupport        (FPUSupport        ),
     .FPExtSupport      (FPExtSupport      ),
+    .FDotpSupport      (FDotpSupport      ),
     .FixPtSupport      (FixPtSupport      ),
     .SegSupport        (SegSupport        ),
+    .ScalarFastPath    (ScalarFastPath    ),
+    .LoadChaining      (LoadChaining      ),
+    .OutOfOrderIssue   (OutOfOrderIssue   ),
+    .LanesPerCluster   (LanesPerCluster   ),
+    .PrefetchEntries   (PrefetchEntries   ),
+    .NrSnoopPorts      (NrSnoopPorts      ),
+    .SnoopAddrWidth    (SnoopAddrWidth    ),
+    .NrDivUnits        (NrDivUnits        ),
     .CVA6Cfg           (CVA6Cfg           ),
     .exception_t       (exception_t       ),
     .accelerator_req_t (accelerator_req_t ),
@@ -254,9 +378,37 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
     .acc_req_i       (acc_req       ),
     .acc_resp_o      (acc_resp      ),
     .axi_req_o       (ara_axi_req   ),
-    .axi_resp_i      (ara_axi_resp  )
+    .axi_resp_i      (ara_axi_resp  ),
+    .snoop_valid_i   (snoop_valid_i ),
+    .snoop_addr_i    (snoop_addr_i  ),
+    .perf_o          (ara_perf      )
   );
 
+  // Spread the bursts of Ara over its memory ports, after the invalidation filter has seen them
+  axi_interleave_split #(
+    .NrPorts     (NrMemPorts     ),
+    .PageBytes   (MemPageBytes   ),
+    .AddrWidth   (AxiAddrWidth   ),
+    .RegionBase  (MemRegionBase  ),
+    .RegionLength(MemRegionLength),
+    .req_t       (ara_axi_req_t  ),
+    .resp_t      (ara_axi_resp_t )
+  ) i_axi_interleave_split (
+    .clk_i     (clk_i             ),
+    .rst_ni    (rst_ni            ),
+    .slv_req_i (ara_axi_req_inval ),
+    .slv_resp_o(ara_axi_resp_inval),
+    .mst_req_o (ara_mem_axi_req   ),
+    .mst_resp_i(ara_mem_axi_resp  )
+  );
+
+  always_comb begin : p_mem_ports
+    mem_axi_req_o       = ara_mem_axi_req;
+    mem_axi_req_o[0]    = '0;
+    ara_mem_axi_resp    = mem_axi_resp_i;
+    ara_mem_axi_resp[0] = ara_mem_axi_resp_mux;
+  end : p_mem_ports
+
   axi_mux #(
     .SlvAxiIDWidth(AxiIdWidth       ),
     .slv_ar_chan_t(ara_axi_ar_t     ),
@@ -282,8 +434,8 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
     .clk_i      (clk_i                                ),
     .rst_ni     (rst_ni                               ),
     .test_i     (1'b0                                 ),
-    .slv_reqs_i ({ara_axi_req_inval, ariane_axi_req}  ),
-    .slv_resps_o({ara_axi_resp_inval, ariane_axi_resp}),
+    .slv_reqs_i ({ara_mem_axi_req[0], ariane_axi_req}  ),
+    .slv_resps_o({ara_mem_axi_resp_mux, ariane_axi_resp}),
     .mst_req_o  (axi_req_o                            ),
     .mst_resp_i (axi_resp_i                           )
   );
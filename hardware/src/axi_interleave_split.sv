@@ -0,0 +1,253 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Spreads the AXI4 bursts of one master over NrPorts ports. The pages of PageBytes bytes of the
+// interleaved region go to the ports in turn, by the page-index bits above the page offset; the
+// bursts outside of the region go to port 0. The INCR bursts are cut at the page boundaries, and
+// each piece goes to the port of its page, so that a long burst is served by all the ports.
+// The pieces are sent out as soon as possible, one per cycle, and are served in parallel by the
+// ports. Their responses are returned in order: the port of every piece is queued, and the R and
+// W beats, and the B responses, are only exchanged with the port at the head of their queue. The
+// R beats of a burst are only marked last on its last piece, and a burst gets a single B
+// response, the worst one of its pieces.
+// Does not support atomics.
+
+module axi_interleave_split #(
+    // Number of master ports, a power of two
+    parameter int          unsigned NrPorts       = 32'd1,
+    // Maximum number of read, and of write, pieces outstanding at the same time
+    parameter int          unsigned MaxTxns       = 32'd8,
+    // Interleaving granularity, a power of two of at most 4 KiB
+    parameter int          unsigned PageBytes     = 32'd4096,
+    // AXI Bus Types
+    parameter int          unsigned AddrWidth     = 32'd0,
+    parameter logic [AddrWidth-1:0] RegionBase    = '0,
+    parameter logic [AddrWidth-1:0] RegionLength  = '0,
+    parameter type                  req_t         = logic,
+    parameter type                  resp_t        = logic
+  ) (
+    input  logic                clk_i,
+    input  logic                rst_ni,
+    // Input / Slave Port
+    input  req_t                slv_req_i,
+    output resp_t               slv_resp_o,
+    // Output / Master Ports
+    output req_t  [NrPorts-1:0] mst_req_o,
+    input  resp_t [NrPorts-1:0] mst_resp_i
+  );
+
+  import cf_math_pkg::idx_width;
+  import axi_pkg::len_t;
+  import axi_pkg::size_t;
+  import axi_pkg::burst_t;
+  import axi_pkg::BURST_INCR;
+  import axi_pkg::RESP_OKAY;
+
+  `include "common_cells/registers.svh"
+
+  typedef logic [idx_width(NrPorts)-1:0] port_t;
+  typedef logic [AddrWidth-1:0]          addr_t;
+
+  if (NrPorts == 1) begin : gen_passthrough
+    assign mst_req_o[0] = slv_req_i;
+    assign slv_resp_o   = mst_resp_i[0];
+  end : gen_passthrough
+  else begin : gen_split
+    // Beats of a burst, up to 256
+    typedef logic [8:0] beats_t;
+
+    // Piece of a burst, in the order queues
+    typedef struct packed {
+      port_t port;
+      len_t  len;
+      logic  last; // Last piece of the burst
+    } piece_t;
+
+    // Port of an address
+    function automatic port_t port_of(addr_t addr);
+      if (addr >= RegionBase && addr - RegionBase < RegionLength)
+        return port_t'(addr >> $clog2(PageBytes));
+      return '0;
+    endfunction : port_of
+
+    // Address and beats of the next piece of a burst, after the first sent beats
+    function automatic void next_piece(input addr_t addr, input len_t len, input size_t size,
+        input burst_t burst, input beats_t sent, output addr_t piece_addr,
+        output beats_t piece_beats);
+      automatic addr_t  aligned = (addr >> size) << size;
+      automatic beats_t left    = beats_t'(len) + 1 - sent;
+      piece_addr  = (sent == '0) ? addr : aligned + (addr_t'(sent) << size);
+      piece_beats = left;
+      // Only the INCR bursts are cut, at the page boundaries
+      if (burst == BURST_INCR && (32'd1 << size) <= PageBytes) begin
+        automatic addr_t to_end = (PageBytes - (((piece_addr >> size) << size) & (PageBytes - 1))) >> size;
+        if (to_end < addr_t'(left)) piece_beats = beats_t'(to_end);
+      end
+    endfunction : next_piece
+
+    // Beats of the current bursts sent in previous pieces
+    beats_t ar_sent_d, ar_sent_q, aw_sent_d, aw_sent_q;
+    // Beats of the W piece at the head, and worst B response of the pieces of the current burst
+    len_t            w_cnt_d, w_cnt_q;
+    axi_pkg::resp_t  b_resp_d, b_resp_q;
+
+    // Order queues
+    piece_t ar_piece, aw_piece;
+    piece_t r_head, w_head, b_head;
+    logic   r_full, w_full, b_full;
+    logic   r_empty, w_empty, b_empty;
+    logic   r_push, w_push;
+    logic   r_pop, w_pop, b_pop;
+
+    always_comb begin : p_split
+      automatic addr_t  ar_addr, aw_addr;
+      automatic beats_t ar_beats, aw_beats;
+
+      slv_resp_o = '0;
+      for (int unsigned p = 0; p < NrPorts; p++) begin
+        mst_req_o[p]    = '0;
+        mst_req_o[p].ar = slv_req_i.ar;
+        mst_req_o[p].aw = slv_req_i.aw;
+        mst_req_o[p].w  = slv_req_i.w;
+      end
+
+      ar_sent_d = ar_sent_q;
+      aw_sent_d = aw_sent_q;
+      w_cnt_d   = w_cnt_q;
+      b_resp_d  = b_resp_q;
+
+      // AR: the next piece of the burst, to the port of its page, while its slot in the order
+      // queue is free. The burst is accepted with its last piece.
+      next_piece(slv_req_i.ar.addr, slv_req_i.ar.len, slv_req_i.ar.size, slv_req_i.ar.burst,
+        ar_sent_q, ar_addr, ar_beats);
+      ar_piece = '{
+        port: port_of(ar_addr),
+        len : len_t'(ar_beats - 1),
+        last: ar_sent_q + ar_beats == beats_t'(slv_req_i.ar.len) + 1
+      };
+      for (int unsigned p = 0; p < NrPorts; p++) begin
+        mst_req_o[p].ar.addr = ar_addr;
+        mst_req_o[p].ar.len  = ar_piece.len;
+      end
+      mst_req_o[ar_piece.port].ar_valid = slv_req_i.ar_valid && !r_full;
+      r_push = mst_req_o[ar_piece.port].ar_valid && mst_resp_i[ar_piece.port].ar_ready;
+      if (r_push) begin
+        ar_sent_d           = ar_piece.last ? '0 : ar_sent_q + ar_beats;
+        slv_resp_o.ar_ready = ar_piece.last;
+      end
+
+      // AW: same, with the W and B order queues
+      next_piece(slv_req_i.aw.addr, slv_req_i.aw.len, slv_req_i.aw.size, slv_req_i.aw.burst,
+        aw_sent_q, aw_addr, aw_beats);
+      aw_piece = '{
+        port: port_of(aw_addr),
+        len : len_t'(aw_beats - 1),
+        last: aw_sent_q + aw_beats == beats_t'(slv_req_i.aw.len) + 1
+      };
+      for (int unsigned p = 0; p < NrPorts; p++) begin
+        mst_req_o[p].aw.addr = aw_addr;
+        mst_req_o[p].aw.len  = aw_piece.len;
+      end
+      mst_req_o[aw_piece.port].aw_valid = slv_req_i.aw_valid && !w_full && !b_full;
+      w_push = mst_req_o[aw_piece.port].aw_valid && mst_resp_i[aw_piece.port].aw_ready;
+      if (w_push) begin
+        aw_sent_d           = aw_piece.last ? '0 : aw_sent_q + aw_beats;
+        slv_resp_o.aw_ready = aw_piece.last;
+      end
+
+      // R: from the port of the oldest read piece
+      slv_resp_o.r                   = mst_resp_i[r_head.port].r;
+      slv_resp_o.r.last              = mst_resp_i[r_head.port].r.last && r_head.last;
+      slv_resp_o.r_valid             = mst_resp_i[r_head.port].r_valid && !r_empty;
+      mst_req_o[r_head.port].r_ready = slv_req_i.r_ready && !r_empty;
+      r_pop = slv_resp_o.r_valid && slv_req_i.r_ready && mst_resp_i[r_head.port].r.last;
+
+      // W: to the port of the oldest write piece still sending its data, with its own last beat
+      mst_req_o[w_head.port].w_valid = slv_req_i.w_valid && !w_empty;
+      mst_req_o[w_head.port].w.last  = w_cnt_q == w_head.len;
+      slv_resp_o.w_ready             = mst_resp_i[w_head.port].w_ready && !w_empty;
+      w_pop = 1'b0;
+      if (slv_req_i.w_valid && slv_resp_o.w_ready) begin
+        w_cnt_d = w_cnt_q + 1;
+        if (w_cnt_q == w_head.len) begin
+          w_cnt_d = '0;
+          w_pop   = 1'b1;
+        end
+      end
+
+      // B: from the port of the oldest write piece. Only the last piece of a burst answers.
+      mst_req_o[b_head.port].b_ready = !b_empty && (!b_head.last || slv_req_i.b_ready);
+      slv_resp_o.b                   = mst_resp_i[b_head.port].b;
+      if (b_resp_q > slv_resp_o.b.resp) slv_resp_o.b.resp = b_resp_q;
+      slv_resp_o.b_valid             = mst_resp_i[b_head.port].b_valid && !b_empty && b_head.last;
+      b_pop = mst_resp_i[b_head.port].b_valid && mst_req_o[b_head.port].b_ready;
+      if (b_pop)
+        b_resp_d = b_head.last ? RESP_OKAY : slv_resp_o.b.resp;
+    end : p_split
+
+    `FF(ar_sent_q, ar_sent_d, '0)
+    `FF(aw_sent_q, aw_sent_d, '0)
+    `FF(w_cnt_q, w_cnt_d, '0)
+    `FF(b_resp_q, b_resp_d, RESP_OKAY)
+
+    fifo_v3 #(
+      .DEPTH(MaxTxns),
+      .dtype(piece_t)
+    ) i_r_order (
+      .clk_i     (clk_i       ),
+      .rst_ni    (rst_ni      ),
+      .flush_i   (1'b0        ),
+      .testmode_i(1'b0        ),
+      .full_o    (r_full      ),
+      .empty_o   (r_empty     ),
+      .usage_o   (/* Unused */),
+      .data_i    (ar_piece    ),
+      .push_i    (r_push      ),
+      .data_o    (r_head      ),
+      .pop_i     (r_pop       )
+    );
+
+    fifo_v3 #(
+      .DEPTH(MaxTxns),
+      .dtype(piece_t)
+    ) i_w_order (
+      .clk_i     (clk_i       ),
+      .rst_ni    (rst_ni      ),
+      .flush_i   (1'b0        ),
+      .testmode_i(1'b0        ),
+      .full_o    (w_full      ),
+      .empty_o   (w_empty     ),
+      .usage_o   (/* Unused */),
+      .data_i    (aw_piece    ),
+      .push_i    (w_push      ),
+      .data_o    (w_head      ),
+      .pop_i     (w_pop       )
+    );
+
+    fifo_v3 #(
+      .DEPTH(MaxTxns),
+      .dtype(piece_t)
+    ) i_b_order (
+      .clk_i     (clk_i       ),
+      .rst_ni    (rst_ni      ),
+      .flush_i   (1'b0        ),
+      .testmode_i(1'b0        ),
+      .full_o    (b_full      ),
+      .empty_o   (b_empty     ),
+      .usage_o   (/* Unused */),
+      .data_i    (aw_piece    ),
+      .push_i    (w_push      ),
+      .data_o    (b_head      ),
+      .pop_i     (b_pop       )
+    );
+  end : gen_split
+
+  if (NrPorts == 0 || (NrPorts & (NrPorts - 1)) != 0)
+    $error("[axi_interleave_split] NrPorts must be a power of two.");
+
+  if (PageBytes > 4096 || (PageBytes & (PageBytes - 1)) != 0)
+    $error("[axi_interleave_split] PageBytes must be a power of two of at most 4 KiB.");
+
+endmodule : axi_interleave_split
@@ -6,16 +6,36 @@
 // Description:
 // Listens to AXI4 AW channel and issue single cacheline invalidations.
 // All other channels are passed through.
+//
+// With FilterEntries > 0, a shadow of the L1 tags, filled by snooping the
+// refills of the core, filters the invalidations: only the lines that may be
+// in the L1 are invalidated. The shadow has FilterEntries sets of FilterWays
+// lines. A refill into a full set evicts one of its lines, which the filter
+// then invalidates in the L1 itself, so that the shadow keeps tracking every
+// line. A refill that needs an eviction while EvictDepth evictions are already
+// waiting is held back (snoop_ar_stall_o) until one of them leaves. Invalidated
+// lines leave the shadow, and
+// evicted lines are invalidated, only when no read of the core is in flight.
+// The invalidation FSM checks ScanLines lines of the burst per cycle against
+// the shadow, and skips the absent ones without waiting for the L1.
 
 module axi_inval_filter #(
     // Maximum number of AXI write bursts outstanding at the same time
-    parameter int  unsigned MaxTxns     = 32'd0,
+    parameter int  unsigned MaxTxns       = 32'd0,
     // AXI Bus Types
-    parameter int  unsigned AddrWidth   = 32'd0,
-    parameter int  unsigned L1LineWidth = 32'd0,
-    parameter type          aw_chan_t   = logic,
-    parameter type          req_t       = logic,
-    parameter type          resp_t      = logic
+    parameter int  unsigned AddrWidth     = 32'd0,
+    parameter int  unsigned L1LineWidth   = 32'd0,
+    // Sets of the shadow of the L1 tags, a power of two. 0 disables the filtering:
+    // every line written by a burst is invalidated.
+    parameter int  unsigned FilterEntries = 32'd0,
+    // Lines per set of the shadow
+    parameter int  unsigned FilterWays    = 32'd1,
+    // Lines of a burst checked per cycle against the shadow
+    parameter int  unsigned ScanLines     = 32'd1,
+    parameter type          aw_chan_t     = logic,
+    parameter type          ar_chan_t     = logic,
+    parameter type          req_t         = logic,
+    parameter type          resp_t        = logic
   ) (
     input logic clk_i,
     input logic rst_ni,
@@ -29,10 +49,21 @@ module axi_inval_filter #(
     output req_t  mst_req_o,
     input  resp_t mst_resp_i,
 
+    // Snooped read requests of the core, which fill the L1, and their last R beats
+    input  ar_chan_t snoop_ar_i,
+    input  logic     snoop_ar_valid_i,
+    input  logic     snoop_r_last_i,
+    // The snooped read needs an eviction and the queue is full: hold it back
+    output logic     snoop_ar_stall_o,
+
     // Output / Cache invalidation requests
     output logic [AddrWidth-1:0] inval_addr_o,
     output logic                 inval_valid_o,
-    input  logic                 inval_ready_i
+    input  logic                 inval_ready_i,
+
+    // Statistics
+    output logic [$clog2(ScanLines+1)-1:0] inval_skipped_o, // Lines not invalidated
+    output logic                           aw_stall_o       // AW held back by a full FIFO
   );
 
   import cf_math_pkg::idx_width;
@@ -41,18 +72,31 @@ module axi_inval_filter #(
   `include "axi/typedef.svh"
   `include "common_cells/registers.svh"
 
+  // Line addresses
+  localparam int unsigned LineOffWidth = idx_width(L1LineWidth);
+  localparam int unsigned LineWidth    = AddrWidth - LineOffWidth;
+  typedef logic [LineWidth-1:0] line_t;
+  typedef logic [$clog2(ScanLines+1)-1:0] skip_cnt_t;
+
+  // First and last line touched by an AXI burst
+  function automatic line_t first_line(logic [AddrWidth-1:0] addr);
+    first_line = addr[AddrWidth-1:LineOffWidth];
+  endfunction : first_line
+
+  function automatic line_t last_line(logic [AddrWidth-1:0] addr, axi_pkg::len_t len,
+      axi_pkg::size_t size);
+    logic [AddrWidth-1:0] last_addr;
+    last_addr = addr + ((AddrWidth'(len) + 1) << size) - 1;
+    last_line = last_addr[AddrWidth-1:LineOffWidth];
+  endfunction : last_line
+
   // AW FIFO
   logic     aw_fifo_full, aw_fifo_empty;
   logic     aw_fifo_push, aw_fifo_pop;
   aw_chan_t aw_fifo_data;
 
   assign aw_fifo_push = en_i & slv_req_i.aw_valid & slv_resp_o.aw_ready;
-
-  // Invalidation requests
-  logic [AddrWidth-1:0] inval_offset_d, inval_offset_q;
-
-  assign inval_addr_o  = aw_fifo_data.addr + inval_offset_q;
-  assign inval_valid_o = ~aw_fifo_empty;
+  assign aw_stall_o   = slv_req_i.aw_valid & aw_fifo_full;
 
   //////////////////
   // AXI Handling //
@@ -70,63 +114,245 @@ module axi_inval_filter #(
     end
   end
 
+  ///////////////////
+  // L1 Tag Shadow //
+  ///////////////////
+
+  // Lines of the current window
+  line_t [ScanLines-1:0] scan_line;
+  logic  [ScanLines-1:0] scan_present;
+
+  // Invalidated line, which can leave the shadow
+  logic  clear_valid;
+  line_t clear_line;
+
+  // Lines evicted from the shadow, to be invalidated in the L1
+  localparam int unsigned EvictDepth = 4;
+  logic  evict_valid, evict_ready;
+  line_t evict_line;
+
+  if (FilterEntries == 0) begin : gen_no_filter
+    // Every line may be in the L1
+    assign scan_present     = '1;
+    assign evict_valid      = 1'b0;
+    assign evict_line       = '0;
+    assign snoop_ar_stall_o = 1'b0;
+  end : gen_no_filter
+  else begin : gen_filter
+    localparam int unsigned IdxWidth = idx_width(FilterEntries);
+    localparam int unsigned TagWidth = LineWidth - IdxWidth;
+
+    typedef logic [TagWidth-1:0] tag_t;
+    typedef logic [IdxWidth-1:0] idx_t;
+
+    typedef struct packed {
+      logic [FilterWays-1:0] valid;
+      tag_t [FilterWays-1:0] tag;
+    } shadow_t;
+    shadow_t [FilterEntries-1:0] shadow_d, shadow_q;
+
+    // Evicted lines, waiting for the L1. They are still present until then.
+    logic  [EvictDepth-1:0] evict_valid_d, evict_valid_q;
+    line_t [EvictDepth-1:0] evict_line_d, evict_line_q;
+    // Way evicted on the next refill into a full set
+    logic  [idx_width(FilterWays)-1:0] victim_d, victim_q;
+
+    // Snooped lines. A burst spanning more than one line is not a refill of the L1, and
+    // is ignored.
+    line_t snoop_first, snoop_last;
+    logic  snoop_refill, snoop_idle;
+    assign snoop_first  = first_line(snoop_ar_i.addr);
+    assign snoop_last   = last_line(snoop_ar_i.addr, snoop_ar_i.len, snoop_ar_i.size);
+    assign snoop_refill = snoop_ar_valid_i && snoop_first == snoop_last;
+
+    // A line being read in this very cycle is present as well
+    for (genvar l = 0; l < ScanLines; l++) begin : gen_lookup
+      shadow_t entry;
+      assign entry = shadow_q[idx_t'(scan_line[l])];
+
+      always_comb begin
+        scan_present[l] = snoop_refill && snoop_first == scan_line[l];
+        for (int unsigned w = 0; w < FilterWays; w++)
+          scan_present[l] |= entry.valid[w] &&
+            entry.tag[w] == tag_t'(scan_line[l] >> IdxWidth);
+        for (int unsigned e = 0; e < EvictDepth; e++)
+          scan_present[l] |= evict_valid_q[e] && evict_line_q[e] == scan_line[l];
+      end
+    end : gen_lookup
+
+    // A refill into a full set, which misses in it, needs a free slot of the eviction
+    // queue. The state of this cycle is enough: clearing a line or accepting an eviction
+    // only frees room for the next one.
+    always_comb begin : p_snoop_stall
+      automatic shadow_t entry = shadow_q[idx_t'(snoop_first)];
+      automatic logic    hit   = 1'b0;
+      for (int unsigned w = 0; w < FilterWays; w++)
+        hit |= entry.valid[w] && entry.tag[w] == tag_t'(snoop_first >> IdxWidth);
+      snoop_ar_stall_o = snoop_first == snoop_last && !hit && &entry.valid && &evict_valid_q;
+    end : p_snoop_stall
+
+    always_comb begin : p_shadow
+      automatic idx_t clear_idx = idx_t'(clear_line);
+      automatic tag_t clear_tag = tag_t'(clear_line >> IdxWidth);
+      automatic idx_t snoop_idx = idx_t'(snoop_first);
+      automatic tag_t snoop_tag = tag_t'(snoop_first >> IdxWidth);
+      automatic logic hit       = 1'b0;
+      automatic logic inserted  = 1'b0;
+      automatic logic pushed    = 1'b0;
+
+      shadow_d      = shadow_q;
+      evict_valid_d = evict_valid_q;
+      evict_line_d  = evict_line_q;
+      victim_d      = victim_q;
+
+      // An invalidated line leaves the shadow
+      if (clear_valid && snoop_idle)
+        for (int unsigned w = 0; w < FilterWays; w++)
+          if (shadow_q[clear_idx].valid[w] && shadow_q[clear_idx].tag[w] == clear_tag)
+            shadow_d[clear_idx].valid[w] = 1'b0;
+
+      // The L1 accepted an evicted line
+      for (int unsigned e = 0; e < EvictDepth; e++)
+        if (evict_valid && evict_ready && evict_valid_q[e] && evict_line_q[e] == evict_line)
+          evict_valid_d[e] = 1'b0;
+
+      // Record the refills after the invalidation, which they might follow
+      if (snoop_refill) begin
+        for (int unsigned w = 0; w < FilterWays; w++)
+          hit |= shadow_d[snoop_idx].valid[w] && shadow_d[snoop_idx].tag[w] == snoop_tag;
+
+        // Take a free way
+        if (!hit)
+          for (int unsigned w = 0; w < FilterWays; w++)
+            if (!inserted && !shadow_d[snoop_idx].valid[w]) begin
+              inserted                     = 1'b1;
+              shadow_d[snoop_idx].valid[w] = 1'b1;
+              shadow_d[snoop_idx].tag[w]   = snoop_tag;
+            end
+
+        // Evict the victim way of the full set. The refill was held back until there
+        // was room for it in the queue.
+        if (!hit && !inserted) begin
+          for (int unsigned e = 0; e < EvictDepth; e++)
+            if (!pushed && !evict_valid_d[e]) begin
+              pushed           = 1'b1;
+              evict_valid_d[e] = 1'b1;
+              evict_line_d[e]  = {shadow_d[snoop_idx].tag[victim_q], snoop_idx};
+            end
+
+          shadow_d[snoop_idx].tag[victim_q] = snoop_tag;
+          victim_d                          = victim_q + 1;
+        end
+      end
+    end : p_shadow
+
+    `FF(shadow_q, shadow_d, '0);
+    `FF(evict_valid_q, evict_valid_d, '0);
+    `FF(evict_line_q, evict_line_d, '0);
+    `FF(victim_q, FilterWays > 1 ? victim_d : '0, '0);
+
+    // A refill still in flight may bring back the old data of a line that was just
+    // invalidated: keep all the lines in the shadow until the core's reads are over.
+    // For the same reason, the evicted lines wait for the end of the reads.
+    logic [7:0] snoop_pending_d, snoop_pending_q;
+    assign snoop_pending_d = snoop_pending_q + snoop_ar_valid_i - snoop_r_last_i;
+    assign snoop_idle      = snoop_pending_q == '0;
+
+    `FF(snoop_pending_q, snoop_pending_d, '0);
+
+    always_comb begin : p_evict
+      evict_valid = 1'b0;
+      evict_line  = '0;
+      for (int unsigned e = 0; e < EvictDepth; e++)
+        if (!evict_valid && evict_valid_q[e]) begin
+          evict_valid = snoop_idle;
+          evict_line  = evict_line_q[e];
+        end
+    end : p_evict
+
+    if (FilterEntries != 2**IdxWidth)
+      $error("[axi_inval_filter] FilterEntries must be a power of two.");
+
+    if (FilterWays == 0 || FilterWays != 2**idx_width(FilterWays))
+      $error("[axi_inval_filter] FilterWays must be a power of two.");
+  end : gen_filter
+
   ///////////////////////
   // Invalidation FSM  //
   ///////////////////////
 
-  enum logic { Idle, Invalidating } state_d, state_q;
+  // Next line to check of the burst at the head of the FIFO. The first line of a
+  // burst comes straight from the FIFO.
+  line_t line_d, line_q;
+  logic  busy_d, busy_q;
+
+  line_t cur_line, burst_last;
+  assign cur_line   = busy_q ? line_q : first_line(aw_fifo_data.addr);
+  assign burst_last = last_line(aw_fifo_data.addr, aw_fifo_data.len, aw_fifo_data.size);
+
+  for (genvar l = 0; l < ScanLines; l++) begin : gen_scan_line
+    assign scan_line[l] = cur_line + l;
+  end : gen_scan_line
+
+  assign evict_ready = inval_ready_i;
 
   always_comb begin : inval_fsm
+    // One more bit, not to wrap around at the end of the address space
+    automatic logic [LineWidth:0] next_line = '0;
+    automatic logic               hit       = 1'b0;
+
     // Default assignments
-    state_d        = state_q;
-    aw_fifo_pop    = 1'b0;
-    inval_offset_d = inval_offset_q;
-
-    unique case (state_q)
-      // Ready for the next invalidation
-      Idle: begin
-        // We have a new AW
-        if (!aw_fifo_empty) begin
-          // Wait for the L1 to accept a new invalidation request
-          if (inval_ready_i) begin
-            // Continue if we are not done yet
-            // If the addr is misaligned wrt the cache line, we should invalidate one line more
-            if ((L1LineWidth - aw_fifo_data.addr[idx_width(L1LineWidth)-1:0]) < ((aw_fifo_data.len + 1) << aw_fifo_data.size)) begin
-              state_d        = Invalidating;
-              inval_offset_d = L1LineWidth - aw_fifo_data.addr[idx_width(L1LineWidth)-1:0];
-            end else begin
-              aw_fifo_pop = 1'b1;
-            end
-          end
+    line_d          = line_q;
+    busy_d          = busy_q;
+    aw_fifo_pop     = 1'b0;
+    inval_valid_o   = 1'b0;
+    inval_addr_o    = '0;
+    inval_skipped_o = '0;
+    clear_valid     = 1'b0;
+    clear_line      = '0;
+
+    // The evicted lines go first, and hold the burst back
+    if (evict_valid) begin
+      inval_valid_o = 1'b1;
+      inval_addr_o  = {evict_line, {LineOffWidth{1'b0}}};
+      clear_valid   = inval_ready_i;
+      clear_line    = evict_line;
+    end else if (!aw_fifo_empty) begin
+      // Invalidate the first line of the window that may be in the L1
+      for (int unsigned l = 0; l < ScanLines; l++) begin
+        if (!hit && scan_line[l] <= burst_last && scan_present[l]) begin
+          hit             = 1'b1;
+          inval_valid_o   = 1'b1;
+          inval_addr_o    = {scan_line[l], {LineOffWidth{1'b0}}};
+          inval_skipped_o = skip_cnt_t'(l);
+          // Stay on this line until the L1 accepts it
+          next_line       = cur_line + l + inval_ready_i;
+          clear_valid     = inval_ready_i;
+          clear_line      = scan_line[l];
         end
       end
 
-      // Issue incrementing invalidation requests
-      Invalidating: begin
-        // Wait for the L1 to accept a new invalidation request
-        if (inval_ready_i) begin
-          inval_offset_d = inval_offset_q + L1LineWidth;
-          // Are we done?
-          if (inval_offset_d >= ((aw_fifo_data.len + 1) << aw_fifo_data.size)) begin
-            state_d        = Idle;
-            inval_offset_d = '0;
-            aw_fifo_pop    = 1'b1;
-          end
-        end
+      // Skip the whole window
+      if (!hit) begin
+        next_line = cur_line + ScanLines;
+        for (int unsigned l = 0; l < ScanLines; l++)
+          inval_skipped_o += skip_cnt_t'(scan_line[l] <= burst_last);
       end
-    endcase
-  end
 
-  always_ff @(posedge clk_i or negedge rst_ni) begin
-    if (!rst_ni) begin
-      state_q        <= Idle;
-      inval_offset_q <= '0;
-    end else begin
-      state_q        <= state_d;
-      inval_offset_q <= inval_offset_d;
+      // Are we done with this burst?
+      if (next_line > burst_last) begin
+        busy_d      = 1'b0;
+        aw_fifo_pop = 1'b1;
+      end else begin
+        busy_d = 1'b1;
+        line_d = next_line[LineWidth-1:0];
+      end
     end
   end
 
+  `FF(line_q, line_d, '0);
+  `FF(busy_q, busy_d, 1'b0);
+
   fifo_v3 #(
     .FALL_THROUGH ( 1'b1      ),
     .DEPTH        ( MaxTxns   ),
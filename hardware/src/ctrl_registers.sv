@@ -6,7 +6,7 @@
 // Description: AXI-LITE accessible control registers, holding
 // static information about Ara's SoC.
 
-module ctrl_registers #(
+module ctrl_registers import ara_pkg::*; #(
     parameter int   unsigned                 DataWidth       = 32,
     parameter int   unsigned                 AddrWidth       = 32,
     // Parameters
@@ -26,7 +26,9 @@ module ctrl_registers #(
     output logic           [DataWidth-1:0] dram_base_addr_o,
     output logic           [DataWidth-1:0] dram_end_addr_o,
     output logic           [DataWidth-1:0] event_trigger_o,
-    output logic           [DataWidth-1:0] hw_cnt_en_o
+    output logic           [DataWidth-1:0] hw_cnt_en_o,
+    // Performance events from Ara
+    input  ara_perf_t                      perf_i
   );
 
   `include "common_cells/registers.svh"
@@ -35,27 +37,31 @@ module ctrl_registers #(
   //  Definitions  //
   ///////////////////
 
-  localparam int unsigned NumRegs          = 5;
+  localparam int unsigned NumBaseRegs      = 5;
+  localparam int unsigned NumRegs          = NumBaseRegs + NrPerfCounters;
   localparam int unsigned DataWidthInBytes = (DataWidth + 7) / 8;
   localparam int unsigned RegNumBytes      = NumRegs * DataWidthInBytes;
+  localparam int unsigned BaseRegNumBytes  = NumBaseRegs * DataWidthInBytes;
+  localparam int unsigned PerfRegNumBytes  = NrPerfCounters * DataWidthInBytes;
 
   localparam logic [DataWidthInBytes-1:0] ReadOnlyReg  = {DataWidthInBytes{1'b1}};
   localparam logic [DataWidthInBytes-1:0] ReadWriteReg = {DataWidthInBytes{1'b0}};
 
   // Memory map
+  // [40+8i+7:40+8i]: performance counter i (ro), see NrPerfCounters in ara_pkg
   // [39:32]: hw_cnt_en      (rw)
   // [25:31]: event_trigger  (rw)
   // [23:16]: dram_end_addr  (ro)
   // [15:8]:  dram_base_addr (ro)
   // [7:0]:   exit           (rw)
-  localparam logic [NumRegs-1:0][DataWidth-1:0] RegRstVal = '{
+  localparam logic [NumBaseRegs-1:0][DataWidth-1:0] BaseRegRstVal = '{
     0,
     0,
     DRAMBaseAddr + DRAMLength,
     DRAMBaseAddr,
     0
   };
-  localparam logic [NumRegs-1:0][DataWidthInBytes-1:0] AxiReadOnly = '{
+  localparam logic [NumBaseRegs-1:0][DataWidthInBytes-1:0] BaseAxiReadOnly = '{
     ReadWriteReg,
     ReadWriteReg,
     ReadOnlyReg,
@@ -63,6 +69,16 @@ module ctrl_registers #(
     ReadWriteReg
   };
 
+  // The performance counters are read-only, and reloaded by the hardware every cycle
+  localparam logic [NumRegs-1:0][DataWidth-1:0] RegRstVal = {
+    {NrPerfCounters{DataWidth'(0)}},
+    BaseRegRstVal
+  };
+  localparam logic [NumRegs-1:0][DataWidthInBytes-1:0] AxiReadOnly = {
+    {NrPerfCounters{ReadOnlyReg}},
+    BaseAxiReadOnly
+  };
+
   /////////////////
   //  Registers  //
   /////////////////
@@ -75,6 +91,9 @@ module ctrl_registers #(
   logic [DataWidth-1:0] dram_end_address;
   logic [DataWidth-1:0] exit;
 
+  // The counters are read through the registers, perf_cnt_q is not used
+  logic [NrPerfCounters-1:0][DataWidth-1:0] perf_cnt, perf_cnt_q;
+
   axi_lite_regs #(
     .RegNumBytes (RegNumBytes    ),
     .AxiAddrWidth(AddrWidth      ),
@@ -84,19 +103,32 @@ module ctrl_registers #(
     .req_lite_t  (axi_lite_req_t ),
     .resp_lite_t (axi_lite_resp_t)
   ) i_axi_lite_regs (
-    .clk_i      (clk_i                                      ),
-    .rst_ni     (rst_ni                                     ),
-    .axi_req_i  (axi_lite_slave_req_i                       ),
-    .axi_resp_o (axi_lite_slave_resp_o                      ),
-    .wr_active_o(wr_active_d                                ),
-    .rd_active_o(/* Unused */                               ),
-    .reg_d_i    ('0                                         ),
-    .reg_load_i ('0                                         ),
-    .reg_q_o    ({hw_cnt_en, event_trigger, dram_end_address, dram_base_address, exit})
+    .clk_i      (clk_i                                             ),
+    .rst_ni     (rst_ni                                            ),
+    .axi_req_i  (axi_lite_slave_req_i                              ),
+    .axi_resp_o (axi_lite_slave_resp_o                             ),
+    .wr_active_o(wr_active_d                                       ),
+    .rd_active_o(/* Unused */                                      ),
+    .reg_d_i    ({perf_cnt, {BaseRegNumBytes{8'h00}}}              ),
+    .reg_load_i ({{PerfRegNumBytes{1'b1}}, {BaseRegNumBytes{1'b0}}}),
+    .reg_q_o    ({perf_cnt_q, hw_cnt_en, event_trigger, dram_end_address, dram_base_address, exit})
   );
 
   `FF(wr_active_q, wr_active_d, '0);
 
+  ////////////////////////////
+  //  Performance counters  //
+  ////////////////////////////
+
+  ara_perf_counters #(
+    .CntWidth(DataWidth)
+  ) i_ara_perf_counters (
+    .clk_i (clk_i   ),
+    .rst_ni(rst_ni  ),
+    .perf_i(perf_i  ),
+    .cnt_o (perf_cnt)
+  );
+
   /////////////////
   //   Signals   //
   /////////////////
@@ -0,0 +1,136 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Arbiter between the requesters of a banked memory, and its NrBanks banks. The words are
+// interleaved over the banks by the low bits of their index. Every bank serves one request per
+// cycle, chosen round-robin among the requesters that target it, and the other ones wait for
+// their grant: the requesters going to different banks are served in parallel.
+// The banks answer one cycle after the request. Every granted request, also a write, gets a
+// response, returned to its requester in order.
+
+module l2_bank_arbiter #(
+    // Number of requesters
+    parameter  int unsigned NrPorts   = 1,
+    // Number of banks, a power of two
+    parameter  int unsigned NrBanks   = 1,
+    // Words of the memory, and their width
+    parameter  int unsigned NumWords  = 1024,
+    parameter  int unsigned DataWidth = 64,
+    // Dependant parameters. DO NOT CHANGE!
+    localparam type         addr_t    = logic [$clog2(NumWords)-1:0],
+    localparam type         data_t    = logic [DataWidth-1:0],
+    localparam type         strb_t    = logic [DataWidth/8-1:0]
+  ) (
+    input  logic                 clk_i,
+    input  logic                 rst_ni,
+    // Requesters, with word addresses
+    input  logic  [NrPorts-1:0]  req_i,
+    output logic  [NrPorts-1:0]  gnt_o,
+    input  logic  [NrPorts-1:0]  we_i,
+    input  addr_t [NrPorts-1:0]  addr_i,
+    input  strb_t [NrPorts-1:0]  be_i,
+    input  data_t [NrPorts-1:0]  wdata_i,
+    output logic  [NrPorts-1:0]  rvalid_o,
+    output data_t [NrPorts-1:0]  rdata_o,
+    // Banks, with word addresses
+    output logic  [NrBanks-1:0]  bank_req_o,
+    output logic  [NrBanks-1:0]  bank_we_o,
+    output addr_t [NrBanks-1:0]  bank_addr_o,
+    output strb_t [NrBanks-1:0]  bank_be_o,
+    output data_t [NrBanks-1:0]  bank_wdata_o,
+    input  data_t [NrBanks-1:0]  bank_rdata_i,
+    // Requests waiting for a bank served to another requester
+    output logic  [NrPorts-1:0]  conflict_o
+  );
+
+  import cf_math_pkg::idx_width;
+
+  `include "common_cells/registers.svh"
+
+  typedef logic [idx_width(NrBanks)-1:0] bank_t;
+
+  typedef struct packed {
+    logic  we;
+    addr_t addr;
+    strb_t be;
+    data_t wdata;
+  } payload_t;
+
+  payload_t [NrPorts-1:0] payload;
+  bank_t    [NrPorts-1:0] bank;
+
+  for (genvar p = 0; p < NrPorts; p++) begin : gen_payload
+    assign payload[p] = '{we: we_i[p], addr: addr_i[p], be: be_i[p], wdata: wdata_i[p]};
+    assign bank[p]    = NrBanks > 1 ? bank_t'(addr_i[p]) : '0;
+  end : gen_payload
+
+  /////////////////
+  //  Arbiters   //
+  /////////////////
+
+  // Requests and grants of every bank
+  logic [NrBanks-1:0][NrPorts-1:0] bank_port_req, bank_port_gnt;
+
+  always_comb begin : p_bank_req
+    bank_port_req = '0;
+    gnt_o         = '0;
+
+    for (int unsigned p = 0; p < NrPorts; p++)
+      bank_port_req[bank[p]][p] = req_i[p];
+    for (int unsigned b = 0; b < NrBanks; b++)
+      gnt_o |= bank_port_gnt[b];
+  end : p_bank_req
+
+  assign conflict_o = req_i & ~gnt_o;
+
+  // The banks are always ready
+  for (genvar b = 0; b < NrBanks; b++) begin : gen_bank_arbiters
+    payload_t bank_payload;
+
+    rr_arb_tree #(
+      .NumIn    (NrPorts          ),
+      .DataWidth($bits(payload_t) ),
+      .AxiVldRdy(1'b0             )
+    ) i_bank_arbiter (
+      .clk_i  (clk_i              ),
+      .rst_ni (rst_ni             ),
+      .flush_i(1'b0               ),
+      .rr_i   ('0                 ),
+      .data_i (payload            ),
+      .req_i  (bank_port_req[b]   ),
+      .gnt_o  (bank_port_gnt[b]   ),
+      .data_o (bank_payload       ),
+      .idx_o  (/* Unused */       ),
+      .req_o  (bank_req_o[b]      ),
+      .gnt_i  (1'b1               )
+    );
+
+    assign bank_we_o[b]    = bank_payload.we;
+    assign bank_addr_o[b]  = bank_payload.addr;
+    assign bank_be_o[b]    = bank_payload.be;
+    assign bank_wdata_o[b] = bank_payload.wdata;
+  end : gen_bank_arbiters
+
+  /////////////////
+  //  Responses  //
+  /////////////////
+
+  // Bank of the request granted in the previous cycle
+  bank_t [NrPorts-1:0] bank_q;
+
+  `FF(rvalid_o, gnt_o, '0);
+  `FF(bank_q, bank, '0);
+
+  for (genvar p = 0; p < NrPorts; p++) begin : gen_rdata
+    assign rdata_o[p] = bank_rdata_i[bank_q[p]];
+  end : gen_rdata
+
+  if (NrBanks == 0 || (NrBanks & (NrBanks - 1)) != 0)
+    $error("[l2_bank_arbiter] NrBanks must be a power of two.");
+
+  if (NrBanks > NumWords)
+    $error("[l2_bank_arbiter] There cannot be more banks than words.");
+
+endmodule : l2_bank_arbiter
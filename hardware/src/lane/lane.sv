@@ -17,8 +17,16 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     parameter  fpu_support_e          FPUSupport            = FPUSupportHalfSingleDouble,
     // External support for vfrec7, vfrsqrt7
     parameter  fpext_support_e        FPExtSupport          = FPExtSupportEnable,
+    // Support for the widening dot product vfwdotp
+    parameter  fdotp_support_e        FDotpSupport          = FDotpSupportEnable,
     // Support for fixed-point data types
     parameter  fixpt_support_e        FixPtSupport          = FixedPointEnable,
+    // Low-latency path for the scalar moves out of the VRF
+    parameter  bit                    ScalarFastPath        = 1'b0,
+    // Chain the consumers of a load on the VRF words it wrote
+    parameter  bit                    LoadChaining          = 1'b0,
+    // Number of serial dividers of the SIMD divider
+    parameter  int           unsigned NrDivUnits            = 1,
     // To please Verilator
     parameter  int           unsigned pe_req_t_bits         = 0,
     parameter  int           unsigned pe_resp_t_bits        = 0,
@@ -106,7 +114,10 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     // Interface between the Mask unit and the VFUs
     input  strb_t                                          mask_i,
     input  logic                                           mask_valid_i,
-    output logic                                           mask_ready_o
+    output logic                                           mask_ready_o,
+    // Performance events
+    output logic                [NrVRFBanksPerLane-1:0]    perf_bank_conflict_o,
+    output logic                [NrOperandQueues-1:0]      perf_opqueue_stall_o
   );
 
   `include "common_cells/registers.svh"
@@ -142,6 +153,7 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
 
     // Hazards
     logic [NrVInsn-1:0] hazard;
+    logic [NrVInsn-1:0] hazard_raw; // Hazards on the producers of this operand
   } operand_request_cmd_t;
 
   typedef struct packed {
@@ -149,6 +161,7 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     vlen_t elem_count;         // Vector body length
     opqueue_conversion_e conv; // Type conversion
     logic [1:0] ntr_red;       // Neutral type for reductions
+    logic alt_fmt;             // FP operands at EW16 are BF16
     logic is_reduct;           // Is this a reduction?
     target_fu_e target_fu;     // Target FU of the opqueue (if it is not clear)
   } operand_queue_cmd_t;
@@ -318,12 +331,14 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     .NrBanks              (NrVRFBanksPerLane    ),
     .vaddr_t              (vaddr_t              ),
     .operand_request_cmd_t(operand_request_cmd_t),
-    .operand_queue_cmd_t  (operand_queue_cmd_t  )
+    .operand_queue_cmd_t  (operand_queue_cmd_t  ),
+    .LoadChaining         (LoadChaining         )
   ) i_operand_requester (
     .clk_i                    (clk_i                   ),
     .rst_ni                   (rst_ni                  ),
     // Interface with the main sequencer
     .global_hazard_table_i    (global_hazard_table_i   ),
+    .vinsn_running_i          (pe_vinsn_running_i      ),
     // Interface with the lane sequencer
     .operand_request_i        (operand_request         ),
     .operand_request_valid_i  (operand_request_valid   ),
@@ -381,7 +396,10 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     .ldu_result_wdata_i       (ldu_result_wdata_i      ),
     .ldu_result_be_i          (ldu_result_be_i         ),
     .ldu_result_gnt_o         (ldu_result_gnt_o        ),
-    .ldu_result_final_gnt_o   (ldu_result_final_gnt_o  )
+    .ldu_result_final_gnt_o   (ldu_result_final_gnt_o  ),
+    // Performance events
+    .perf_bank_conflict_o     (perf_bank_conflict_o    ),
+    .perf_opqueue_stall_o     (perf_opqueue_stall_o    )
   );
 
   ////////////////////////////
@@ -436,6 +454,7 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     .NrLanes            (NrLanes            ),
     .VLEN               (VLEN               ),
     .FPUSupport         (FPUSupport         ),
+    .ScalarFastPath     (ScalarFastPath     ),
     .operand_queue_cmd_t(operand_queue_cmd_t)
   ) i_operand_queues (
     .clk_i                            (clk_i                              ),
@@ -497,7 +516,9 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     .CVA6Cfg        (CVA6Cfg        ),
     .FPUSupport     (FPUSupport     ),
     .FPExtSupport   (FPExtSupport   ),
+    .FDotpSupport   (FDotpSupport   ),
     .FixPtSupport   (FixPtSupport   ),
+    .NrDivUnits     (NrDivUnits     ),
     .vaddr_t        (vaddr_t        ),
     .vfu_operation_t(vfu_operation_t)
   ) i_vfus (
@@ -24,6 +24,8 @@ module operand_queue import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
     // Support neutral value filling
     parameter  logic                  SupportReduct       = 1'b0,
     parameter  logic                  SupportNtrVal       = 1'b0,
+    // The operands from the VRF go straight to the output when the buffer is empty
+    parameter  bit                    FallThrough         = 1'b0,
     parameter  type                   operand_queue_cmd_t = logic,
     // Dependant parameters. DO NOT CHANGE!
     localparam int           unsigned DataWidth      = $bits(elen_t),
@@ -94,8 +96,9 @@ module operand_queue import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
   logic  ibuf_pop;
 
   fifo_v3 #(
-    .DEPTH     (DataBufDepth),
-    .DATA_WIDTH(DataWidth   )
+    .FALL_THROUGH(FallThrough ),
+    .DEPTH       (DataBufDepth),
+    .DATA_WIDTH  (DataWidth   )
   ) i_input_buffer (
     .clk_i     (clk_i          ),
     .rst_ni    (rst_ni         ),
@@ -285,8 +288,8 @@ module operand_queue import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
               end
               EW16: begin
                 unique case (cmd.ntr_red)
-                  2'b01: ntr.w64 = {4{16'h7c00}};
-                  2'b10: ntr.w64 = {4{16'hfc00}};
+                  2'b01: ntr.w64 = cmd.alt_fmt ? {4{16'h7f80}} : {4{16'h7c00}};
+                  2'b10: ntr.w64 = cmd.alt_fmt ? {4{16'hff80}} : {4{16'hfc00}};
                   default:;
                 endcase
               end
@@ -411,7 +414,7 @@ module operand_queue import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
         end
       end
 
-      // Floating-Point re-encoding (not supported for alt-16 and alt-8)
+      // Floating-Point re-encoding (not supported for alt-8)
       OpQueueConversionWideFP2: begin
         if (FPUSupport != FPUSupportNone) begin
           unique casez ({cmd.eew, RVVBA(FPUSupport), RVVB(FPUSupport),
@@ -432,6 +435,10 @@ module operand_queue import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
                 fp16[e] = ibuf_operand[8*select + 32*e +: 16];
                 conv_operand[32*e +: 32] = fp32_from_fp16(fp16[e], fp16_m_lzc[e]);
               end
+              // BF16 is the upper half of an FP32
+              if (RVVHA(FPUSupport) && cmd.alt_fmt)
+                for (int e = 0; e < 2; e++)
+                  conv_operand[32*e +: 32] = {ibuf_operand[8*select + 32*e +: 16], 16'b0};
             end
             {EW32, 1'b?, 1'b?, 1'b?, 1'b?, 1'b1, 1'b1}: begin
               fp32 = ibuf_operand[8*select +: 32];
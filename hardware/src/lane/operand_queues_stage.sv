@@ -11,6 +11,8 @@ module operand_queues_stage import ara_pkg::*; import rvv_pkg::*; import cf_math
     parameter int     unsigned VLEN             = 0,
     // Support for floating-point data types
     parameter fpu_support_e FPUSupport          = FPUSupportHalfSingleDouble,
+    // Let the MaskB operands, e.g. the source of vmv.x.s, skip the queue's buffer
+    parameter bit           ScalarFastPath      = 1'b0,
     parameter type          operand_queue_cmd_t = logic
   ) (
     input  logic                                     clk_i,
@@ -283,6 +285,7 @@ module operand_queues_stage import ara_pkg::*; import rvv_pkg::*; import cf_math
     .SupportIntExt2     (1'b1                                          ),
     .SupportIntExt4     (1'b1                                          ),
     .SupportIntExt8     (1'b1                                          ),
+    .FallThrough        (ScalarFastPath                                ),
     .NrLanes            (NrLanes                                       ),
     .VLEN               (VLEN                                          ),
     .operand_queue_cmd_t(operand_queue_cmd_t                           )
@@ -7,6 +7,8 @@
 // This stage is responsible for requesting individual elements from the vector
 // register file, in order, and sending them to the corresponding operand
 // queues. This stage also includes the VRF arbiter.
+// With LoadChaining, the operands produced by a load are read as soon as the
+// VRF word they need was written in this lane (see the stall mechanism).
 
 module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
     parameter  int  unsigned NrLanes               = 0,
@@ -15,6 +17,8 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
     parameter  type          vaddr_t               = logic, // Type used to address vector register file elements
     parameter  type          operand_request_cmd_t = logic,
     parameter  type          operand_queue_cmd_t   = logic,
+    // Chain the operands on the VRF words written by the VLDU
+    parameter  bit           LoadChaining          = 1'b0,
     // Dependant parameters. DO NOT CHANGE!
     localparam type          strb_t  = logic[$bits(elen_t)/8-1:0],
     localparam type          vlen_t  = logic[$clog2(VLEN+1)-1:0]
@@ -23,6 +27,7 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
     input  logic                                       rst_ni,
     // Interface with the main sequencer
     input  logic            [NrVInsn-1:0][NrVInsn-1:0] global_hazard_table_i,
+    input  logic                         [NrVInsn-1:0] vinsn_running_i,
     // Interface with the lane sequencer
     input  operand_request_cmd_t [NrOperandQueues-1:0] operand_request_i,
     input  logic                 [NrOperandQueues-1:0] operand_request_valid_i,
@@ -80,7 +85,10 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
     input  elen_t                                      ldu_result_wdata_i,
     input  strb_t                                      ldu_result_be_i,
     output logic                                       ldu_result_gnt_o,
-    output logic                                       ldu_result_final_gnt_o
+    output logic                                       ldu_result_final_gnt_o,
+    // Performance events
+    output logic                 [NrBanks-1:0]         perf_bank_conflict_o,
+    output logic                 [NrOperandQueues-1:0] perf_opqueue_stall_o
   );
 
   import cf_math_pkg::idx_width;
@@ -204,6 +212,50 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
     end
   end
 
+  // The rate matching above lets a consumer of a load fall behind whenever it
+  // cannot read, e.g., on a full operand queue or on a bank conflict, and never
+  // catch up before the load is over. With LoadChaining, every load that wrote
+  // this lane keeps the range of VRF words it wrote so far: the VLDU writes the
+  // words of a lane in order, from the first one on. The operands that read the
+  // destination of the load (RAW hazards) wait for the word they need only.
+  logic   [NrVInsn-1:0] ldu_chain_q;
+  vaddr_t [NrVInsn-1:0] ldu_first_word_q, ldu_next_word_q;
+
+  if (LoadChaining) begin : gen_ldu_chain
+    logic   [NrVInsn-1:0] ldu_chain_d;
+    vaddr_t [NrVInsn-1:0] ldu_first_word_d, ldu_next_word_d;
+
+    always_comb begin : p_ldu_chain
+      // The IDs are reassigned once their instruction is over
+      ldu_chain_d      = ldu_chain_q & vinsn_running_i;
+      ldu_first_word_d = ldu_first_word_q;
+      ldu_next_word_d  = ldu_next_word_q;
+
+      if (ldu_result_gnt) begin
+        if (!ldu_chain_d[ldu_result_id])
+          ldu_first_word_d[ldu_result_id] = ldu_result_addr;
+        ldu_chain_d[ldu_result_id]     = 1'b1;
+        ldu_next_word_d[ldu_result_id] = ldu_result_addr + 1'b1;
+      end
+    end : p_ldu_chain
+
+    always_ff @(posedge clk_i or negedge rst_ni) begin : p_ldu_chain_ff
+      if (!rst_ni) begin
+        ldu_chain_q      <= '0;
+        ldu_first_word_q <= '0;
+        ldu_next_word_q  <= '0;
+      end else begin
+        ldu_chain_q      <= ldu_chain_d;
+        ldu_first_word_q <= ldu_first_word_d;
+        ldu_next_word_q  <= ldu_next_word_d;
+      end
+    end : p_ldu_chain_ff
+  end : gen_ldu_chain else begin : gen_no_ldu_chain
+    assign ldu_chain_q      = '0;
+    assign ldu_first_word_q = '0;
+    assign ldu_next_word_q  = '0;
+  end : gen_no_ldu_chain
+
   ///////////////////////
   //  Operand request  //
   ///////////////////////
@@ -248,6 +300,8 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
 
     // Hazards between vector instructions
     logic [NrVInsn-1:0] hazard;
+    // Subset of the hazards on the producers of this operand
+    logic [NrVInsn-1:0] hazard_raw;
 
     // Widening instructions produces two writes of every read
     // In case of a WAW with a previous instruction,
@@ -269,10 +323,20 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
 
     requester_metadata_t requester_metadata_d, requester_metadata_q;
 
+    // RAW hazards on loads that wrote this lane, and whether they wrote the word to read
+    logic [NrVInsn-1:0] ldu_chained, ldu_word_ready;
+
+    assign ldu_chained = requester_metadata_q.hazard_raw & ldu_chain_q;
+    for (genvar v = 0; v < NrVInsn; v++) begin : gen_ldu_word_ready
+      assign ldu_word_ready[v] = requester_metadata_q.addr >= ldu_first_word_q[v] &&
+                                 requester_metadata_q.addr <  ldu_next_word_q[v];
+    end : gen_ldu_word_ready
+
     // Is there a hazard during this cycle?
     logic stall;
-    assign stall = |(requester_metadata_q.hazard & ~(vinsn_result_written_q &
-                   (~{NrVInsn{requester_metadata_q.is_widening}} | requester_metadata_q.waw_hazard_counter)));
+    assign stall = |(requester_metadata_q.hazard & ~ldu_chained & ~(vinsn_result_written_q &
+                   (~{NrVInsn{requester_metadata_q.is_widening}} | requester_metadata_q.waw_hazard_counter))) ||
+                   |(ldu_chained & ~ldu_word_ready);
 
     // Did we get a grant?
     logic [NrBanks-1:0] operand_requester_gnt;
@@ -344,6 +408,7 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
         len         : effective_vector_body_length,
         vew         : operand_request_i[requester_index].eew,
         hazard      : operand_request_i[requester_index].hazard,
+        hazard_raw  : operand_request_i[requester_index].hazard_raw,
         is_widening : operand_request_i[requester_index].cvt_resize == CVT_WIDE,
         default: '0
       };
@@ -352,6 +417,7 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
         elem_count: effective_vector_body_length,
         conv      : operand_request_i[requester_index].conv,
         ntr_red   : operand_request_i[requester_index].cvt_resize,
+        alt_fmt   : operand_request_i[requester_index].vtype.altfmt,
         target_fu : operand_request_i[requester_index].target_fu,
         is_reduct : operand_request_i[requester_index].is_reduct
       };
@@ -463,6 +529,7 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
       endcase
       // Always keep the hazard bits up to date with the global hazard table
       requester_metadata_d.hazard &= global_hazard_table_i[requester_metadata_d.id];
+      requester_metadata_d.hazard_raw &= requester_metadata_d.hazard;
 
       // Kill all store-unit, idx, and mem-masked requests in case of exceptions
       if (lsu_ex_flush_o && (requester_index == StA || requester_index == SlideAddrGenA || requester_index == MaskM)) begin : vlsu_exception_idle
@@ -486,6 +553,10 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
         requester_metadata_q <= requester_metadata_d;
       end
     end
+
+    // The requester has elements left to read, but its operand queue is full
+    assign perf_opqueue_stall_o[requester_index] = (state_q == REQUESTING) &&
+                                                   !operand_queue_ready_i[requester_index];
   end : gen_operand_requester
 
   ////////////////
@@ -572,6 +643,13 @@ module operand_requester import ara_pkg::*; import rvv_pkg::*; #(
     end
   end
 
+  // More than one master requests the same bank
+  for (genvar bank = 0; bank < NrBanks; bank++) begin: gen_perf_bank_conflict
+    logic [NrMasters-1:0] bank_req;
+    assign bank_req                   = {ext_operand_req[bank], lane_operand_req[bank]};
+    assign perf_bank_conflict_o[bank] = |(bank_req & (bank_req - 1'b1));
+  end: gen_perf_bank_conflict
+
   // Instantiate a RR arbiter per bank
   for (genvar bank = 0; bank < NrBanks; bank++) begin: gen_vrf_arbiters
     // High-priority requests
@@ -4,12 +4,18 @@
 //
 // Author: Matteo Perotti <mperotti@iis.ee.ethz.ch>
 // Description:
-// Ara's Serial Divider, operating on elements 64-bit wide.
-// The unit serializes the whole computation, so it cannot parallelize sub-64-bit arithmetic.
-
-module simd_div import ara_pkg::*; import rvv_pkg::*; #(
+// Ara's SIMD Divider, operating on elements 64-bit wide.
+// The elements of the 64-bit words are computed by NrDivUnits serial dividers (serdiv). Up to
+// NrDivUnits words are in flight: their elements are issued in order to the first free divider,
+// and the results are written back in place, so that the sub-64-bit elements of a word and the
+// elements of different words are computed in parallel. The words are committed in order.
+// With NrDivUnits == 1, one element is computed at a time.
+
+module simd_div import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width; #(
     // CVA6 configuration
-    parameter  config_pkg::cva6_cfg_t CVA6Cfg = cva6_config_pkg::cva6_cfg,
+    parameter  config_pkg::cva6_cfg_t CVA6Cfg    = cva6_config_pkg::cva6_cfg,
+    // Number of serial dividers, and of 64-bit words in flight
+    parameter  int           unsigned NrDivUnits = 1,
     // Dependant parameters. DO NOT CHANGE!
     localparam int  unsigned DataWidth = $bits(elen_t),
     localparam int  unsigned StrbWidth = DataWidth/8,
@@ -35,364 +41,258 @@ module simd_div import ara_pkg::*; import rvv_pkg::*; #(
   //  Definitions  //
   ///////////////////
 
-  // The issue CU accepts new requests and issue the operands to the serial divider (serdiv)
-  // It handles the input ready_o signal and the serdiv_in_valid
-  // When the main handshake is complete, it loads the issue counter and commit counter to track
-  // how many elements should be issued and committed.
-  // Then, it validates the valid input operands and skips the invalid ones
-  // When all the operands have been issued, it waits until the whole result is formed before
-  // accepting another external request, as vew_q is used by the serdiv output MUX and
-  // should therefore remain stable until the end
-  typedef enum logic [2:0] {ISSUE_IDLE, LOAD, ISSUE_VALID, ISSUE_SKIP, WAIT_DONE} issue_state_t;
-  // The commit CU stores the various serdiv results in the result buffer
-  // It handles the valid_o signal and the serdiv_out_ready
-  // After the issue CU has accepted a new request, the commit CU tracks how many operands
-  // should be still committed and which results to skip
-  // When the whole result is complete, it asserts the valid_o and waits until the result is
-  // accepted before committing new data
-  typedef enum logic [1:0] {COMMIT_IDLE, COMMIT_READY, COMMIT_SKIP, COMMIT_DONE} commit_state_t;
-
-  issue_state_t  issue_state_d, issue_state_q;
-  commit_state_t commit_state_d, commit_state_q;
-
-  // Input registers, buffers for the input operands and related data
-  // Kept stable until the complete 64-bit result is formed
   typedef union packed {
     logic [0:0][63:0] w64;
     logic [1:0][31:0] w32;
     logic [3:0][15:0] w16;
     logic [7:0][ 7:0] w8;
   } operand_t;
-  operand_t opa_d, opa_q, opb_d, opb_q;
-  vew_e     vew_d, vew_q;
-  ara_op_e  op_d, op_q;
-  strb_t    be_d, be_q;
-  // Output buffer, directly linked to result_o
-  elen_t    result_d, result_q;
-  assign result_o = result_q;
-  // Mask buffer, directly linked to mask_o
-  strb_t mask_d, mask_q;
-  assign mask_o = mask_q;
 
-  // Counters
-  logic       load_cnt, issue_cnt_en, commit_cnt_en;
-  logic [2:0] cnt_init_val, issue_cnt_d, issue_cnt_q, commit_cnt_d, commit_cnt_q;
+  // Index of a word in flight, and of an element within a word
+  typedef logic [idx_width(NrDivUnits)-1:0] slot_t;
+  typedef logic [2:0]                       elem_t;
+  // Elements of a word still to be completed
+  typedef logic [3:0]                       elem_cnt_t;
+
+  // Words in flight. The operands are kept stable until all their elements are issued, and the
+  // results are assembled in place.
+  typedef struct packed {
+    operand_t  opa;
+    operand_t  opb;
+    ara_op_e   op;
+    vew_e      vew;
+    strb_t     be;
+    strb_t     mask;
+    operand_t  result;
+    // Elements not completed yet
+    elem_cnt_t pending;
+  } word_t;
+
+  word_t [NrDivUnits-1:0] word_d, word_q;
+  logic  [NrDivUnits-1:0] word_valid_d, word_valid_q;
+  // Words with elements still to be issued
+  logic  [NrDivUnits-1:0] word_issue_d, word_issue_q;
+
+  // The words are accepted at the write pointer, issued at the issue pointer, and committed at the
+  // read pointer
+  slot_t wr_pnt_d, wr_pnt_q;
+  slot_t iss_pnt_d, iss_pnt_q;
+  slot_t rd_pnt_d, rd_pnt_q;
+  // Next element to issue of the word at the issue pointer
+  elem_t iss_elem_d, iss_elem_q;
+
+  // Number of elements in a word
+  function automatic elem_cnt_t nr_elems(vew_e vew);
+    nr_elems = elem_cnt_t'(1) << (int'(EW64) - int'(vew));
+  endfunction : nr_elems
+
+  // Select one byte/halfword/word/dword of an operand, and fill it with zeroes/sign extend it
+  function automatic elen_t extend(operand_t op, elem_t idx, vew_e vew, logic sign);
+    unique case (vew)
+      EW8    : extend = {{56{sign & op.w8 [idx     ][ 7]}}, op.w8 [idx     ]};
+      EW16   : extend = {{48{sign & op.w16[idx[1:0]][15]}}, op.w16[idx[1:0]]};
+      EW32   : extend = {{32{sign & op.w32[idx[0:0]][31]}}, op.w32[idx[0:0]]};
+      default: extend = op.w64;
+    endcase
+  endfunction : extend
+
+  // Serial Dividers
+  logic  [NrDivUnits-1:0]      serdiv_in_valid, serdiv_in_ready, serdiv_out_valid;
+  logic  [NrDivUnits-1:0][1:0] serdiv_opcode;
+  elen_t [NrDivUnits-1:0]      serdiv_opa, serdiv_opb;
+  elen_t [NrDivUnits-1:0]      serdiv_result;
 
-  // Serial Divider
-  logic           serdiv_out_ready, serdiv_out_valid, serdiv_in_valid, serdiv_in_ready;
-  logic     [1:0] serdiv_opcode;
-  elen_t          serdiv_opa, serdiv_opb;
-  operand_t       serdiv_result;
+  // Word and element computed by each divider
+  logic  [NrDivUnits-1:0] unit_busy_d, unit_busy_q;
+  slot_t [NrDivUnits-1:0] unit_slot_d, unit_slot_q;
+  elem_t [NrDivUnits-1:0] unit_elem_d, unit_elem_q;
 
-  // Partially processed data
-  elen_t    opa_w8, opb_w8, opa_w16, opb_w16, opa_w32, opb_w32, opa_w64, opb_w64;
-  operand_t serdiv_result_masked, shifted_result;
+  ///////////////
+  //  Outputs  //
+  ///////////////
 
-  ////////////////////////
-  //  In/Out registers  //
-  ////////////////////////
+  // The word at the read pointer is complete
+  assign valid_o  = word_valid_q[rd_pnt_q] && word_q[rd_pnt_q].pending == '0;
+  assign result_o = word_q[rd_pnt_q].result;
+  assign mask_o   = word_q[rd_pnt_q].mask;
 
-  // Input registers
-  assign opa_d  = (valid_i && ready_o) ? operand_a_i : opa_q;
-  assign opb_d  = (valid_i && ready_o) ? operand_b_i : opb_q;
-  assign vew_d  = (valid_i && ready_o) ? vew_i       : vew_q;
-  assign op_d   = (valid_i && ready_o) ? op_i        : op_q;
-  assign be_d   = (valid_i && ready_o) ? be_i        : be_q;
-  assign mask_d = (valid_i && ready_o) ? mask_i      : mask_q;
+  // Accept a new word if there is a free slot
+  assign ready_o = !word_valid_q[wr_pnt_q];
 
   ///////////////
   //  Control  //
   ///////////////
 
-  // Issue CU
-  always_comb begin : issue_cu_p
-    ready_o         = 1'b0;
-    load_cnt        = 1'b0;
-    serdiv_in_valid = 1'b0;
-    issue_cnt_en    = 1'b0;
-    issue_state_d   = issue_state_q;
-
-    case (issue_state_q)
-      ISSUE_IDLE: begin
-        // We can accept a new request from the external environment
-        ready_o       = 1'b1;
-        issue_state_d = valid_i ? LOAD : ISSUE_IDLE;
-      end
-      LOAD: begin
-        // The request was accepted: load how many elements to process/commit
-        load_cnt      = 1'b1;
-        // Check if the next byte is valid or not. If not, skip it.
-        issue_state_d = (be_q[cnt_init_val << vew_q]) ? ISSUE_VALID : ISSUE_SKIP;
-      end
-      ISSUE_VALID: begin
-        // The inputs are valid
-        serdiv_in_valid = 1'b1;
-        // Count down when these inputs are consumed by the serdiv
-        issue_cnt_en    = (serdiv_in_valid && serdiv_in_ready) ? 1'b1 : 1'b0;
-        // Change state only when the serdiv accepts the operands
-        if (serdiv_in_valid && serdiv_in_ready) begin
-          // If we are issuing the last operands, wait for the whole result to be completed
-          if (issue_cnt_q == '0) begin
-            issue_state_d = WAIT_DONE;
-          // If we are not issuing the last operands, decide if to process or skip the next byte
-          end else begin
-            issue_state_d = (be_q[issue_cnt_d << vew_q]) ? ISSUE_VALID : ISSUE_SKIP;
-          end
-        end
-      end
-      ISSUE_SKIP: begin
-        // Skip the invalid inputs
-        issue_cnt_en = 1'b1;
-        // If we are issuing the last operands, wait for the whole result to be completed
-        if (issue_cnt_q == '0) begin
-          issue_state_d = WAIT_DONE;
-        // If we are not issuing the last operands, decide if to process or skip the next byte
-        end else begin
-          issue_state_d = (be_q[issue_cnt_d << vew_q]) ? ISSUE_VALID : ISSUE_SKIP;
-        end
-      end
-      WAIT_DONE: begin
-        // Wait for the entire 64-bit result to be created
-        // We need vew_q stable when serdiv_result is produced
-        issue_state_d = valid_o ? ISSUE_IDLE : WAIT_DONE;
+  always_comb begin : p_div_control
+    // The element to issue, and its word
+    automatic word_t iss_word  = word_q[iss_pnt_q];
+    automatic logic  iss_valid = word_issue_q[iss_pnt_q];
+    // An element was dispatched, or skipped, in this cycle
+    automatic logic  iss_done  = 1'b0;
+    // Has a divider been selected?
+    automatic logic  unit_sel  = 1'b0;
+
+    word_d       = word_q;
+    word_valid_d = word_valid_q;
+    word_issue_d = word_issue_q;
+    wr_pnt_d     = wr_pnt_q;
+    iss_pnt_d    = iss_pnt_q;
+    rd_pnt_d     = rd_pnt_q;
+    iss_elem_d   = iss_elem_q;
+    unit_busy_d  = unit_busy_q;
+    unit_slot_d  = unit_slot_q;
+    unit_elem_d  = unit_elem_q;
+
+    serdiv_in_valid = '0;
+    serdiv_opa      = '0;
+    serdiv_opb      = '0;
+    serdiv_opcode   = '0;
+
+    // Collect the results of the dividers, and write them in place
+    for (int unsigned u = 0; u < NrDivUnits; u++) begin
+      if (unit_busy_q[u] && serdiv_out_valid[u]) begin
+        automatic slot_t s = unit_slot_q[u];
+        automatic elem_t e = unit_elem_q[u];
+
+        unique case (word_q[s].vew)
+          EW8    : word_d[s].result.w8 [e     ] = serdiv_result[u][ 7:0];
+          EW16   : word_d[s].result.w16[e[1:0]] = serdiv_result[u][15:0];
+          EW32   : word_d[s].result.w32[e[0:0]] = serdiv_result[u][31:0];
+          default: word_d[s].result.w64       = serdiv_result[u];
+        endcase
+        word_d[s].pending -= 1;
+        unit_busy_d[u]     = 1'b0;
       end
-      default: begin
-        issue_state_d = ISSUE_IDLE;
-      end
-    endcase
-  end
-
-  // Commit CU
-  always_comb begin : commit_cu_p
-    valid_o          = 1'b0;
-    serdiv_out_ready = 1'b0;
-    commit_cnt_en    = 1'b0;
-    commit_state_d   = commit_state_q;
+    end
 
-    case (commit_state_q)
-      COMMIT_IDLE: begin
-        // Start if the issue CU has already started
-        if (issue_state_q != ISSUE_IDLE) begin
-          commit_state_d = (be_q[cnt_init_val << vew_q]) ? COMMIT_READY : COMMIT_SKIP;
-        end
-      end
-      COMMIT_READY: begin
-        serdiv_out_ready = 1'b1;
-        commit_cnt_en    = (serdiv_out_valid && serdiv_out_ready) ? 1'b1 : 1'b0;
-        // Change state only when the serdiv produce a valid result
-        if (serdiv_out_valid && serdiv_out_ready) begin
-          // If we are committing the last result, complete the execution
-          if (commit_cnt_q == '0) begin
-            commit_state_d = COMMIT_DONE;
-          // If we are not committing the last result, decide if to process or skip the next one
-          end else begin
-            commit_state_d = (be_q[commit_cnt_d << vew_q]) ? COMMIT_READY : COMMIT_SKIP;
+    // Issue the next element of the word at the issue pointer
+    if (iss_valid) begin
+      if (!iss_word.be[iss_elem_q << iss_word.vew]) begin
+        // Skip the masked-off element: its result stays zero
+        word_d[iss_pnt_q].pending -= 1;
+        iss_done = 1'b1;
+      end else begin
+        // Dispatch it to the first free divider
+        for (int unsigned u = 0; u < NrDivUnits; u++) begin
+          if (!unit_sel && !unit_busy_q[u]) begin
+            unit_sel           = 1'b1;
+            serdiv_in_valid[u] = 1'b1;
+            serdiv_opa[u]      = extend(iss_word.opa, iss_elem_q, iss_word.vew,
+                                   iss_word.op inside {VDIV, VREM});
+            serdiv_opb[u]      = extend(iss_word.opb, iss_elem_q, iss_word.vew,
+                                   iss_word.op inside {VDIV, VREM});
+            unique case (iss_word.op)
+              VDIVU  : serdiv_opcode[u] = 2'b00;
+              VDIV   : serdiv_opcode[u] = 2'b01;
+              VREMU  : serdiv_opcode[u] = 2'b10;
+              VREM   : serdiv_opcode[u] = 2'b11;
+              default: serdiv_opcode[u] = 2'b00;
+            endcase
+
+            if (serdiv_in_ready[u]) begin
+              unit_busy_d[u] = 1'b1;
+              unit_slot_d[u] = iss_pnt_q;
+              unit_elem_d[u] = iss_elem_q;
+              iss_done       = 1'b1;
+            end
           end
         end
       end
-      COMMIT_SKIP: begin
-        commit_cnt_en    = 1'b1;
-        // If we are skipping the last result, complete the execution
-        if (commit_cnt_q == '0) begin
-          commit_state_d = COMMIT_DONE;
-        // If we are not committing the last result, decide if to process or skip the next one
+
+      // Move to the next element, or to the next word
+      if (iss_done) begin
+        if (elem_cnt_t'(iss_elem_q) == nr_elems(iss_word.vew) - 1) begin
+          word_issue_d[iss_pnt_q] = 1'b0;
+          iss_elem_d              = '0;
+          iss_pnt_d               = (iss_pnt_q == slot_t'(NrDivUnits - 1)) ? '0 : iss_pnt_q + 1;
         end else begin
-          commit_state_d = (be_q[commit_cnt_d << vew_q]) ? COMMIT_READY : COMMIT_SKIP;
+          iss_elem_d              = iss_elem_q + 1;
         end
       end
-      COMMIT_DONE: begin
-        // The 64-bit result is complete, validate it
-        valid_o        = 1'b1;
-        commit_state_d = ready_i ? COMMIT_IDLE : COMMIT_DONE;
-      end
-      default: begin
-        commit_state_d = COMMIT_IDLE;
-      end
-    endcase
-  end
-
-  // Counters
-  // issue_cnt  counts how many elements should still be issued, and controls the first wall of
-  // MUXes
-  // commit_cnt counts how many elements should still be committed
-  always_comb begin
-    issue_cnt_d  = issue_cnt_q;
-    commit_cnt_d = commit_cnt_q;
-    cnt_init_val = '0;
-
-    // Track how many elements we should process (load #elements-1)
-    case (vew_q)
-      EW8 : cnt_init_val = 3'h7;
-      EW16: cnt_init_val = 3'h3;
-      EW32: cnt_init_val = 3'h1;
-      EW64: cnt_init_val = 3'h0;
-    endcase
-    // Load the initial number of elements to process (i.e., also the number of results to collect)
-    if (load_cnt) begin
-      issue_cnt_d  = cnt_init_val;
-      commit_cnt_d = cnt_init_val;
     end
 
-    // Count down when serdiv accepts one couple of operands or when they are invalid
-    if (issue_cnt_en) issue_cnt_d -= 1;
-    // Count down when serdiv produce one result or when it is invalid
-    if (commit_cnt_en) commit_cnt_d -= 1;
-  end
+    // Commit the word at the read pointer
+    if (valid_o && ready_i) begin
+      word_valid_d[rd_pnt_q] = 1'b0;
+      rd_pnt_d               = (rd_pnt_q == slot_t'(NrDivUnits - 1)) ? '0 : rd_pnt_q + 1;
+    end
 
-  // Opcode selection
-  always_comb begin
-    case (op_q)
-      VDIVU: serdiv_opcode   = 2'b00;
-      VDIV : serdiv_opcode   = 2'b01;
-      VREMU: serdiv_opcode   = 2'b10;
-      VREM : serdiv_opcode   = 2'b11;
-      default: serdiv_opcode = 2'b00;
-    endcase
-  end
+    // Accept a new word
+    if (valid_i && ready_o) begin
+      word_d[wr_pnt_q] = '{
+        opa    : operand_a_i,
+        opb    : operand_b_i,
+        op     : op_i,
+        vew    : vew_i,
+        be     : be_i,
+        mask   : mask_i,
+        result : '0,
+        pending: nr_elems(vew_i)
+      };
+      word_valid_d[wr_pnt_q] = 1'b1;
+      word_issue_d[wr_pnt_q] = 1'b1;
+      wr_pnt_d               = (wr_pnt_q == slot_t'(NrDivUnits - 1)) ? '0 : wr_pnt_q + 1;
+    end
+  end : p_div_control
 
   ////////////////
   //  Datapath  //
   ////////////////
 
-  // serdiv input MUXes
-  always_comb begin
-    // First wall of MUXes: select one byte/halfword/word/dword from the inputs and fill it with
-    // zeroes/sign extend it
-    opa_w8 = op_q inside {VDIV, VREM} ?
-      {{56{opa_q.w8 [issue_cnt_q[2:0]][ 7]}}, opa_q.w8 [issue_cnt_q[2:0]]} :
-      {56'b0, opa_q.w8 [issue_cnt_q[2:0]]};
-    opb_w8 = op_q inside {VDIV, VREM} ?
-      {{56{opb_q.w8 [issue_cnt_q[2:0]][ 7]}}, opb_q.w8 [issue_cnt_q[2:0]]} :
-      {56'b0, opb_q.w8 [issue_cnt_q[2:0]]};
-
-    opa_w16 = op_q inside {VDIV, VREM} ?
-      {{48{opa_q.w16[issue_cnt_q[1:0]][15]}}, opa_q.w16[issue_cnt_q[1:0]]} :
-      {48'b0, opa_q.w16[issue_cnt_q[1:0]]};
-    opb_w16 = op_q inside {VDIV, VREM} ?
-      {{48{opb_q.w16[issue_cnt_q[1:0]][15]}}, opb_q.w16[issue_cnt_q[1:0]]} :
-      {48'b0, opb_q.w16[issue_cnt_q[1:0]]};
-
-    opa_w32 = op_q inside {VDIV, VREM} ?
-      {{32{opa_q.w32[issue_cnt_q[0:0]][31]}}, opa_q.w32[issue_cnt_q[0:0]]} :
-      {32'b0, opa_q.w32[issue_cnt_q[0:0]]};
-    opb_w32 = op_q inside {VDIV, VREM} ?
-      {{32{opb_q.w32[issue_cnt_q[0:0]][31]}}, opb_q.w32[issue_cnt_q[0:0]]} :
-      {32'b0, opb_q.w32[issue_cnt_q[0:0]]};
-
-    opa_w64 = opa_q.w64;
-    opb_w64 = opb_q.w64;
-
-    // Last 64-bit wide selection MUX
-    unique case (vew_q)
-      EW8: begin
-        serdiv_opa = opa_w8;
-        serdiv_opb = opb_w8;
-      end
-      EW16: begin
-        serdiv_opa = opa_w16;
-        serdiv_opb = opb_w16;
-      end
-      EW32: begin
-        serdiv_opa = opa_w32;
-        serdiv_opb = opb_w32;
-      end
-      EW64: begin
-        serdiv_opa = opa_w64;
-        serdiv_opb = opb_w64;
-      end
-      default: begin
-        // Don't care
-        serdiv_opa = 'x;
-        serdiv_opb = 'x;
-      end
-    endcase
-  end
-
-  // Serial divider
-  serdiv #(
-    .CVA6Cfg         (CVA6Cfg),
-    .WIDTH           (ELEN   ),
-    .STABLE_HANDSHAKE(1      )
-  ) i_serdiv (
-    .clk_i    (clk_i            ),
-    .rst_ni   (rst_ni           ),
-    .id_i     ('0               ),
-    .op_a_i   (serdiv_opa       ),
-    .op_b_i   (serdiv_opb       ),
-    .opcode_i (serdiv_opcode    ),
-    .in_vld_i (serdiv_in_valid  ),
-    .in_rdy_o (serdiv_in_ready  ),
-    .flush_i  (1'b0             ),
-    .out_vld_o(serdiv_out_valid ),
-    .out_rdy_i(serdiv_out_ready ),
-    .id_o     (/* unconnected */),
-    .res_o    (serdiv_result    )
-  );
-
-  // Output buffer
-  // Shift the partial result and update the output buffer with the new masked byte/halfword/word
-  // If we are skipping an element, just shift
-  always_comb begin
-    if (commit_state_q == COMMIT_SKIP) begin
-      shifted_result       = result_q << (8 << vew_q);
-      serdiv_result_masked = '0;
-    end else begin
-      case (vew_q)
-        EW8: begin
-          shifted_result       = result_q << 8;
-          serdiv_result_masked = {56'b0, serdiv_result.w8[0]};
-        end
-        EW16: begin
-          shifted_result       = result_q << 16;
-          serdiv_result_masked = {48'b0, serdiv_result.w16[0]};
-        end
-        EW32: begin
-          shifted_result       = result_q << 32;
-          serdiv_result_masked = {32'b0, serdiv_result.w32[0]};
-        end
-        default: begin
-          shifted_result       = '0;
-          serdiv_result_masked = serdiv_result;
-        end
-      endcase
-    end
-  end
-  assign result_d = (commit_cnt_en) ? (shifted_result | serdiv_result_masked) : result_q;
+  for (genvar u = 0; u < NrDivUnits; u++) begin : gen_serdiv
+    // The results are always accepted, as their word has a slot
+    serdiv #(
+      .CVA6Cfg         (CVA6Cfg),
+      .WIDTH           (ELEN   ),
+      .STABLE_HANDSHAKE(1      )
+    ) i_serdiv (
+      .clk_i    (clk_i              ),
+      .rst_ni   (rst_ni             ),
+      .id_i     ('0                 ),
+      .op_a_i   (serdiv_opa[u]      ),
+      .op_b_i   (serdiv_opb[u]      ),
+      .opcode_i (serdiv_opcode[u]   ),
+      .in_vld_i (serdiv_in_valid[u] ),
+      .in_rdy_o (serdiv_in_ready[u] ),
+      .flush_i  (1'b0               ),
+      .out_vld_o(serdiv_out_valid[u]),
+      .out_rdy_i(unit_busy_q[u]     ),
+      .id_o     (/* unconnected */  ),
+      .res_o    (serdiv_result[u]   )
+    );
+  end : gen_serdiv
 
   //////////////////////////////
   //  Sequential assignments  //
   //////////////////////////////
 
-  // In/Out CUs sequential process
   always_ff @(posedge clk_i or negedge rst_ni) begin
     if (!rst_ni) begin
-      issue_state_q  <= ISSUE_IDLE;
-      commit_state_q <= COMMIT_IDLE;
-
-      opa_q    <= '0;
-      opb_q    <= '0;
-      vew_q    <= EW8;
-      op_q     <= VDIV;
-      be_q     <= '0;
-      mask_q   <= '0;
-      result_q <= '0;
-
-      issue_cnt_q  <= '0;
-      commit_cnt_q <= '0;
+      word_q       <= '0;
+      word_valid_q <= '0;
+      word_issue_q <= '0;
+      wr_pnt_q     <= '0;
+      iss_pnt_q    <= '0;
+      rd_pnt_q     <= '0;
+      iss_elem_q   <= '0;
+      unit_busy_q  <= '0;
+      unit_slot_q  <= '0;
+      unit_elem_q  <= '0;
     end else begin
-      issue_state_q  <= issue_state_d;
-      commit_state_q <= commit_state_d;
-
-      opa_q    <= opa_d;
-      opb_q    <= opb_d;
-      vew_q    <= vew_d;
-      op_q     <= op_d;
-      be_q     <= be_d;
-      mask_q   <= mask_d;
-      result_q <= result_d;
-
-      issue_cnt_q  <= issue_cnt_d;
-      commit_cnt_q <= commit_cnt_d;
+      word_q       <= word_d;
+      word_valid_q <= word_valid_d;
+      word_issue_q <= word_issue_d;
+      wr_pnt_q     <= wr_pnt_d;
+      iss_pnt_q    <= iss_pnt_d;
+      rd_pnt_q     <= rd_pnt_d;
+      iss_elem_q   <= iss_elem_d;
+      unit_busy_q  <= unit_busy_d;
+      unit_slot_q  <= unit_slot_d;
+      unit_elem_q  <= unit_elem_d;
     end
   end
+
+  if (NrDivUnits == 0 || NrDivUnits > 8)
+    $error("[simd_div] NrDivUnits must be between 1 and 8.");
+
 endmodule : simd_div
@@ -282,8 +282,8 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
   //    reduction_rx_cnt_init = '0;
   //    for (int i = 2; i <= NrLanes; i *= 2) if (!(adjusted_idx % i)) reduction_rx_cnt_init++;
   //  endfunction: reduction_rx_cnt_init
-  // Otherwise, use the following function (okay until 16 lanes)
-  function automatic reduction_rx_cnt_t reduction_rx_cnt_init(int unsigned NrLanes, logic [3:0] lane_id);
+  // Otherwise, use the following function (okay until 32 lanes)
+  function automatic reduction_rx_cnt_t reduction_rx_cnt_init(int unsigned NrLanes, logic [4:0] lane_id);
      // The even lanes do not receive intermediate results. Only Lane 0 will receive the final result, but this is not checked here.
      case (lane_id)
       0:  reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
@@ -302,6 +302,22 @@ module valu import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width;
       13: reduction_rx_cnt_init = reduction_rx_cnt_t'(1);
       14: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
       15: reduction_rx_cnt_init = reduction_rx_cnt_t'(4);
+      16: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      17: reduction_rx_cnt_init = reduction_rx_cnt_t'(1);
+      18: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      19: reduction_rx_cnt_init = reduction_rx_cnt_t'(2);
+      20: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      21: reduction_rx_cnt_init = reduction_rx_cnt_t'(1);
+      22: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      23: reduction_rx_cnt_init = reduction_rx_cnt_t'(3);
+      24: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      25: reduction_rx_cnt_init = reduction_rx_cnt_t'(1);
+      26: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      27: reduction_rx_cnt_init = reduction_rx_cnt_t'(2);
+      28: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      29: reduction_rx_cnt_init = reduction_rx_cnt_t'(1);
+      30: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      31: reduction_rx_cnt_init = reduction_rx_cnt_t'(5);
     endcase
   endfunction: reduction_rx_cnt_init
 
@@ -15,8 +15,12 @@ module vector_fus_stage import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg
     parameter  fpu_support_e          FPUSupport      = FPUSupportHalfSingleDouble,
     // External support for vfrec7, vfrsqrt7
     parameter  fpext_support_e        FPExtSupport    = FPExtSupportEnable,
+    // Support for the widening dot product vfwdotp
+    parameter  fdotp_support_e        FDotpSupport    = FDotpSupportEnable,
     // Support for fixed-point data types
     parameter  fixpt_support_e        FixPtSupport    = FixedPointEnable,
+    // Number of serial dividers of the SIMD divider
+    parameter  int           unsigned NrDivUnits      = 1,
     // Type used to address vector register file elements
     parameter  type                   vaddr_t         = logic,
     parameter  type                   vfu_operation_t = logic,
@@ -161,7 +165,9 @@ module vector_fus_stage import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg
     .CVA6Cfg        (CVA6Cfg        ),
     .FPUSupport     (FPUSupport     ),
     .FPExtSupport   (FPExtSupport   ),
+    .FDotpSupport   (FDotpSupport   ),
     .FixPtSupport   (FixPtSupport   ),
+    .NrDivUnits     (NrDivUnits     ),
     .vaddr_t        (vaddr_t        ),
     .vfu_operation_t(vfu_operation_t)
   ) i_vmfpu (
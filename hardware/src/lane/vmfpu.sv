@@ -16,8 +16,12 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
     parameter  fpu_support_e          FPUSupport      = FPUSupportHalfSingleDouble,
     // External support for vfrec7, vfrsqrt7, rounding-toward-odd
     parameter  fpext_support_e        FPExtSupport    = FPExtSupportEnable,
+    // Support for the widening dot product vfwdotp
+    parameter  fdotp_support_e        FDotpSupport    = FDotpSupportEnable,
     // Support for fixed-point data types
     parameter  fixpt_support_e        FixPtSupport    = FixedPointEnable,
+    // Number of serial dividers of the SIMD divider
+    parameter  int           unsigned NrDivUnits      = 1,
     // Type used to address vector register file elements
     parameter  type                   vaddr_t         = logic,
     parameter  type                   vfu_operation_t = logic,
@@ -208,6 +212,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
       [VFREDMIN:VFREDMAX]:    fpu_latency = LatFNonComp;
       [VFCVTXUF:VFCVTFF]:     fpu_latency = LatFConv;
       [VFMIN:VFSGNJX]:        fpu_latency = LatFNonComp;
+      VFWDOTP:                fpu_latency = LatFDotp;
       default: begin
         case (sew)
           EW64:    fpu_latency = LatFCompEW64;
@@ -544,7 +549,8 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
   strb_t vdiv_mask;
 
   simd_div # (
-    .CVA6Cfg(CVA6Cfg)
+    .CVA6Cfg   (CVA6Cfg   ),
+    .NrDivUnits(NrDivUnits)
   ) i_simd_div (
     .clk_i      (clk_i                                                      ),
     .rst_ni     (rst_ni                                                     ),
@@ -725,7 +731,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
   endfunction : processed_osum_operand
 
   // Use this function to assign a counter value to each lane if you can use in-lane parameters with your flow
-  function automatic reduction_rx_cnt_t reduction_rx_cnt_init(int unsigned NrLanes, logic [3:0] lane_id);
+  function automatic reduction_rx_cnt_t reduction_rx_cnt_init(int unsigned NrLanes, logic [4:0] lane_id);
     // The even lanes do not receive intermediate results. Only Lane 0 will receive the final result, but this is not checked here.
     case (lane_id)
       0:  reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
@@ -744,6 +750,22 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
       13: reduction_rx_cnt_init = reduction_rx_cnt_t'(1);
       14: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
       15: reduction_rx_cnt_init = reduction_rx_cnt_t'(4);
+      16: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      17: reduction_rx_cnt_init = reduction_rx_cnt_t'(1);
+      18: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      19: reduction_rx_cnt_init = reduction_rx_cnt_t'(2);
+      20: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      21: reduction_rx_cnt_init = reduction_rx_cnt_t'(1);
+      22: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      23: reduction_rx_cnt_init = reduction_rx_cnt_t'(3);
+      24: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      25: reduction_rx_cnt_init = reduction_rx_cnt_t'(1);
+      26: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      27: reduction_rx_cnt_init = reduction_rx_cnt_t'(2);
+      28: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      29: reduction_rx_cnt_init = reduction_rx_cnt_t'(1);
+      30: reduction_rx_cnt_init = reduction_rx_cnt_t'(0);
+      31: reduction_rx_cnt_init = reduction_rx_cnt_t'(5);
     endcase
   endfunction: reduction_rx_cnt_init
 
@@ -864,7 +886,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
         '{default: MERGED},   // DIVSQRT
         '{default: PARALLEL}, // NONCOMP
         '{default: MERGED}, // CONV
-        '{default: DISABLED}}, // DOTP
+        '{default: FDotpSupport ? MERGED : DISABLED}}, // DOTP
       PipeConfig: DISTRIBUTED
     };
 
@@ -997,6 +1019,8 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
           fp_rm    = RTZ;
         end
         VFCVTFF: fp_op = F2F;
+        // Each source element is a pair of floats of half the width of the destination
+        VFWDOTP: fp_op = SDOTP;
         VFNCVTRODFF: begin
           fp_op = F2F;
           fp_rm = ROD;
@@ -1008,7 +1032,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
           // positive infinity
           case (vinsn_issue_q.vtype.vsew)
             EW8: if (RVVB(FPUSupport) || RVVBA(FPUSupport)) ntr_val = {8{8'h78}};
-            EW16: ntr_val = {4{16'h7c00}};
+            EW16: ntr_val = vinsn_issue_q.vtype.altfmt ? {4{16'h7f80}} : {4{16'h7c00}};
             EW32: ntr_val = {2{32'h7f800000}};
             default: // EW64
               ntr_val = 64'h7ff0000000000000;
@@ -1020,7 +1044,7 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
           // negative infinity
           case (vinsn_issue_q.vtype.vsew)
             EW8: if (RVVB(FPUSupport) || RVVBA(FPUSupport)) ntr_val = {8{8'hf8}};
-            EW16: ntr_val = {4{16'hfc00}};
+            EW16: ntr_val = vinsn_issue_q.vtype.altfmt ? {4{16'hff80}} : {4{16'hfc00}};
             EW32: ntr_val = {2{32'hff800000}};
             default: // EW64
               ntr_val = 64'hfff0000000000000;
@@ -1062,6 +1086,16 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
         end
         default:;
       endcase
+
+      // vfwdotp multiplies the halves of the source elements
+      if (vinsn_issue_q.op == VFWDOTP)
+        fp_src_fmt = (vinsn_issue_q.vtype.vsew == EW16) ? FP8 : FP16;
+
+      // With vtype.altfmt, the 16-bit FP operands, narrow or wide, are BF16
+      if (RVVHA(FPUSupport) && vinsn_issue_q.vtype.altfmt) begin
+        if (fp_src_fmt == FP16) fp_src_fmt = FP16ALT;
+        if (fp_dst_fmt == FP16) fp_dst_fmt = FP16ALT;
+      end
     end : fpu_operand_preprocessing_p
 
     // FPU signals
@@ -2329,6 +2363,10 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
                 vinsn_queue_d.vinsn[vinsn_queue_q.accept_pnt].scalar_op[32*e +: 32] =
                   fp32_from_fp16(fp16[e], fp16_m_lzc[e]);
               end
+              // BF16 is the upper half of an FP32
+              if (RVVHA(FPUSupport) && vfu_operation_i.vtype.altfmt)
+                vinsn_queue_d.vinsn[vinsn_queue_q.accept_pnt].scalar_op =
+                  {2{vinsn_queue_d.vinsn[vinsn_queue_q.accept_pnt].scalar_op[15:0], 16'b0}};
             end
             {EW64, 1'b?, 1'b?, 1'b1, 1'b1}: begin
               fp32 = vinsn_queue_d.vinsn[vinsn_queue_q.accept_pnt].scalar_op[31:0];
@@ -16,6 +16,9 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
     parameter  type          vaddr_t   = logic, // Type used to address vector register file elements
     parameter  type          pe_req_t  = logic,
     parameter  type          pe_resp_t = logic,
+    // Send the scalar results of vcpop/vfirst to the sequencer in the cycle they are computed,
+    // instead of one cycle later from the scalar result register
+    parameter  bit           ScalarFastPath = 1'b0,
     // Dependant parameters. DO NOT CHANGE!
     localparam int  unsigned DataWidth = $bits(elen_t), // Width of the lane datapath
     localparam int  unsigned StrbWidth = DataWidth/8,
@@ -615,19 +618,29 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
   //// Scalar result reg  ////
   ////////////////////////////
 
-  elen_t result_scalar_d;
-  logic  result_scalar_valid_d;
+  elen_t result_scalar_d, result_scalar_q;
+  logic  result_scalar_valid_d, result_scalar_valid_q;
 
   always_ff @(posedge clk_i or negedge rst_ni) begin
     if (!rst_ni) begin
-      result_scalar_o       <= '0;
-      result_scalar_valid_o <= '0;
+      result_scalar_q       <= '0;
+      result_scalar_valid_q <= '0;
     end else begin
-      result_scalar_o       <= result_scalar_d;
-      result_scalar_valid_o <= result_scalar_valid_d;
+      result_scalar_q       <= result_scalar_d;
+      result_scalar_valid_q <= result_scalar_valid_d;
     end
   end
 
+  if (ScalarFastPath) begin : gen_scalar_fast_path
+    // The sequencer waits for the result, and always takes it
+    assign result_scalar_o       = result_scalar_d;
+    assign result_scalar_valid_o = out_scalar_valid;
+  end : gen_scalar_fast_path
+  else begin : gen_scalar_reg
+    assign result_scalar_o       = result_scalar_q;
+    assign result_scalar_valid_o = result_scalar_valid_q;
+  end : gen_scalar_reg
+
   ////////////////
   //  Mask ALU  //
   ////////////////
@@ -939,8 +952,8 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
     pe_req_ready_o = !vinsn_queue_full;
 
     // scalar path signals
-    result_scalar_d       = result_scalar_o;
-    result_scalar_valid_d = result_scalar_valid_o;
+    result_scalar_d       = result_scalar_q;
+    result_scalar_valid_d = result_scalar_valid_q;
 
     // Don't handshake the inputs
     in_ready_cnt_en   = 1'b0;
@@ -1484,7 +1497,7 @@ module masku import ara_pkg::*; import rvv_pkg::*; #(
 
     // This is one cycle after asserting out_scalar_valid
     // Ara's frontend is always ready to accept the scalar result
-    if (result_scalar_valid_o) begin
+    if (result_scalar_valid_q) begin
       // Reset result_scalar
       result_scalar_d       = '0;
       result_scalar_valid_d = '0;
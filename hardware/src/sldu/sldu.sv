@@ -10,6 +10,8 @@
 module sldu import ara_pkg::*; import rvv_pkg::*; #(
     parameter  int  unsigned NrLanes   = 0,
     parameter  int  unsigned VLEN      = 0,
+    // Lanes of a cluster of the slide datapath, past 16 lanes
+    parameter  int  unsigned LanesPerCluster = 4,
     parameter  type          vaddr_t   = logic, // Type used to address vector register file elements,
     parameter  type          pe_req_t  = logic,
     parameter  type          pe_resp_t = logic,
@@ -315,6 +317,8 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
   // Input/output non-flat operands
   elen_t [NrLanes-1:0] sld_op_src;
   elen_t [NrLanes-1:0] sld_op_dst;
+  // The operands are valid, the slid operands are valid, and the operands are popped
+  logic sld_op_src_valid, sld_op_dst_valid, sld_op_pop;
 
   // Input and output eew for reshuffling
   rvv_pkg::vew_e sld_eew_src;
@@ -326,15 +330,24 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
   // The SLDU slides by powers of two
   logic [idx_width(4*NrLanes):0] sld_slamt;
 
+  assign sld_op_src_valid = &sldu_operand_valid;
+  assign sld_op_pop       = sldu_operand_valid[0] && sldu_operand_ready[0];
+
   sldu_op_dp #(
-    .NrLanes  (NrLanes    )
+    .NrLanes        (NrLanes        ),
+    .LanesPerCluster(LanesPerCluster)
   ) i_sldu_op_dp (
-    .op_i     (sld_op_src ),
-    .slamt_i  (sld_slamt  ),
-    .eew_src_i(sld_eew_src),
-    .eew_dst_i(sld_eew_dst),
-    .dir_i    (sld_dir    ),
-    .op_o     (sld_op_dst )
+    .clk_i    (clk_i           ),
+    .rst_ni   (rst_ni          ),
+    .op_i     (sld_op_src      ),
+    .valid_i  (sld_op_src_valid),
+    .pop_i    (sld_op_pop      ),
+    .slamt_i  (sld_slamt       ),
+    .eew_src_i(sld_eew_src     ),
+    .eew_dst_i(sld_eew_dst     ),
+    .dir_i    (sld_dir         ),
+    .op_o     (sld_op_dst      ),
+    .valid_o  (sld_op_dst_valid)
   );
 
   //////////////////
@@ -514,7 +527,7 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
       SLIDE_RUN, SLIDE_RUN_VSLIDE1UP_FIRST_WORD, SLIDE_NP2_COMMIT: begin
         // Are we ready?
         // During a reduction (vinsn_issue_q.vfu == VFU_Alu/VFU_MFPU) don't wait for mask bits
-        if ((&sldu_operand_valid ||
+        if ((sld_op_dst_valid ||
            (((vinsn_issue_q.stride[$bits(vinsn_issue_q.vl)-1:0] >> vinsn_issue_q.vtype.vsew) >= vinsn_issue_q.vl) &&
            (state_q == SLIDE_RUN_VSLIDE1UP_FIRST_WORD))) &&
            !result_queue_full && (vinsn_issue_q.vm || vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu} || (|mask_valid_q)))
@@ -745,7 +758,7 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
         // Setup the current p2 stride
         sld_slamt = p2_stride_gen_stride_q;
         // Slide the operands as soon as valid
-        if (&sldu_operand_valid) begin
+        if (sld_op_dst_valid) begin
           for (int unsigned l = 0; l < NrLanes; l++)
             result_queue_d[result_queue_write_pnt_q][l].wdata = sld_op_dst[l];
           slide_np2_buf_valid_d = 1'b1;
@@ -5,21 +5,31 @@
 // Author: Matteo Perotti <mperotti@iis.ee.ethz.ch>
 // Description:
 // Ara's optimized SLDU datapath.
+// Up to 16 lanes, the permutations are tabulated, and the result is valid with the operand. With
+// more lanes, see sldu_op_dp_cluster.
 // Cannot reshuffle AND slide at the same time.
 
 module sldu_op_dp import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width; #(
     parameter int unsigned NrLanes = 0,
+    // Lanes of a cluster of sldu_op_dp_cluster, past 16 lanes
+    parameter int unsigned LanesPerCluster = 4,
     // Dependant parameters. DO NOT CHANGE!
     localparam int  unsigned DataWidth = $bits(elen_t), // Width of the lane datapath
     localparam int  unsigned StrbWidth = DataWidth/8,
     localparam type          strb_t    = logic [StrbWidth-1:0] // Byte-strobe type
   ) (
+    input  logic                                     clk_i,
+    input  logic                                     rst_ni,
     input  elen_t                      [NrLanes-1:0] op_i,
+    // op_i is valid, and stays stable until popped
+    input  logic                                     valid_i,
+    input  logic                                     pop_i,
     input  logic            [idx_width(4*NrLanes):0] slamt_i,
     input  rvv_pkg::vew_e                            eew_src_i,
     input  rvv_pkg::vew_e                            eew_dst_i,
     input  logic                                     dir_i,
-    output elen_t                      [NrLanes-1:0] op_o
+    output elen_t                      [NrLanes-1:0] op_o,
+    output logic                                     valid_o
 );
 
 logic [$bits(op_i)-1:0] op_i_flat;
@@ -28,6 +38,10 @@ logic [$bits(op_o)-1:0] op_o_flat;
 assign op_i_flat = op_i;
 assign op_o      = op_o_flat;
 
+// The tables are combinational
+if (NrLanes <= 16)
+  assign valid_o = valid_i;
+
 if (NrLanes == 1)
   always_comb begin
     unique case ({eew_src_i, eew_dst_i, slamt_i, dir_i})
@@ -16810,7 +16824,25 @@ else if (NrLanes == 16)
       default: op_o_flat = op_i_flat;
     endcase
   end
+else if (NrLanes == 32)
+  // The tables do not scale further: compute the permutations, with the lanes in clusters
+  sldu_op_dp_cluster #(
+    .NrLanes        (NrLanes        ),
+    .LanesPerCluster(LanesPerCluster)
+  ) i_sldu_op_dp_cluster (
+    .clk_i    (clk_i    ),
+    .rst_ni   (rst_ni   ),
+    .op_i     (op_i     ),
+    .valid_i  (valid_i  ),
+    .pop_i    (pop_i    ),
+    .slamt_i  (slamt_i  ),
+    .eew_src_i(eew_src_i),
+    .eew_dst_i(eew_dst_i),
+    .dir_i    (dir_i    ),
+    .op_o     (op_o_flat),
+    .valid_o  (valid_o  )
+  );
 else
-  $error("Error. Allowed NrLanes values are 1, 2, 4, 8, or 16");
+  $error("Error. Allowed NrLanes values are 1, 2, 4, 8, 16, or 32");
 
 endmodule
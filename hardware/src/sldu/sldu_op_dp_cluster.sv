@@ -0,0 +1,191 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Ara's SLDU datapath for more than 16 lanes, with the lanes grouped in clusters.
+// Same interface and behavior as sldu_op_dp, whose tables do not scale past 16 lanes. The
+// permutations are computed from the VRF byte layout instead (see shuffle_index in ara_pkg).
+//
+// A power-of-two slide moves whole 64-bit words between lanes, and then rotates the elements
+// within each word. The lane rotation is hierarchical:
+// - Slides by less than LanesPerCluster lanes stay within a cluster, or cross to the neighbouring
+//   cluster on its link. These are the slides of the first steps of the inter-lane reductions.
+// - Longer slides keep the lane position within the cluster, and move whole clusters by a
+//   power-of-two distance on the cluster interconnect. This hop is registered: the words of an
+//   operand are sampled in its first valid cycle, and valid_o rises one cycle later. The sampled
+//   words are kept until the operand is popped, or the slide changes.
+// The reshuffles are a byte-level permutation across all the lanes.
+// Cannot reshuffle AND slide at the same time.
+
+module sldu_op_dp_cluster import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::idx_width; #(
+    parameter int unsigned NrLanes         = 0,
+    // Number of lanes of a cluster
+    parameter int unsigned LanesPerCluster = 4,
+    // Dependant parameters. DO NOT CHANGE!
+    localparam int unsigned NrClusters     = NrLanes / LanesPerCluster
+  ) (
+    input  logic                                     clk_i,
+    input  logic                                     rst_ni,
+    input  elen_t                      [NrLanes-1:0] op_i,
+    // op_i is valid, and stays stable until popped
+    input  logic                                     valid_i,
+    input  logic                                     pop_i,
+    input  logic            [idx_width(4*NrLanes):0] slamt_i,
+    input  rvv_pkg::vew_e                            eew_src_i,
+    input  rvv_pkg::vew_e                            eew_dst_i,
+    input  logic                                     dir_i,
+    output elen_t                      [NrLanes-1:0] op_o,
+    output logic                                     valid_o
+);
+
+  `include "common_cells/registers.svh"
+
+  ///////////////////
+  //  VRF layout   //
+  ///////////////////
+
+  // Reverse the lower width bits of k
+  function automatic int unsigned bitrev(int unsigned k, int unsigned width);
+    bitrev = 0;
+    for (int unsigned i = 0; i < width; i++)
+      bitrev |= ((k >> i) & 1) << (width - 1 - i);
+  endfunction : bitrev
+
+  // Position in the lanes of the byte b of naturally packed elements of width 2^ew bytes. Element
+  // e goes to lane e % NrLanes, at the bit-reversed position e / NrLanes within the 64-bit word.
+  function automatic int unsigned shuffle(int unsigned b, int unsigned ew);
+    automatic int unsigned e = b >> ew;
+    return 8 * (e % NrLanes) + (bitrev(e / NrLanes, 3 - ew) << ew) + (b & ((1 << ew) - 1));
+  endfunction : shuffle
+
+  // Inverse of shuffle
+  function automatic int unsigned deshuffle(int unsigned p, int unsigned ew);
+    automatic int unsigned k = bitrev((p % 8) >> ew, 3 - ew);
+    return ((k * NrLanes + p / 8) << ew) + (p & ((1 << ew) - 1));
+  endfunction : deshuffle
+
+  /////////////////
+  //  Reshuffle  //
+  /////////////////
+
+  logic [8*NrLanes-1:0][7:0] op_i_bytes, reshuffle_bytes;
+
+  assign op_i_bytes = op_i;
+
+  // The destination byte p holds the natural byte deshuffle(p, eew_dst), taken from where it is
+  // with the source EEW
+  always_comb begin : p_reshuffle
+    reshuffle_bytes = op_i_bytes;
+
+    for (int unsigned es = 0; es < 4; es++)
+      for (int unsigned ed = 0; ed < 4; ed++)
+        if (eew_src_i == vew_e'(es) && eew_dst_i == vew_e'(ed) && es != ed)
+          for (int unsigned p = 0; p < 8*NrLanes; p++)
+            reshuffle_bytes[p] = op_i_bytes[shuffle(deshuffle(p, ed), es)];
+  end : p_reshuffle
+
+  /////////////
+  //  Slide  //
+  /////////////
+
+  // The slide amount (in elements) is a power of two. Split it into a distance in lanes, and a
+  // distance in elements within a lane.
+  logic [idx_width(NrLanes)-1:0] dist_lanes;
+  logic [2:0]                    dist_rows;
+
+  assign dist_lanes = slamt_i[idx_width(NrLanes)-1:0];
+  assign dist_rows  = 3'(slamt_i >> idx_width(NrLanes));
+
+  // The slide moves whole clusters
+  logic hop;
+
+  assign hop = slamt_i != '0 && dist_lanes >= LanesPerCluster;
+
+  // Words after the lane rotation, and the lanes whose word wrapped around the last lane
+  elen_t [NrLanes-1:0] rotated, hop_d, hop_q;
+  logic  [NrLanes-1:0] wrapped;
+
+  always_comb begin : p_lane_rotation
+    for (int unsigned l = 0; l < NrLanes; l++) begin
+      automatic int unsigned c = l / LanesPerCluster;
+      automatic int unsigned p = l % LanesPerCluster;
+
+      rotated[l] = op_i[l];
+      hop_d[l]   = op_i[l];
+      wrapped[l] = dir_i ? (l < dist_lanes) : (l + dist_lanes >= NrLanes);
+
+      // Within the cluster, or from the neighbouring one
+      for (int unsigned d = 1; d < LanesPerCluster; d <<= 1)
+        if (dist_lanes == d)
+          rotated[l] = dir_i ? op_i[(l + NrLanes - d) % NrLanes] : op_i[(l + d) % NrLanes];
+
+      // From the same position of another cluster
+      for (int unsigned d = 1; d < NrClusters; d <<= 1)
+        if (dist_lanes == d * LanesPerCluster)
+          hop_d[l] = dir_i ?
+            op_i[((c + NrClusters - d) % NrClusters) * LanesPerCluster + p] :
+            op_i[((c + d) % NrClusters) * LanesPerCluster + p];
+
+      if (hop)
+        rotated[l] = hop_q[l];
+    end
+  end : p_lane_rotation
+
+  // Cluster hop register, with the direction and the distance of the slide it holds
+  logic                          hop_valid_q, hop_dir_q, hop_hit;
+  logic [idx_width(NrLanes)-1:0] hop_dist_q;
+
+  assign hop_hit = hop_valid_q && hop_dir_q == dir_i && hop_dist_q == dist_lanes;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : p_hop
+    if (!rst_ni) begin
+      hop_valid_q <= 1'b0;
+      hop_dir_q   <= 1'b0;
+      hop_dist_q  <= '0;
+    end else if (pop_i)
+      hop_valid_q <= 1'b0;
+    else if (valid_i && hop && !hop_hit) begin
+      hop_valid_q <= 1'b1;
+      hop_dir_q   <= dir_i;
+      hop_dist_q  <= dist_lanes;
+    end
+  end : p_hop
+
+  `FFL(hop_q, hop_d, valid_i && hop && !hop_hit, '0);
+
+  assign valid_o = hop ? hop_hit : valid_i;
+
+  // Rotate the elements within each word. Element k of a lane (at the bit-reversed position k of
+  // the word) takes element k -/+ the row distance of the source word, one more if the word wrapped.
+  elen_t [NrLanes-1:0] slide;
+
+  always_comb begin : p_row_rotation
+    slide = rotated;
+
+    for (int unsigned l = 0; l < NrLanes; l++) begin
+      automatic logic [2:0] row_shift = dist_rows + wrapped[l];
+
+      for (int unsigned ew = 0; ew < 4; ew++)
+        if (eew_dst_i == vew_e'(ew))
+          for (int unsigned r = 0; r < 8; r++)
+            if (row_shift == r)
+              for (int unsigned q = 0; q < (8 >> ew); q++) begin
+                automatic int unsigned k_dst = bitrev(q, 3 - ew);
+                automatic int unsigned k_src = dir_i ?
+                  (k_dst + 8 - r) % (8 >> ew) :
+                  (k_dst + r) % (8 >> ew);
+                automatic int unsigned q_src = bitrev(k_src, 3 - ew);
+
+                for (int unsigned i = 0; i < (1 << ew); i++)
+                  slide[l][8*((q << ew) + i) +: 8] = rotated[l][8*((q_src << ew) + i) +: 8];
+              end
+    end
+  end : p_row_rotation
+
+  assign op_o = (slamt_i == '0) ? reshuffle_bytes : slide;
+
+  if (NrLanes % LanesPerCluster != 0 || NrClusters < 2 || (NrClusters & (NrClusters - 1)) != 0)
+    $error("[sldu_op_dp_cluster] NrLanes must be a power of two, and at least two clusters.");
+
+endmodule : sldu_op_dp_cluster
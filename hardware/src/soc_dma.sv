@@ -0,0 +1,347 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Ara's SoC DMA engine. Copies 2D blocks (reps rows of len bytes, rows strided in the source and
+// in the destination) through a 64-bit AXI4 master port, and is programmed through AXI-Lite
+// descriptor registers.
+// Writing the start register queues the descriptor held by the other registers, up to DescDepth
+// descriptors. The descriptors are executed in order, one at a time. The issued register counts the
+// queued descriptors, and the done register the executed ones, whose writes all got their B
+// response. Writes to start while the queue is full are dropped.
+// The read and the write bursts are generated independently, and split at the rows, at the 4 KiB
+// boundaries, and at BurstBeats beats. A read burst is only issued when the data buffer has room
+// for it, so that the R channel is never stalled.
+// The addresses, lengths, and strides must be multiples of 8 bytes. The length is rounded down to
+// whole 64-bit words when the descriptor is queued.
+
+module soc_dma #(
+    parameter int  unsigned AddrWidth       = 64,
+    // Number of queued descriptors
+    parameter int  unsigned DescDepth       = 4,
+    // Maximum length of a burst, in 64-bit beats
+    parameter int  unsigned BurstBeats      = 16,
+    // Outstanding write bursts
+    parameter int  unsigned MaxWriteTxns    = 4,
+    // AXI Structs
+    parameter type          axi_lite_req_t  = logic,
+    parameter type          axi_lite_resp_t = logic,
+    parameter type          axi_req_t       = logic,
+    parameter type          axi_resp_t      = logic
+  ) (
+    input  logic           clk_i,
+    input  logic           rst_ni,
+    // Descriptor registers
+    input  axi_lite_req_t  axi_lite_slave_req_i,
+    output axi_lite_resp_t axi_lite_slave_resp_o,
+    // Data mover
+    output axi_req_t       axi_req_o,
+    input  axi_resp_t      axi_resp_i
+  );
+
+  `include "common_cells/registers.svh"
+
+  ///////////////////
+  //  Definitions  //
+  ///////////////////
+
+  localparam int unsigned DataWidth        = 64;
+  localparam int unsigned DataWidthInBytes = DataWidth / 8;
+  localparam int unsigned NumRegs          = 10;
+  localparam int unsigned RegNumBytes      = NumRegs * DataWidthInBytes;
+  // Data buffer, two bursts deep
+  localparam int unsigned BufDepth         = 2 * BurstBeats;
+
+  localparam logic [DataWidthInBytes-1:0] ReadOnlyReg  = {DataWidthInBytes{1'b1}};
+  localparam logic [DataWidthInBytes-1:0] ReadWriteReg = {DataWidthInBytes{1'b0}};
+
+  typedef logic [AddrWidth-1:0]              addr_t;
+  typedef logic [DataWidth-1:0]              data_t;
+  typedef logic [$clog2(BurstBeats+1)-1:0]   beats_t;
+  typedef logic [$clog2(BufDepth+1)-1:0]     credits_t;
+
+  typedef struct packed {
+    addr_t src;
+    addr_t dst;
+    data_t len;
+    data_t src_stride;
+    data_t dst_stride;
+    data_t reps;
+  } desc_t;
+
+  // Memory map
+  // [79:72]: done       (ro), executed descriptors
+  // [71:64]: status     (ro), [0]: busy, [1]: descriptor queue full
+  // [63:56]: issued     (ro), queued descriptors
+  // [55:48]: start      (rw), a write queues the descriptor
+  // [47:40]: reps       (rw), number of rows
+  // [39:32]: dst_stride (rw)
+  // [31:24]: src_stride (rw)
+  // [23:16]: len        (rw), bytes per row
+  // [15:8]:  dst        (rw)
+  // [7:0]:   src        (rw)
+  localparam logic [NumRegs-1:0][DataWidthInBytes-1:0] AxiReadOnly = '{
+    ReadOnlyReg,
+    ReadOnlyReg,
+    ReadOnlyReg,
+    ReadWriteReg,
+    ReadWriteReg,
+    ReadWriteReg,
+    ReadWriteReg,
+    ReadWriteReg,
+    ReadWriteReg,
+    ReadWriteReg
+  };
+
+  /////////////////
+  //  Registers  //
+  /////////////////
+
+  logic [RegNumBytes-1:0] wr_active;
+
+  data_t done_cnt_q, status, issued_cnt_q;
+  // Read back by the registers only
+  data_t done_q, status_q, issued_q, start;
+  data_t reps, dst_stride, src_stride, len, dst, src;
+
+  axi_lite_regs #(
+    .RegNumBytes (RegNumBytes    ),
+    .AxiAddrWidth(AddrWidth      ),
+    .AxiDataWidth(DataWidth      ),
+    .AxiReadOnly (AxiReadOnly    ),
+    .RegRstVal   ('0             ),
+    .req_lite_t  (axi_lite_req_t ),
+    .resp_lite_t (axi_lite_resp_t)
+  ) i_axi_lite_regs (
+    .clk_i      (clk_i                                                         ),
+    .rst_ni     (rst_ni                                                        ),
+    .axi_req_i  (axi_lite_slave_req_i                                          ),
+    .axi_resp_o (axi_lite_slave_resp_o                                         ),
+    .wr_active_o(wr_active                                                     ),
+    .rd_active_o(/* Unused */                                                  ),
+    .reg_d_i    ({done_cnt_q, status, issued_cnt_q, {7*DataWidthInBytes{8'h00}}}),
+    .reg_load_i ({{3*DataWidthInBytes{1'b1}}, {7*DataWidthInBytes{1'b0}}}      ),
+    .reg_q_o    ({done_q, status_q, issued_q, start, reps, dst_stride, src_stride, len, dst,
+                  src}                                                         )
+  );
+
+  ///////////////////////
+  //  Descriptor queue //
+  ///////////////////////
+
+  desc_t desc_in, desc;
+  logic  desc_full, desc_empty, desc_push, desc_pop;
+
+  // The other registers were written by earlier transactions. A partial word would leave a last
+  // burst of zero beats in the row.
+  assign desc_in   = '{src: src, dst: dst, len: {len[DataWidth-1:3], 3'b000}, src_stride: src_stride,
+    dst_stride: dst_stride, reps: reps};
+  assign desc_push = |wr_active[6*DataWidthInBytes +: DataWidthInBytes] && !desc_full;
+
+  fifo_v3 #(
+    .DEPTH(DescDepth),
+    .dtype(desc_t   )
+  ) i_desc_queue (
+    .clk_i     (clk_i       ),
+    .rst_ni    (rst_ni      ),
+    .flush_i   (1'b0        ),
+    .testmode_i(1'b0        ),
+    .full_o    (desc_full   ),
+    .empty_o   (desc_empty  ),
+    .usage_o   (/* Unused */),
+    .data_i    (desc_in     ),
+    .push_i    (desc_push   ),
+    .data_o    (desc        ),
+    .pop_i     (desc_pop    )
+  );
+
+  //////////////////////
+  //  Burst splitting //
+  //////////////////////
+
+  // Beats of the next burst at addr, with left bytes left in the row
+  function automatic beats_t burst_beats(addr_t addr, data_t left);
+    automatic data_t beats = left >> 3;
+    automatic data_t page  = (13'h1000 - addr[11:0]) >> 3;
+    if (beats > page) beats = page;
+    if (beats > BurstBeats) beats = BurstBeats;
+    return beats_t'(beats);
+  endfunction : burst_beats
+
+  // A descriptor is active from its first cycle at the head of the queue
+  logic active_q;
+  // Read and write sides: start of the current row, offset within it, and rows left
+  addr_t rd_row_q, wr_row_q;
+  data_t rd_off_q, wr_off_q;
+  data_t rd_reps_q, wr_reps_q;
+  logic  rd_done, wr_done;
+
+  beats_t rd_beats, wr_beats;
+
+  assign rd_done  = rd_reps_q == '0;
+  assign wr_done  = wr_reps_q == '0;
+  assign rd_beats = burst_beats(rd_row_q + rd_off_q, desc.len - rd_off_q);
+  assign wr_beats = burst_beats(wr_row_q + wr_off_q, desc.len - wr_off_q);
+
+  ////////////////
+  //  AXI port  //
+  ////////////////
+
+  // Data buffer: free entries not claimed by a read burst
+  credits_t credits_q, credits_d;
+
+  logic  buf_full, buf_empty, buf_push, buf_pop;
+  data_t buf_data;
+
+  // Lengths of the issued write bursts, and beats sent of the oldest one
+  beats_t wlen;
+  logic   wlen_full, wlen_empty, wlen_push, wlen_pop;
+  beats_t w_cnt_q, w_cnt_d;
+
+  // Write bursts waiting for their B response
+  logic [$clog2(MaxWriteTxns+1)-1:0] b_pending_q, b_pending_d;
+
+  logic ar_hs, aw_hs, w_hs;
+
+  always_comb begin : p_axi
+    axi_req_o = '0;
+
+    // AR
+    axi_req_o.ar.addr  = rd_row_q + rd_off_q;
+    axi_req_o.ar.len   = rd_beats - 1;
+    axi_req_o.ar.size  = axi_pkg::size_t'($clog2(DataWidthInBytes));
+    axi_req_o.ar.burst = axi_pkg::BURST_INCR;
+    axi_req_o.ar.cache = axi_pkg::CACHE_MODIFIABLE;
+    axi_req_o.ar_valid = active_q && !rd_done && credits_q >= rd_beats;
+    ar_hs              = axi_req_o.ar_valid && axi_resp_i.ar_ready;
+
+    // R: the buffer has room for the whole burst
+    axi_req_o.r_ready = 1'b1;
+    buf_push          = axi_resp_i.r_valid;
+
+    // AW
+    axi_req_o.aw.addr  = wr_row_q + wr_off_q;
+    axi_req_o.aw.len   = wr_beats - 1;
+    axi_req_o.aw.size  = axi_pkg::size_t'($clog2(DataWidthInBytes));
+    axi_req_o.aw.burst = axi_pkg::BURST_INCR;
+    axi_req_o.aw.cache = axi_pkg::CACHE_MODIFIABLE;
+    axi_req_o.aw_valid = active_q && !wr_done && !wlen_full && b_pending_q < MaxWriteTxns;
+    aw_hs              = axi_req_o.aw_valid && axi_resp_i.aw_ready;
+    wlen_push          = aw_hs;
+
+    // W: the data of the oldest write burst, from the buffer
+    axi_req_o.w.data  = buf_data;
+    axi_req_o.w.strb  = '1;
+    axi_req_o.w.last  = w_cnt_q == wlen - 1;
+    axi_req_o.w_valid = !wlen_empty && !buf_empty;
+    w_hs              = axi_req_o.w_valid && axi_resp_i.w_ready;
+    buf_pop           = w_hs;
+    wlen_pop          = w_hs && axi_req_o.w.last;
+    w_cnt_d           = w_hs ? (axi_req_o.w.last ? '0 : w_cnt_q + 1) : w_cnt_q;
+
+    // B
+    axi_req_o.b_ready = 1'b1;
+    b_pending_d       = b_pending_q + aw_hs - axi_resp_i.b_valid;
+
+    credits_d = credits_q + w_hs - (ar_hs ? rd_beats : '0);
+  end : p_axi
+
+  fifo_v3 #(
+    .DEPTH(BufDepth),
+    .dtype(data_t  )
+  ) i_data_buffer (
+    .clk_i     (clk_i             ),
+    .rst_ni    (rst_ni            ),
+    .flush_i   (1'b0              ),
+    .testmode_i(1'b0              ),
+    .full_o    (buf_full          ),
+    .empty_o   (buf_empty         ),
+    .usage_o   (/* Unused */      ),
+    .data_i    (axi_resp_i.r.data ),
+    .push_i    (buf_push          ),
+    .data_o    (buf_data          ),
+    .pop_i     (buf_pop           )
+  );
+
+  fifo_v3 #(
+    .DEPTH(MaxWriteTxns),
+    .dtype(beats_t     )
+  ) i_wlen_queue (
+    .clk_i     (clk_i       ),
+    .rst_ni    (rst_ni      ),
+    .flush_i   (1'b0        ),
+    .testmode_i(1'b0        ),
+    .full_o    (wlen_full   ),
+    .empty_o   (wlen_empty  ),
+    .usage_o   (/* Unused */),
+    .data_i    (wr_beats    ),
+    .push_i    (wlen_push   ),
+    .data_o    (wlen        ),
+    .pop_i     (wlen_pop    )
+  );
+
+  //////////////////
+  //  Sequencing  //
+  //////////////////
+
+  // The descriptor is done once all its writes were acknowledged
+  assign desc_pop = active_q && rd_done && wr_done && wlen_empty && b_pending_q == '0;
+  assign status   = data_t'({desc_full, !desc_empty});
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : p_seq
+    if (!rst_ni) begin
+      active_q   <= 1'b0;
+      rd_row_q   <= '0;
+      wr_row_q   <= '0;
+      rd_off_q   <= '0;
+      wr_off_q   <= '0;
+      rd_reps_q  <= '0;
+      wr_reps_q  <= '0;
+      done_cnt_q <= '0;
+    end else begin
+      if (!active_q && !desc_empty) begin
+        // Load the descriptor at the head of the queue. Empty rows copy nothing.
+        active_q  <= 1'b1;
+        rd_row_q  <= desc.src;
+        wr_row_q  <= desc.dst;
+        rd_off_q  <= '0;
+        wr_off_q  <= '0;
+        rd_reps_q <= (desc.len >> 3) == '0 ? '0 : desc.reps;
+        wr_reps_q <= (desc.len >> 3) == '0 ? '0 : desc.reps;
+      end
+
+      if (ar_hs) begin
+        if (rd_off_q + (rd_beats << 3) == desc.len) begin
+          rd_off_q  <= '0;
+          rd_row_q  <= rd_row_q + desc.src_stride;
+          rd_reps_q <= rd_reps_q - 1;
+        end else
+          rd_off_q <= rd_off_q + (rd_beats << 3);
+      end
+
+      if (aw_hs) begin
+        if (wr_off_q + (wr_beats << 3) == desc.len) begin
+          wr_off_q  <= '0;
+          wr_row_q  <= wr_row_q + desc.dst_stride;
+          wr_reps_q <= wr_reps_q - 1;
+        end else
+          wr_off_q <= wr_off_q + (wr_beats << 3);
+      end
+
+      if (desc_pop) begin
+        active_q   <= 1'b0;
+        done_cnt_q <= done_cnt_q + 1;
+      end
+    end
+  end : p_seq
+
+  `FF(issued_cnt_q, issued_cnt_q + desc_push, '0);
+  `FF(credits_q, credits_d, credits_t'(BufDepth));
+  `FF(w_cnt_q, w_cnt_d, '0);
+  `FF(b_pending_q, b_pending_d, '0);
+
+  if (BurstBeats == 0 || BurstBeats > 256)
+    $error("[soc_dma] BurstBeats must be between 1 and 256.");
+
+endmodule : soc_dma
@@ -27,6 +27,11 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
     parameter  type          axi_b_t      = logic,
     parameter  type          axi_req_t    = logic,
     parameter  type          axi_resp_t   = logic,
+    // Blocks in the buffer of the stream prefetcher. 0 disables the prefetcher.
+    parameter  int  unsigned PrefetchEntries = 0,
+    // Write ports of the memory snooped by the prefetcher
+    parameter  int  unsigned NrSnoopPorts    = 1,
+    parameter  int  unsigned SnoopAddrWidth  = 64,
     // Dependant parameters. DO NOT CHANGE!
     localparam int  unsigned DataWidth    = $bits(elen_t),
     localparam type          strb_t       = logic [DataWidth/8-1:0],
@@ -53,6 +58,12 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
     output vlen_t                   addrgen_exception_vstart_o,
     output logic                    addrgen_fof_exception_o,
     output logic                    lsu_current_burst_exception_o,
+    // Writes that landed in the memory, for the prefetcher
+    input  logic [NrSnoopPorts-1:0]                     snoop_valid_i,
+    input  logic [NrSnoopPorts-1:0][SnoopAddrWidth-1:0] snoop_addr_i,
+    // Performance events: load beats from the prefetch buffer, or from the memory
+    output logic                    perf_pf_hit_o,
+    output logic                    perf_pf_miss_o,
     // Interface with the lanes
     // Store unit operands
     input  elen_t     [NrLanes-1:0] stu_operand_i,
@@ -122,8 +133,8 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
   ///////////////
 
   // Internal AXI request signals
-  axi_req_t  axi_req;
-  axi_resp_t axi_resp;
+  axi_req_t  axi_req, axi_pf_req;
+  axi_resp_t axi_resp, axi_pf_resp;
 
   axi_cut #(
     .ar_chan_t (axi_ar_t  ),
@@ -136,10 +147,38 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
   ) i_axi_cut (
     .clk_i     (clk_i     ),
     .rst_ni    (rst_ni    ),
-    .mst_req_o (axi_req_o ),
-    .mst_resp_i(axi_resp_i),
-    .slv_req_i (axi_req   ),
-    .slv_resp_o(axi_resp  )
+    .mst_req_o (axi_req_o  ),
+    .mst_resp_i(axi_resp_i ),
+    .slv_req_i (axi_pf_req ),
+    .slv_resp_o(axi_pf_resp)
+  );
+
+  /////////////////////////
+  //  Stream Prefetcher  //
+  /////////////////////////
+
+  vlsu_prefetcher #(
+    .Entries       (PrefetchEntries),
+    .NrSnoopPorts  (NrSnoopPorts   ),
+    .SnoopAddrWidth(SnoopAddrWidth ),
+    .AxiDataWidth  (AxiDataWidth   ),
+    .AxiAddrWidth  (AxiAddrWidth   ),
+    .axi_ar_t      (axi_ar_t       ),
+    .axi_r_t       (axi_r_t        ),
+    .axi_req_t     (axi_req_t      ),
+    .axi_resp_t    (axi_resp_t     )
+  ) i_vlsu_prefetcher (
+    .clk_i            (clk_i            ),
+    .rst_ni           (rst_ni           ),
+    .slv_req_i        (axi_req          ),
+    .slv_resp_o       (axi_resp         ),
+    .mst_req_o        (axi_pf_req       ),
+    .mst_resp_i       (axi_pf_resp      ),
+    .core_st_pending_i(core_st_pending_i),
+    .snoop_valid_i    (snoop_valid_i    ),
+    .snoop_addr_i     (snoop_addr_i     ),
+    .hit_o            (perf_pf_hit_o    ),
+    .miss_o           (perf_pf_miss_o   )
   );
 
   //////////////////////////
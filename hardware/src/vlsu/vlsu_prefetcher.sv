@@ -0,0 +1,546 @@
+// Copyright 2026 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Stream prefetcher on the AXI read channels of the VLSU. It splits the AR
+// bursts of the VLSU at block boundaries. A block is BlockBeats bus words.
+// Stream trackers watch the sequence of blocks the loads touch, within a
+// burst and across bursts and instructions. Once a tracker has seen the same
+// block stride twice, the prefetcher fetches the next Degree blocks of the
+// stream into a buffer of Entries blocks. The bursts that hit the buffer are
+// answered from it, and the others go to memory. The R beats towards the
+// VLSU keep the order of its ARs.
+//
+// The prefetcher never crosses a 4 KiB page, so it neither follows a stream
+// into an unmapped page nor touches a device it was not asked to. Every store
+// of the VLSU invalidates the blocks it writes, and no prefetch touches them
+// until the store is over. While the core has a store pending, the whole
+// buffer is invalidated and nothing is prefetched. The writes of the other
+// masters (the DMA, the other cores) are snooped where they land in the
+// memory, and invalidate the block they write, also while it is filling. The
+// snooped addresses are offsets in a memory of 2**SnoopAddrWidth bytes that
+// is aliased over the address space, and invalidate all the aliases.
+//
+// All the ARs of the VLSU have the same ID, so the memory answers in order.
+// The write channels are passed through.
+
+module vlsu_prefetcher #(
+    // Blocks in the buffer. 0 disables the prefetcher.
+    parameter  int  unsigned Entries      = 0,
+    // Bus words per block, a power of two
+    parameter  int  unsigned BlockBeats   = 4,
+    // Streams tracked at the same time
+    parameter  int  unsigned NrStreams    = 4,
+    // Blocks fetched ahead of a stream
+    parameter  int  unsigned Degree       = 4,
+    // Largest stride of a stream, in blocks
+    parameter  int  unsigned MaxStride    = 64,
+    // Bursts in flight towards the memory
+    parameter  int  unsigned MaxTxns      = 8,
+    // Write ports of the memory snooped for the writes of the other masters
+    parameter  int  unsigned NrSnoopPorts = 1,
+    // Bits of the snooped addresses
+    parameter  int  unsigned SnoopAddrWidth = 64,
+    // AXI Interface parameters
+    parameter  int  unsigned AxiDataWidth = 0,
+    parameter  int  unsigned AxiAddrWidth = 0,
+    parameter  type          axi_ar_t     = logic,
+    parameter  type          axi_r_t      = logic,
+    parameter  type          axi_req_t    = logic,
+    parameter  type          axi_resp_t   = logic
+  ) (
+    input  logic      clk_i,
+    input  logic      rst_ni,
+    // From the VLSU
+    input  axi_req_t  slv_req_i,
+    output axi_resp_t slv_resp_o,
+    // To the memory
+    output axi_req_t  mst_req_o,
+    input  axi_resp_t mst_resp_i,
+    // The core has a store in flight
+    input  logic      core_st_pending_i,
+    // Byte addresses written in the memory this cycle
+    input  logic      [NrSnoopPorts-1:0]                     snoop_valid_i,
+    input  logic      [NrSnoopPorts-1:0][SnoopAddrWidth-1:0] snoop_addr_i,
+    // Statistics: R beats towards the VLSU, from the buffer or from the memory
+    output logic      hit_o,
+    output logic      miss_o
+  );
+
+  import cf_math_pkg::idx_width;
+  import axi_pkg::len_t;
+  import axi_pkg::size_t;
+  import axi_pkg::BURST_INCR;
+  import axi_pkg::CACHE_MODIFIABLE;
+  import axi_pkg::RESP_OKAY;
+
+  `include "common_cells/registers.svh"
+
+  if (Entries == 0) begin : gen_no_prefetcher
+    assign mst_req_o  = slv_req_i;
+    assign slv_resp_o = mst_resp_i;
+    assign hit_o      = 1'b0;
+    assign miss_o     = slv_resp_o.r_valid & slv_req_i.r_ready;
+  end : gen_no_prefetcher
+  else begin : gen_prefetcher
+    ///////////////////
+    //  Definitions  //
+    ///////////////////
+
+    localparam int unsigned BeatBytes  = AxiDataWidth / 8;
+    localparam int unsigned BeatOff    = $clog2(BeatBytes);
+    localparam int unsigned BlockBytes = BeatBytes * BlockBeats;
+    localparam int unsigned BlockOff   = $clog2(BlockBytes);
+    // Blocks in a 4 KiB page
+    localparam int unsigned PageOff    = 12 - BlockOff;
+    localparam int unsigned StrideW    = $clog2(MaxStride) + 2;
+    // Address bits compared by the snoops
+    localparam int unsigned SnoopW     = SnoopAddrWidth < AxiAddrWidth ? SnoopAddrWidth : AxiAddrWidth;
+
+    typedef logic [AxiAddrWidth-1:0]          addr_t;
+    typedef logic [AxiDataWidth-1:0]          data_t;
+    typedef logic [AxiAddrWidth-BlockOff-1:0] blk_t;
+    typedef logic [BlockOff-1:0]              off_t;
+    // Beats of a segment: up to BlockBytes narrow beats
+    typedef logic [BlockOff:0]                seg_beats_t;
+    typedef logic [idx_width(Entries)-1:0]    entry_idx_t;
+    typedef logic [$clog2(BlockBeats+1)-1:0]  fill_cnt_t;
+    typedef logic [$clog2(MaxTxns+1)-1:0]     ref_cnt_t;
+    typedef logic signed [StrideW-1:0]        stride_t;
+
+    function automatic addr_t align(addr_t addr, size_t size);
+      align = (addr >> size) << size;
+    endfunction : align
+
+    function automatic blk_t blk_of(addr_t addr);
+      blk_of = addr[AxiAddrWidth-1:BlockOff];
+    endfunction : blk_of
+
+    // A snooped write hits the block, or one of its aliases
+    function automatic logic snoop_hit(blk_t blk, logic [SnoopAddrWidth-1:0] addr);
+      snoop_hit = blk[SnoopW-BlockOff-1:0] == addr[SnoopW-1:BlockOff];
+    endfunction : snoop_hit
+
+    // Last block written by an AW burst
+    function automatic blk_t last_blk(addr_t addr, len_t len, size_t size);
+      last_blk = blk_of(align(addr, size) + ((addr_t'(len) + 1) << size) - 1);
+    endfunction : last_blk
+
+    ////////////////
+    //  Segments  //
+    ////////////////
+
+    // Piece of a burst of the VLSU within one block. The segments are answered in order.
+    typedef struct packed {
+      logic       hit;
+      entry_idx_t entry;
+      off_t       off;   // Address of the first beat in the block
+      size_t      size;
+      seg_beats_t beats;
+      logic       last;  // Last segment of the burst of the VLSU
+    } seg_t;
+
+    // Burst towards the memory: a prefetch, or a segment that missed
+    typedef struct packed {
+      logic       prefetch;
+      entry_idx_t entry;
+    } txn_t;
+
+    seg_t seg_push_data, seg_head;
+    logic seg_push, seg_pop, seg_full, seg_empty;
+    txn_t txn_push_data, txn_head;
+    logic txn_push, txn_pop, txn_full, txn_empty;
+
+    fifo_v3 #(
+      .DEPTH(MaxTxns),
+      .dtype(seg_t  )
+    ) i_seg_fifo (
+      .clk_i     (clk_i        ),
+      .rst_ni    (rst_ni       ),
+      .flush_i   (1'b0         ),
+      .testmode_i(1'b0         ),
+      .full_o    (seg_full     ),
+      .empty_o   (seg_empty    ),
+      .usage_o   (/* Unused */ ),
+      .data_i    (seg_push_data),
+      .push_i    (seg_push     ),
+      .data_o    (seg_head     ),
+      .pop_i     (seg_pop      )
+    );
+
+    fifo_v3 #(
+      .DEPTH(MaxTxns),
+      .dtype(txn_t  )
+    ) i_txn_fifo (
+      .clk_i     (clk_i        ),
+      .rst_ni    (rst_ni       ),
+      .flush_i   (1'b0         ),
+      .testmode_i(1'b0         ),
+      .full_o    (txn_full     ),
+      .empty_o   (txn_empty    ),
+      .usage_o   (/* Unused */ ),
+      .data_i    (txn_push_data),
+      .push_i    (txn_push     ),
+      .data_o    (txn_head     ),
+      .pop_i     (txn_pop      )
+    );
+
+    //////////////
+    //  Buffer  //
+    //////////////
+
+    typedef struct packed {
+      logic      alloc; // Holds a block, or waits for its fill or its hits
+      logic      valid; // Can take new hits
+      blk_t      tag;
+      fill_cnt_t fill;  // Beats received
+      ref_cnt_t  refs;  // Segments waiting for this block
+    } entry_t;
+
+    entry_t [Entries-1:0]                 entry_d, entry_q;
+    data_t  [Entries-1:0][BlockBeats-1:0] data_d, data_q;
+
+    /////////////////
+    //  Streams    //
+    /////////////////
+
+    typedef struct packed {
+      logic    valid;
+      logic    conf;   // The stride was seen twice in a row
+      blk_t    last;
+      stride_t stride;
+    } stream_t;
+
+    stream_t [NrStreams-1:0] stream_d, stream_q;
+    logic [idx_width(NrStreams)-1:0] stream_victim_d, stream_victim_q;
+    logic [idx_width(NrStreams)-1:0] pf_stream_d, pf_stream_q;
+    logic [idx_width(Entries)-1:0]   entry_victim_d, entry_victim_q;
+
+    ///////////////////////
+    //  Demand requests  //
+    ///////////////////////
+
+    // Burst of the VLSU being split
+    axi_ar_t    dem_ar_q, dem_ar_d;
+    logic       dem_busy_q, dem_busy_d;
+    addr_t      dem_addr_q, dem_addr_d;
+    logic [8:0] dem_left_q, dem_left_d;
+
+    // Served beats of the segment at the head
+    seg_beats_t srv_cnt_q, srv_cnt_d;
+
+    // Own stores in flight, and the blocks they write
+    logic [$clog2(MaxTxns+1)-1:0] wr_cnt_q, wr_cnt_d;
+    blk_t                         wr_lo_q, wr_lo_d, wr_hi_q, wr_hi_d;
+
+    always_comb begin : p_prefetcher
+      // Current segment
+      automatic blk_t       seg_blk    = blk_of(dem_addr_q);
+      automatic addr_t      blk_end    = addr_t'(seg_blk + 1) << BlockOff;
+      automatic addr_t      seg_beats  = (blk_end - align(dem_addr_q, dem_ar_q.size)) >> dem_ar_q.size;
+      automatic logic       seg_hit    = 1'b0;
+      automatic entry_idx_t seg_entry  = '0;
+      automatic logic       seg_done   = 1'b0;
+      // Prefetch candidate
+      automatic logic       pf_valid   = 1'b0;
+      automatic blk_t       pf_blk     = '0;
+      automatic logic       pf_free    = 1'b0;
+      automatic entry_idx_t pf_entry   = '0;
+      // Stream update
+      automatic logic       str_match  = 1'b0;
+      automatic int         str_idx    = 0;
+      // Served beat
+      automatic off_t       srv_off    = '0;
+
+      // Default assignments
+      mst_req_o        = slv_req_i;
+      mst_req_o.ar_valid = 1'b0;
+      mst_req_o.r_ready  = 1'b0;
+      slv_resp_o       = mst_resp_i;
+      slv_resp_o.ar_ready = !dem_busy_q;
+      slv_resp_o.r_valid  = 1'b0;
+      slv_resp_o.r        = '0;
+
+      entry_d         = entry_q;
+      data_d          = data_q;
+      stream_d        = stream_q;
+      stream_victim_d = stream_victim_q;
+      pf_stream_d     = pf_stream_q + 1;
+      if (pf_stream_d == NrStreams) pf_stream_d = '0;
+      entry_victim_d  = entry_victim_q;
+      dem_ar_d        = dem_ar_q;
+      dem_busy_d      = dem_busy_q;
+      dem_addr_d      = dem_addr_q;
+      dem_left_d      = dem_left_q;
+      srv_cnt_d       = srv_cnt_q;
+      wr_cnt_d        = wr_cnt_q;
+      wr_lo_d         = wr_lo_q;
+      wr_hi_d         = wr_hi_q;
+
+      seg_push      = 1'b0;
+      seg_pop       = 1'b0;
+      seg_push_data = '0;
+      txn_push      = 1'b0;
+      txn_pop       = 1'b0;
+      txn_push_data = '0;
+      hit_o         = 1'b0;
+      miss_o        = 1'b0;
+
+      ////////////////////
+      //  Invalidation  //
+      ////////////////////
+
+      // Own stores invalidate the blocks they write
+      if (slv_req_i.aw_valid && mst_resp_i.aw_ready) begin
+        automatic blk_t aw_first = blk_of(slv_req_i.aw.addr);
+        automatic blk_t aw_last  = last_blk(slv_req_i.aw.addr, slv_req_i.aw.len, slv_req_i.aw.size);
+
+        for (int unsigned e = 0; e < Entries; e++)
+          if (entry_q[e].tag >= aw_first && entry_q[e].tag <= aw_last)
+            entry_d[e].valid = 1'b0;
+
+        wr_lo_d = (wr_cnt_q == '0 || aw_first < wr_lo_q) ? aw_first : wr_lo_q;
+        wr_hi_d = (wr_cnt_q == '0 || aw_last > wr_hi_q) ? aw_last : wr_hi_q;
+      end
+      wr_cnt_d = wr_cnt_q + (slv_req_i.aw_valid && mst_resp_i.aw_ready) -
+        (mst_resp_i.b_valid && slv_req_i.b_ready);
+
+      // The core's stores invalidate everything
+      if (core_st_pending_i)
+        for (int unsigned e = 0; e < Entries; e++) entry_d[e].valid = 1'b0;
+
+      // The writes to the memory invalidate the block they write. A block still filling may
+      // have been read before the write, and is invalidated as well.
+      for (int unsigned p = 0; p < NrSnoopPorts; p++)
+        if (snoop_valid_i[p])
+          for (int unsigned e = 0; e < Entries; e++)
+            if (snoop_hit(entry_q[e].tag, snoop_addr_i[p])) entry_d[e].valid = 1'b0;
+
+      ////////////////
+      //  R beats   //
+      ////////////////
+
+      if (!txn_empty && txn_head.prefetch) begin
+        // Fill the buffer
+        mst_req_o.r_ready = 1'b1;
+        if (mst_resp_i.r_valid) begin
+          data_d[txn_head.entry][entry_q[txn_head.entry].fill] = mst_resp_i.r.data;
+          entry_d[txn_head.entry].fill = entry_q[txn_head.entry].fill + 1;
+          // Do not keep a block the memory refused
+          if (mst_resp_i.r.resp != RESP_OKAY) entry_d[txn_head.entry].valid = 1'b0;
+          if (mst_resp_i.r.last) txn_pop = 1'b1;
+        end
+      end else if (!seg_empty && !seg_head.hit) begin
+        // Forward a segment that missed, which is at the head of both FIFOs
+        slv_resp_o.r_valid = mst_resp_i.r_valid;
+        slv_resp_o.r       = mst_resp_i.r;
+        slv_resp_o.r.last  = mst_resp_i.r.last && seg_head.last;
+        mst_req_o.r_ready  = slv_req_i.r_ready;
+        if (mst_resp_i.r_valid && slv_req_i.r_ready) begin
+          miss_o = 1'b1;
+          if (mst_resp_i.r.last) begin
+            txn_pop = 1'b1;
+            seg_pop = 1'b1;
+          end
+        end
+      end
+
+      // Answer a segment that hit. The memory's beats of the next segments wait.
+      if (!seg_empty && seg_head.hit) begin
+        srv_off = (srv_cnt_q == '0) ? seg_head.off :
+          off_t'(((seg_head.off >> seg_head.size) + srv_cnt_q) << seg_head.size);
+        if (entry_q[seg_head.entry].fill > srv_off[BlockOff-1:BeatOff]) begin
+          slv_resp_o.r_valid = 1'b1;
+          // All the ARs of the VLSU have the same ID
+          slv_resp_o.r       = '{
+            id     : dem_ar_q.id,
+            data   : data_q[seg_head.entry][srv_off[BlockOff-1:BeatOff]],
+            resp   : RESP_OKAY,
+            last   : seg_head.last && (srv_cnt_q == seg_head.beats - 1),
+            default: '0
+          };
+          if (slv_req_i.r_ready) begin
+            hit_o     = 1'b1;
+            srv_cnt_d = srv_cnt_q + 1;
+            if (srv_cnt_q == seg_head.beats - 1) begin
+              srv_cnt_d = '0;
+              seg_pop   = 1'b1;
+              entry_d[seg_head.entry].refs = entry_d[seg_head.entry].refs - 1;
+            end
+          end
+        end
+      end
+
+      ///////////////
+      //  Demand   //
+      ///////////////
+
+      // Accept a new burst from the VLSU
+      if (slv_req_i.ar_valid && !dem_busy_q) begin
+        dem_ar_d   = slv_req_i.ar;
+        dem_busy_d = 1'b1;
+        dem_addr_d = slv_req_i.ar.addr;
+        dem_left_d = slv_req_i.ar.len + 1;
+      end
+
+      // Split the current burst. Bursts other than INCR go to the memory as they are.
+      if (dem_ar_q.burst != BURST_INCR || seg_beats > dem_left_q) seg_beats = dem_left_q;
+      for (int unsigned e = 0; e < Entries; e++)
+        if (entry_q[e].valid && entry_q[e].tag == seg_blk && dem_ar_q.burst == BURST_INCR) begin
+          seg_hit   = 1'b1;
+          seg_entry = e;
+        end
+
+      if (dem_busy_q && !seg_full) begin
+        seg_push_data = '{
+          hit  : seg_hit,
+          entry: seg_entry,
+          off  : dem_addr_q[BlockOff-1:0],
+          size : dem_ar_q.size,
+          beats: seg_beats_t'(seg_beats),
+          last : seg_beats == dem_left_q
+        };
+        if (seg_hit) begin
+          seg_push = 1'b1;
+          entry_d[seg_entry].refs = entry_d[seg_entry].refs + 1;
+        end else if (!txn_full) begin
+          mst_req_o.ar       = dem_ar_q;
+          mst_req_o.ar.addr  = dem_addr_q;
+          mst_req_o.ar.len   = len_t'(seg_beats - 1);
+          mst_req_o.ar_valid = 1'b1;
+          if (mst_resp_i.ar_ready) begin
+            seg_push      = 1'b1;
+            txn_push      = 1'b1;
+            txn_push_data = '{prefetch: 1'b0, entry: '0};
+          end
+        end
+        seg_done = seg_push;
+      end
+
+      if (seg_done) begin
+        dem_addr_d = align(dem_addr_q, dem_ar_q.size) + (seg_beats << dem_ar_q.size);
+        dem_left_d = dem_left_q - seg_beats;
+        if (seg_beats == dem_left_q) dem_busy_d = 1'b0;
+
+        // Follow the streams. A tracker takes the block it predicted, or else a block
+        // close to its last one. Otherwise, the block starts a new stream.
+        for (int s = NrStreams-1; s >= 0; s--)
+          if (stream_q[s].valid && stream_q[s].conf &&
+              seg_blk == stream_q[s].last + blk_t'(stream_q[s].stride)) begin
+            str_match = 1'b1;
+            str_idx   = s;
+          end
+        if (!str_match)
+          for (int s = NrStreams-1; s >= 0; s--)
+            if (stream_q[s].valid && ($signed(seg_blk - stream_q[s].last) <= $signed(MaxStride)) &&
+                ($signed(seg_blk - stream_q[s].last) >= -$signed(MaxStride))) begin
+              str_match = 1'b1;
+              str_idx   = s;
+            end
+
+        if (str_match) begin
+          if (seg_blk != stream_q[str_idx].last) begin
+            automatic stride_t stride = stride_t'(seg_blk - stream_q[str_idx].last);
+            stream_d[str_idx].conf   = stride == stream_q[str_idx].stride;
+            stream_d[str_idx].stride = stride;
+            stream_d[str_idx].last   = seg_blk;
+          end
+        end else begin
+          stream_d[stream_victim_q] = '{valid: 1'b1, conf: 1'b0, last: seg_blk, stride: '0};
+          stream_victim_d           = stream_victim_q + 1;
+          if (stream_victim_d == NrStreams) stream_victim_d = '0;
+        end
+      end
+
+      //////////////////
+      //  Prefetches  //
+      //////////////////
+
+      // Next block of one confirmed stream, in the same page, that is not in the buffer yet
+      if (stream_q[pf_stream_q].valid && stream_q[pf_stream_q].conf) begin
+        for (int k = Degree; k >= 1; k--) begin
+          automatic blk_t blk     = stream_q[pf_stream_q].last + blk_t'(k * stream_q[pf_stream_q].stride);
+          automatic logic present = 1'b0;
+          for (int unsigned e = 0; e < Entries; e++)
+            present |= entry_q[e].alloc && entry_q[e].tag == blk;
+          if (!present && blk[AxiAddrWidth-BlockOff-1:PageOff] ==
+              stream_q[pf_stream_q].last[AxiAddrWidth-BlockOff-1:PageOff] &&
+              !(wr_cnt_q != '0 && blk >= wr_lo_q && blk <= wr_hi_q)) begin
+            pf_valid = 1'b1;
+            pf_blk   = blk;
+          end
+        end
+      end
+
+      // A free entry, or else the victim if nothing waits for it
+      for (int e = Entries-1; e >= 0; e--)
+        if (!entry_q[e].alloc) begin
+          pf_free  = 1'b1;
+          pf_entry = e;
+        end
+      if (!pf_free && entry_q[entry_victim_q].fill == BlockBeats &&
+          entry_q[entry_victim_q].refs == '0 && !(seg_push && seg_hit && seg_entry == entry_victim_q)) begin
+        pf_free  = 1'b1;
+        pf_entry = entry_victim_q;
+      end
+
+      if (pf_valid && pf_free && !mst_req_o.ar_valid && !txn_full && !core_st_pending_i) begin
+        mst_req_o.ar = '{
+          addr   : addr_t'(pf_blk) << BlockOff,
+          len    : BlockBeats - 1,
+          size   : BeatOff,
+          cache  : CACHE_MODIFIABLE,
+          burst  : BURST_INCR,
+          default: '0
+        };
+        mst_req_o.ar_valid = 1'b1;
+        if (mst_resp_i.ar_ready) begin
+          entry_d[pf_entry] = '{alloc: 1'b1, valid: 1'b1, tag: pf_blk, fill: '0, refs: '0};
+          // Do not take hits on a block written while it is requested
+          for (int unsigned p = 0; p < NrSnoopPorts; p++)
+            if (snoop_valid_i[p] && snoop_hit(pf_blk, snoop_addr_i[p]))
+              entry_d[pf_entry].valid = 1'b0;
+          txn_push          = 1'b1;
+          txn_push_data     = '{prefetch: 1'b1, entry: pf_entry};
+          entry_victim_d    = entry_victim_q + 1;
+          if (entry_victim_d == Entries) entry_victim_d = '0;
+        end
+      end
+
+      // Release the invalidated blocks once nothing waits for them
+      for (int unsigned e = 0; e < Entries; e++)
+        if (!entry_d[e].valid && entry_d[e].fill == BlockBeats && entry_d[e].refs == '0)
+          entry_d[e].alloc = 1'b0;
+    end : p_prefetcher
+
+    `FF(entry_q, entry_d, '0)
+    `FF(data_q, data_d, '0)
+    `FF(stream_q, stream_d, '0)
+    `FF(stream_victim_q, stream_victim_d, '0)
+    `FF(pf_stream_q, pf_stream_d, '0)
+    `FF(entry_victim_q, entry_victim_d, '0)
+    `FF(dem_ar_q, dem_ar_d, '0)
+    `FF(dem_busy_q, dem_busy_d, 1'b0)
+    `FF(dem_addr_q, dem_addr_d, '0)
+    `FF(dem_left_q, dem_left_d, '0)
+    `FF(srv_cnt_q, srv_cnt_d, '0)
+    `FF(wr_cnt_q, wr_cnt_d, '0)
+    `FF(wr_lo_q, wr_lo_d, '0)
+    `FF(wr_hi_q, wr_hi_d, '0)
+
+    //////////////////
+    //  Assertions  //
+    //////////////////
+
+    if (BlockBeats != 2**$clog2(BlockBeats))
+      $error("[vlsu_prefetcher] BlockBeats must be a power of two.");
+
+    if (BlockBytes >= 4096)
+      $error("[vlsu_prefetcher] A block must be smaller than a 4 KiB page.");
+
+    if (SnoopW <= BlockOff)
+      $error("[vlsu_prefetcher] The snooped addresses must be wider than a block.");
+  end : gen_prefetcher
+
+endmodule : vlsu_prefetcher
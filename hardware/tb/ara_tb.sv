@@ -35,6 +35,66 @@ module ara_tb;
   localparam VLEN = 0;
   `endif
 
+  `ifdef NR_CORES
+  localparam NrCores = `NR_CORES;
+  `else
+  localparam NrCores = 1;
+  `endif
+
+  `ifdef SCALAR_FAST_PATH
+  localparam bit ScalarFastPath = `SCALAR_FAST_PATH;
+  `else
+  localparam bit ScalarFastPath = 1'b0;
+  `endif
+
+  `ifdef LOAD_CHAINING
+  localparam bit LoadChaining = `LOAD_CHAINING;
+  `else
+  localparam bit LoadChaining = 1'b0;
+  `endif
+
+  `ifdef OOO_ISSUE
+  localparam bit OutOfOrderIssue = `OOO_ISSUE;
+  `else
+  localparam bit OutOfOrderIssue = 1'b0;
+  `endif
+
+  `ifdef LANES_PER_CLUSTER
+  localparam int unsigned LanesPerCluster = `LANES_PER_CLUSTER;
+  `else
+  localparam int unsigned LanesPerCluster = 4;
+  `endif
+
+  `ifdef PREFETCH_ENTRIES
+  localparam int unsigned PrefetchEntries = `PREFETCH_ENTRIES;
+  `else
+  localparam int unsigned PrefetchEntries = 0;
+  `endif
+
+  `ifdef L2_LATENCY
+  localparam int unsigned L2Latency = `L2_LATENCY;
+  `else
+  localparam int unsigned L2Latency = 0;
+  `endif
+
+  `ifdef NR_MEM_PORTS
+  localparam int unsigned NrMemPorts = `NR_MEM_PORTS;
+  `else
+  localparam int unsigned NrMemPorts = 1;
+  `endif
+
+  `ifdef NR_DIV_UNITS
+  localparam int unsigned NrDivUnits = `NR_DIV_UNITS;
+  `else
+  localparam int unsigned NrDivUnits = 1;
+  `endif
+
+  `ifdef L2_NUM_BANKS
+  localparam int unsigned L2NumBanks = `L2_NUM_BANKS;
+  `else
+  localparam int unsigned L2NumBanks = 4;
+  `endif
+
   localparam ClockPeriod  = 1ns;
   // Axi response delay [ps]
   localparam int unsigned AxiRespDelay = 200;
@@ -83,11 +143,21 @@ module ara_tb;
   // we do not instantiate it when Verilating this module.
   `ifndef VERILATOR
   ara_testharness #(
-    .NrLanes     (NrLanes         ),
-    .VLEN        (VLEN            ),
-    .AxiAddrWidth(AxiAddrWidth    ),
-    .AxiDataWidth(AxiWideDataWidth),
-    .AxiRespDelay(AxiRespDelay    )
+    .NrLanes        (NrLanes         ),
+    .VLEN           (VLEN            ),
+    .NrCores        (NrCores         ),
+    .ScalarFastPath (ScalarFastPath  ),
+    .LoadChaining   (LoadChaining    ),
+    .OutOfOrderIssue(OutOfOrderIssue ),
+    .LanesPerCluster(LanesPerCluster ),
+    .PrefetchEntries(PrefetchEntries ),
+    .L2Latency      (L2Latency       ),
+    .NrMemPorts     (NrMemPorts      ),
+    .NrDivUnits     (NrDivUnits      ),
+    .L2NumBanks     (L2NumBanks      ),
+    .AxiAddrWidth   (AxiAddrWidth    ),
+    .AxiDataWidth   (AxiWideDataWidth),
+    .AxiRespDelay   (AxiRespDelay    )
   ) dut (
     .clk_i (clk  ),
     .rst_ni(rst_n),
@@ -102,6 +172,10 @@ module ara_tb;
   typedef logic [AxiAddrWidth-1:0] addr_t;
   typedef logic [AxiWideDataWidth-1:0] data_t;
 
+  // Words of the L2 to preload, by index. Word w is written to bank w % L2NumBanks.
+  data_t dram_image [addr_t];
+  event  dram_image_ready;
+
   initial begin : dram_init
     automatic data_t mem_row;
     byte buffer [];
@@ -134,17 +208,27 @@ module ara_tb;
           if (address >= DRAMAddrBase && address < DRAMAddrBase + DRAMLength)
             // This requires the sections to be aligned to AxiWideByteOffset,
             // otherwise, they can be over-written.
-            dut.i_ara_soc.i_dram.init_val[(address - DRAMAddrBase + (w << AxiWideByteOffset)) >> AxiWideByteOffset] = mem_row;
+            dram_image[(address - DRAMAddrBase + (w << AxiWideByteOffset)) >> AxiWideByteOffset] = mem_row;
           else
             $display("Cannot initialize address %x, which doesn't fall into the L2 region.", address);
         end
       end
+      -> dram_image_ready;
     end else begin
       $error("Expecting a firmware to run, none was provided!");
       $finish;
     end
   end : dram_init
 
+  for (genvar b = 0; b < L2NumBanks; b++) begin : gen_dram_init
+    initial begin
+      @(dram_image_ready);
+      foreach (dram_image[w])
+        if (w % L2NumBanks == b)
+          dut.i_ara_soc.gen_l2_banks[b].i_bank.init_val[w / L2NumBanks] = dram_image[w];
+    end
+  end : gen_dram_init
+
 `ifndef TARGET_GATESIM
 
   /*************************
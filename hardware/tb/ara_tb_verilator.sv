@@ -7,8 +7,18 @@
 // Description: Top level testbench module for Verilator.
 
 module ara_tb_verilator #(
-    parameter int unsigned NrLanes = 0,
-    parameter int unsigned VLEN    = 0
+    parameter int unsigned NrLanes         = 0,
+    parameter int unsigned VLEN            = 0,
+    parameter int unsigned NrCores         = 1,
+    parameter bit          ScalarFastPath  = 1'b0,
+    parameter bit          LoadChaining    = 1'b0,
+    parameter bit          OutOfOrderIssue = 1'b0,
+    parameter int unsigned LanesPerCluster = 4,
+    parameter int unsigned PrefetchEntries = 0,
+    parameter int unsigned L2Latency       = 0,
+    parameter int unsigned NrMemPorts      = 1,
+    parameter int unsigned NrDivUnits      = 1,
+    parameter int unsigned L2NumBanks      = 4
   )(
     input  logic        clk_i,
     input  logic        rst_ni,
@@ -27,10 +37,20 @@ module ara_tb_verilator #(
    *********/
 
   ara_testharness #(
-    .NrLanes     (NrLanes         ),
-    .VLEN        (VLEN            ),
-    .AxiAddrWidth(AxiAddrWidth    ),
-    .AxiDataWidth(AxiWideDataWidth)
+    .NrLanes        (NrLanes         ),
+    .VLEN           (VLEN            ),
+    .NrCores        (NrCores         ),
+    .ScalarFastPath (ScalarFastPath  ),
+    .LoadChaining   (LoadChaining    ),
+    .OutOfOrderIssue(OutOfOrderIssue ),
+    .LanesPerCluster(LanesPerCluster ),
+    .PrefetchEntries(PrefetchEntries ),
+    .L2Latency      (L2Latency       ),
+    .NrMemPorts     (NrMemPorts      ),
+    .NrDivUnits     (NrDivUnits      ),
+    .L2NumBanks     (L2NumBanks      ),
+    .AxiAddrWidth   (AxiAddrWidth    ),
+    .AxiDataWidth   (AxiWideDataWidth)
   ) dut (
     .clk_i (clk_i ),
     .rst_ni(rst_ni),
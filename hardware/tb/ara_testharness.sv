@@ -9,15 +9,25 @@
 
 module ara_testharness #(
     // Ara-specific parameters
-    parameter int unsigned NrLanes      = 0,
-    parameter int unsigned VLEN         = 0,
+    parameter int unsigned NrLanes         = 0,
+    parameter int unsigned VLEN            = 0,
+    parameter int unsigned NrCores         = 1,
+    parameter bit          ScalarFastPath  = 1'b0,
+    parameter bit          LoadChaining    = 1'b0,
+    parameter bit          OutOfOrderIssue = 1'b0,
+    parameter int unsigned LanesPerCluster = 4,
+    parameter int unsigned PrefetchEntries = 0,
+    parameter int unsigned L2Latency       = 0,
+    parameter int unsigned NrMemPorts      = 1,
+    parameter int unsigned NrDivUnits      = 1,
+    parameter int unsigned L2NumBanks      = 4,
     // AXI Parameters
-    parameter int unsigned AxiUserWidth = 1,
-    parameter int unsigned AxiIdWidth   = 5,
-    parameter int unsigned AxiAddrWidth = 64,
-    parameter int unsigned AxiDataWidth = 64*NrLanes/2,
+    parameter int unsigned AxiUserWidth    = 1,
+    parameter int unsigned AxiIdWidth      = 5,
+    parameter int unsigned AxiAddrWidth    = 64,
+    parameter int unsigned AxiDataWidth    = 64*NrLanes/2,
     // AXI Resp Delay [ps] for gate-level simulation
-    parameter int unsigned AxiRespDelay = 200
+    parameter int unsigned AxiRespDelay    = 200
   ) (
     input  logic        clk_i,
     input  logic        rst_ni,
@@ -67,13 +77,23 @@ module ara_testharness #(
    *********/
 
   ara_soc #(
-    .NrLanes     (NrLanes      ),
-    .VLEN        (VLEN         ),
-    .AxiAddrWidth(AxiAddrWidth ),
-    .AxiDataWidth(AxiDataWidth ),
-    .AxiIdWidth  (AxiIdWidth   ),
-    .AxiUserWidth(AxiUserWidth ),
-    .AxiRespDelay(AxiRespDelay )
+    .NrLanes        (NrLanes        ),
+    .VLEN           (VLEN           ),
+    .NrCores        (NrCores        ),
+    .ScalarFastPath (ScalarFastPath ),
+    .LoadChaining   (LoadChaining   ),
+    .OutOfOrderIssue(OutOfOrderIssue),
+    .LanesPerCluster(LanesPerCluster),
+    .PrefetchEntries(PrefetchEntries),
+    .L2Latency      (L2Latency      ),
+    .NrMemPorts     (NrMemPorts     ),
+    .NrDivUnits     (NrDivUnits     ),
+    .L2NumBanks     (L2NumBanks     ),
+    .AxiAddrWidth   (AxiAddrWidth   ),
+    .AxiDataWidth   (AxiDataWidth   ),
+    .AxiIdWidth     (AxiIdWidth     ),
+    .AxiUserWidth   (AxiUserWidth   ),
+    .AxiRespDelay   (AxiRespDelay   )
   ) i_ara_soc (
     .clk_i         (clk_i       ),
     .rst_ni        (rst_ni      ),
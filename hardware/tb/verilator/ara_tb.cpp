@@ -8,6 +8,8 @@
 
 #include <fstream>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include "verilated_toplevel.h"
 #include "verilator_memutil.h"
@@ -23,10 +25,13 @@ int main(int argc, char **argv) {
   simctrl.SetTop(tb, &tb->clk_i, &tb->rst_ni,
                  VerilatorSimCtrlFlags::ResetPolarityNegative);
 
-  // Initialize the DRAM
+  // Initialize the DRAM, whose words are interleaved over its banks
   MemAreaLoc l2_mem = {.base=0x80000000, .size=0x00100000};
-  memutil.RegisterMemoryArea(
-                             "ram", "TOP.ara_tb_verilator.dut.i_ara_soc.i_dram", 64*NR_LANES/2, &l2_mem);
+  std::vector<std::string> l2_banks;
+  for (int b = 0; b < L2_NUM_BANKS; ++b)
+    l2_banks.push_back("TOP.ara_tb_verilator.dut.i_ara_soc.gen_l2_banks[" +
+                       std::to_string(b) + "].i_bank");
+  memutil.RegisterMemoryArea("ram", l2_banks, 64*NR_LANES/2, &l2_mem);
   simctrl.RegisterExtension(&memutil);
 
   simctrl.SetInitialResetDelay(5);
@@ -4,6 +4,7 @@
 
 #include "dpi_memutil.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <fcntl.h>
@@ -243,6 +244,30 @@ static std::vector<uint8_t> FlattenElfFile(const std::string &filepath) {
   return ret.GetFlat();
 }
 
+// Write the word |word| of the memory in the current scope, from |len| bytes
+// of |data| at |src_byte|. The latter bytes of the word are zero.
+static void WriteWord(const MemArea &m, uint32_t word,
+                      const std::vector<uint8_t> &data, uint32_t src_byte,
+                      uint32_t len, uint32_t byte_offset) {
+  // This "mini buffer" is used to transfer each write to SystemVerilog. It's
+  // not massively efficient, but doing so ensures that we pass 512 bits (64
+  // bytes) of initialised data each time. This is for simutil_set_mem (defined
+  // in prim_util_memload.svh), whose "val" argument has SystemVerilog type bit
+  // [511:0].
+  uint8_t minibuf[64];
+  memset(minibuf, 0, sizeof minibuf);
+  assert(m.width_byte <= sizeof minibuf);
+
+  memcpy(minibuf, &data[src_byte], len);
+  if (!simutil_set_mem(word, (svBitVecVal *)minibuf)) {
+    std::ostringstream oss;
+    oss << "Could not set `" << m.name << "' memory at byte offset 0x"
+        << std::hex << byte_offset
+        << (len < m.width_byte ? " (partial data word)." : ".");
+    throw std::runtime_error(oss.str());
+  }
+}
+
 // Write a "segment" of data to the given memory area.
 static void WriteSegment(const MemArea &m, uint32_t offset,
                          const std::vector<uint8_t> &data) {
@@ -257,51 +282,28 @@ static void WriteSegment(const MemArea &m, uint32_t offset,
   assert(m.addr_loc.size == 0 || offset + data.size() <= m.addr_loc.size);
   assert((offset % m.width_byte) == 0);
 
-  // If this fails to set scope, it will throw an error which should
-  // be caught at this function's callsite.
-  SVScoped scoped(m.location.data());
-
-  // This "mini buffer" is used to transfer each write to SystemVerilog. It's
-  // not massively efficient, but doing so ensures that we pass 512 bits (64
-  // bytes) of initialised data each time. This is for simutil_set_mem (defined
-  // in prim_util_memload.svh), whose "val" argument has SystemVerilog type bit
-  // [511:0].
-  uint8_t minibuf[64];
-  memset(minibuf, 0, sizeof minibuf);
-  assert(m.width_byte <= sizeof minibuf);
-
   uint32_t all_words = (data.size() + m.width_byte - 1) / m.width_byte;
-  uint32_t full_data_words = data.size() / m.width_byte;
-  uint32_t part_data_word_len = data.size() % m.width_byte;
-  bool has_part_data_word = part_data_word_len != 0;
-
   uint32_t word_offset = offset / m.width_byte;
 
-  // Copy the full data words
-  for (uint32_t i = 0; i < full_data_words; ++i) {
-    uint32_t dst_word = word_offset + i;
-    uint32_t src_byte = i * m.width_byte;
-    memcpy(minibuf, &data[src_byte], m.width_byte);
-    if (!simutil_set_mem(dst_word, (svBitVecVal *)minibuf)) {
-      std::ostringstream oss;
-      oss << "Could not set `" << m.name << "' memory at byte offset 0x"
-          << std::hex << dst_word * m.width_byte << ".";
-      throw std::runtime_error(oss.str());
-    }
-  }
-
-  // Copy any partial data, zeroing minibuf first to ensure that the latter
-  // bytes in the word are zero.
-  if (has_part_data_word) {
-    memset(minibuf, 0, sizeof minibuf);
-    uint32_t dst_word = word_offset + full_data_words;
-    uint32_t src_byte = full_data_words * m.width_byte;
-    memcpy(minibuf, &data[src_byte], part_data_word_len);
-    if (!simutil_set_mem(dst_word, (svBitVecVal *)minibuf)) {
-      std::ostringstream oss;
-      oss << "Could not set `" << m.name << "' memory at byte offset 0x"
-          << std::hex << dst_word * m.width_byte << " (partial data word).";
-      throw std::runtime_error(oss.str());
+  // The words of a banked memory are interleaved over the scopes of its
+  // banks: word w is word w / n of bank w % n.
+  size_t num_banks = m.bank_locations.empty() ? 1 : m.bank_locations.size();
+
+  for (size_t b = 0; b < num_banks; ++b) {
+    // If this fails to set scope, it will throw an error which should
+    // be caught at this function's callsite.
+    SVScoped scoped(m.bank_locations.empty() ? m.location.data()
+                                             : m.bank_locations[b].data());
+
+    for (uint32_t i = 0; i < all_words; ++i) {
+      uint32_t dst_word = word_offset + i;
+      if (dst_word % num_banks != b)
+        continue;
+      // The last word may only be partially covered by the data
+      uint32_t src_byte = i * m.width_byte;
+      uint32_t len = std::min<size_t>(m.width_byte, data.size() - src_byte);
+      WriteWord(m, dst_word / num_banks, data, src_byte, len,
+                dst_word * m.width_byte);
     }
   }
 }
@@ -417,6 +419,16 @@ bool DpiMemUtil::RegisterMemoryArea(const std::string name,
   return RegisterMemoryArea(name, location, 32, nullptr);
 }
 
+bool DpiMemUtil::RegisterMemoryArea(
+    const std::string name, const std::vector<std::string> &bank_locations,
+    size_t width_bit, const MemAreaLoc *addr_loc) {
+  assert(!bank_locations.empty());
+  if (!RegisterMemoryArea(name, bank_locations[0], width_bit, addr_loc))
+    return false;
+  name_to_mem_[name].bank_locations = bank_locations;
+  return true;
+}
+
 bool DpiMemUtil::RegisterMemoryArea(const std::string name,
                                     const std::string location,
                                     size_t width_bit,
@@ -30,6 +30,9 @@ struct MemArea {
   std::string location;  // Design scope location
   uint32_t width_byte;   // Memory width in bytes
   MemAreaLoc addr_loc;   // Address location. If !size, location is unknown.
+  // Design scope locations of the word-interleaved banks, if the memory is
+  // banked: word w of the memory is word w / n of bank w % n.
+  std::vector<std::string> bank_locations;
 };
 
 // Staged data for a given memory area.
@@ -92,6 +95,17 @@ class DpiMemUtil {
   bool RegisterMemoryArea(const std::string name, const std::string location,
                           size_t width_bit, const MemAreaLoc *addr_loc);
 
+  /**
+   * Register a memory whose words are interleaved over several banks
+   *
+   * Same as above, with the |bank_locations| of the instantiated banks
+   * instead of a single location. Word w of the memory is word w / n of the
+   * bank at bank_locations[w % n].
+   */
+  bool RegisterMemoryArea(const std::string name,
+                          const std::vector<std::string> &bank_locations,
+                          size_t width_bit, const MemAreaLoc *addr_loc);
+
   /**
    * Register a memory with default width (32bits)
    */
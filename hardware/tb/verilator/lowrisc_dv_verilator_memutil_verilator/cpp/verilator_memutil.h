@@ -32,6 +32,13 @@ class VerilatorMemUtil : public SimCtrlExtension {
     return mem_util_->RegisterMemoryArea(name, location, width_bit, addr_loc);
   }
 
+  bool RegisterMemoryArea(const std::string name,
+                          const std::vector<std::string> &bank_locations,
+                          size_t width_bit, const MemAreaLoc *addr_loc) {
+    return mem_util_->RegisterMemoryArea(name, bank_locations, width_bit,
+                                         addr_loc);
+  }
+
   bool RegisterMemoryArea(const std::string name, const std::string location) {
     return mem_util_->RegisterMemoryArea(name, location);
   }
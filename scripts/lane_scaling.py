@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+# Copyright 2026 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Scaling study over the number of lanes, and over the clusters of the slide
+# unit past 16 lanes. Runs fmatmul, spmv, and fdotproduct, whose reduction
+# slides across the lanes, on every configuration with
+# scripts/roofline_sweep.py, and reports, next to their FLOP/cycle and
+# FLOP/cycle per lane, the size of the verilated model as a proxy of the area
+# and wiring of the configuration: the lines of generated C++ and the size of
+# the simulator executable. The 32_lanes_*_clusters configurations change the
+# lanes per cluster (lanes_per_cluster) of 32_lanes.
+
+import argparse
+import csv
+import glob
+import os
+import re
+import subprocess
+import sys
+
+root = os.path.abspath(os.path.join(os.path.dirname(__file__), '..'))
+hardware = os.path.join(root, 'hardware')
+
+FIELDS = ['config', 'nr_lanes', 'nr_clusters', 'model_lines', 'model_bytes', 'kernel',
+          'size', 'cycles', 'flop_per_cycle', 'flop_per_cycle_per_lane',
+          'check']
+
+# Value of a variable of a config/*.mk file
+def read_var(config, name, default=None):
+  with open(os.path.join(root, 'config', config + '.mk')) as f:
+    m = re.search(r'^\s*' + name + r'\s*\??=\s*(\d+)', f.read(), re.M)
+  return int(m.group(1)) if m else default
+
+def nr_lanes(config):
+  return read_var(config, 'nr_lanes')
+
+# Clusters of the slide unit, which only has them past 16 lanes (see the
+# hardware Makefile for the default lanes_per_cluster)
+def nr_clusters(config):
+  lanes = nr_lanes(config)
+  return lanes // read_var(config, 'lanes_per_cluster', 4) if lanes > 16 else 1
+
+# Lines of generated C++, and bytes of the simulator, of a verilated model
+def model_size(config):
+  obj_dir = os.path.join(hardware, 'build', 'sweep', config, 'verilator')
+  lines = 0
+  for src in glob.glob(os.path.join(obj_dir, '**', 'V*.cpp'), recursive=True) + \
+             glob.glob(os.path.join(obj_dir, '**', 'V*.h'), recursive=True):
+    with open(src, errors='ignore') as f:
+      lines += sum(1 for _ in f)
+  exe = os.path.join(obj_dir, 'Vara_tb_verilator')
+  return lines, os.path.getsize(exe) if os.path.exists(exe) else 0
+
+parser = argparse.ArgumentParser(description='''
+Compare the size of the verilated model and the performance of fmatmul, spmv,
+and fdotproduct across lane and cluster counts.
+''')
+parser.add_argument('-c', '--configs', nargs='+',
+                    default=['2_lanes', '4_lanes', '8_lanes', '16_lanes',
+                             '32_lanes_4_clusters', '32_lanes',
+                             '32_lanes_16_clusters'],
+                    help='Configurations, from config/')
+parser.add_argument('-p', '--points',
+                    default='fmatmul:64,128 spmv:256,1024 fdotproduct:4096',
+                    help='Points, as for make bench-points')
+parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count(),
+                    help='Parallel simulations (default: host cores)')
+parser.add_argument('-o', '--outdir', default=os.path.join(root, 'lane-scaling'),
+                    help='Output directory (default: lane-scaling)')
+args = parser.parse_args()
+
+# The sweep fails on any failed point, which is reported below
+sweep = os.path.join(args.outdir, 'sweep')
+subprocess.run([sys.executable, os.path.join(root, 'scripts', 'roofline_sweep.py'),
+                '-c'] + args.configs + ['-p', args.points, '-j', str(args.jobs),
+                '-o', sweep], cwd=root)
+
+with open(os.path.join(sweep, 'results.csv')) as f:
+  results = list(csv.DictReader(f))
+
+rows = []
+for config in args.configs:
+  lanes = nr_lanes(config)
+  clusters = nr_clusters(config)
+  lines, size = model_size(config)
+  for r in (r for r in results if r['config'] == config):
+    flop = float(r['flop_per_cycle'])
+    rows.append({'config': config, 'nr_lanes': lanes, 'nr_clusters': clusters,
+                 'model_lines': lines, 'model_bytes': size, 'kernel': r['kernel'],
+                 'size': int(r['size']), 'cycles': int(r['cycles']),
+                 'flop_per_cycle': flop, 'flop_per_cycle_per_lane': flop / lanes,
+                 'check': r['check']})
+
+with open(os.path.join(args.outdir, 'scaling.csv'), 'w', newline='') as f:
+  w = csv.DictWriter(f, fieldnames=FIELDS)
+  w.writeheader()
+  w.writerows(rows)
+
+print("%-20s  %5s  %8s  %11s  %11s  %-8s  %6s  %10s  %10s  %10s" %
+      ('config', 'lanes', 'clusters', 'model_lines', 'model_bytes', 'kernel',
+       'size', 'cycles', 'FLOP/cycle', 'per lane'))
+for r in rows:
+  print("%-20s  %5d  %8d  %11d  %11d  %-8s  %6d  %10d  %10.3f  %10.3f" %
+        (r['config'], r['nr_lanes'], r['nr_clusters'], r['model_lines'],
+         r['model_bytes'], r['kernel'], r['size'], r['cycles'],
+         r['flop_per_cycle'], r['flop_per_cycle_per_lane']))
+
+failed = [r for r in rows if r['check'] != 'ok']
+print("Results in %s." % os.path.join(args.outdir, 'scaling.csv'))
+sys.exit(1 if failed or not rows else 0)
@@ -0,0 +1,248 @@
+#!/usr/bin/env python3
+# Copyright 2026 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Sweep the benchmark registry of apps/benchmarks over several Ara
+# configurations and problem sizes, and draw one roofline per configuration.
+#
+# Every configuration keeps its own verilated model under
+# hardware/build/sweep/<config>, which make rebuilds only when the RTL or the
+# configuration changed. The registry binary is compiled once per
+# configuration, and every kernel:size point gets a copy of it with its own
+# .bench_points section, so that the points simulate in parallel.
+#
+# The arithmetic intensity of a point is its FLOP/cycle over its B/cycle,
+# both from the FLOP and byte models of the kernel. The results are compared
+# with a baseline CSV, if given, and the run fails if any point got slower or
+# failed its check.
+
+import argparse
+import concurrent.futures
+import csv
+import glob
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+root = os.path.abspath(os.path.join(os.path.dirname(__file__), '..'))
+apps = os.path.join(root, 'apps')
+hardware = os.path.join(root, 'hardware')
+
+FIELDS = ['config', 'kernel', 'size', 'cycles', 'flop_per_cycle',
+          'bytes_per_cycle', 'intensity', 'check']
+
+def run(cmd, log=None, check=True):
+  out = subprocess.run(cmd, cwd=root, stdout=subprocess.PIPE,
+                       stderr=subprocess.STDOUT, universal_newlines=True)
+  if log:
+    with open(log, 'w') as f:
+      f.write(out.stdout)
+  if check and out.returncode:
+    sys.stdout.write(out.stdout[-4000:])
+    sys.exit("Error. '%s' failed." % ' '.join(cmd))
+  return out.stdout
+
+# Read a config/*.mk file, e.g. "nr_lanes ?= 4"
+def read_config(name):
+  cfg = {}
+  with open(os.path.join(root, 'config', name + '.mk')) as f:
+    for line in f:
+      m = re.match(r'\s*(\w+)\s*\??=\s*(\S+)', line)
+      if m:
+        cfg[m.group(1)] = m.group(2)
+  return cfg
+
+# Registered kernels and their default sizes, from the BENCH_REGISTER blocks
+def registered_kernels():
+  kernels = {}
+  for src in sorted(glob.glob(os.path.join(apps, 'benchmarks', 'bench', '*.c'))):
+    with open(src) as f:
+      for m in re.finditer(r'\.name\s*=\s*"(\w+)"\s*,\s*\.default_size\s*=\s*(\d+)',
+                           f.read()):
+        kernels[m.group(1)] = int(m.group(2))
+  return kernels
+
+# "fmatmul:32,64 exp all" -> [("fmatmul", 32), ("fmatmul", 64), ("exp", 128), ...]
+def expand_points(points):
+  kernels = registered_kernels()
+  expanded = []
+  for token in points.split():
+    name, _, sizes = token.partition(':')
+    if name == 'all':
+      expanded += sorted(kernels.items())
+      continue
+    if name not in kernels:
+      sys.exit("Error. Unknown kernel %s." % name)
+    for size in (sizes.split(',') if sizes else [kernels[name]]):
+      expanded.append((name, int(size)))
+  # Keep the order, drop the duplicates
+  return list(dict.fromkeys(expanded))
+
+# Build the verilated model and the registry binary of one configuration
+def build(config, outdir):
+  buildpath = os.path.join(hardware, 'build', 'sweep', config)
+  print("[%s] Verilating into %s" % (config, buildpath))
+  run(['make', '-C', hardware, 'verilate', 'config=' + config,
+       'buildpath=' + buildpath], log=os.path.join(outdir, 'verilate.log'))
+  print("[%s] Compiling bin/benchmarks" % config)
+  run(['make', '-C', apps, '-B', 'bin/benchmarks', 'config=' + config],
+      log=os.path.join(outdir, 'compile.log'))
+  shutil.copy(os.path.join(apps, 'bin', 'benchmarks'),
+              os.path.join(outdir, 'benchmarks'))
+  return buildpath
+
+# Simulate one point, and return its row of the registry table
+def simulate(config, buildpath, outdir, kernel, size):
+  app = '%s_%d' % (kernel, size)
+  binary = os.path.join(outdir, 'points', app)
+  shutil.copy(os.path.join(outdir, 'benchmarks'), binary)
+  run(['make', '-s', '-C', apps, 'bench-points', 'config=' + config,
+       'bench_bin=' + binary, 'points=%s:%d' % (kernel, size)])
+  # A failing check also fails the simulation: keep its table row
+  log = os.path.join(outdir, 'points', app + '.log')
+  out = run(['make', '-C', hardware, 'simv', 'config=' + config,
+             'buildpath=' + buildpath, 'app_path=' + os.path.dirname(binary),
+             'app=' + app], log=log, check=False)
+  # kernel size cycles FLOP/cycle B/cycle check, possibly after a prefix
+  for line in out.splitlines():
+    fields = line.split()
+    for i in range(len(fields) - 5):
+      if fields[i] == kernel and fields[i + 1] == str(size):
+        try:
+          flop, byte = float(fields[i + 3]), float(fields[i + 4])
+          return {'config': config, 'kernel': kernel, 'size': size,
+                  'cycles': int(fields[i + 2]), 'flop_per_cycle': flop,
+                  'bytes_per_cycle': byte,
+                  'intensity': flop / byte if byte else 0.0,
+                  'check': fields[i + 5]}
+        except ValueError:
+          pass
+  return {'config': config, 'kernel': kernel, 'size': size, 'cycles': 0,
+          'flop_per_cycle': 0.0, 'bytes_per_cycle': 0.0, 'intensity': 0.0,
+          'check': 'NORESULT'}
+
+# Roofline of one configuration. The compute roof is one 64-bit FMA per lane
+# and cycle, the memory roof the width of Ara's AXI port (32 bit per lane).
+def plot(config, nr_lanes, rows, path):
+  import matplotlib
+  matplotlib.use('Agg')
+  import matplotlib.pyplot as plt
+
+  peak = 2.0 * nr_lanes
+  bandwidth = 4.0 * nr_lanes
+  fig, ax = plt.subplots(figsize=(8, 6))
+  x = [2 ** (e / 8.0) for e in range(-8 * 6, 8 * 8 + 1)]
+  ax.plot(x, [min(peak, bandwidth * i) for i in x], 'k-', lw=2,
+          label='Roof: %g FLOP/cycle, %g B/cycle' % (peak, bandwidth))
+  for kernel in sorted(set(r['kernel'] for r in rows)):
+    points = [r for r in rows if r['kernel'] == kernel and r['intensity'] > 0]
+    if not points:
+      continue
+    ax.plot([r['intensity'] for r in points],
+            [r['flop_per_cycle'] for r in points], 'o-', label=kernel)
+    for r in points:
+      ax.annotate(str(r['size']), (r['intensity'], r['flop_per_cycle']),
+                  fontsize=7, textcoords='offset points', xytext=(3, 3))
+  ax.set_xscale('log', base=2)
+  ax.set_yscale('log', base=2)
+  ax.set_xlabel('Arithmetic intensity (FLOP/B)')
+  ax.set_ylabel('Performance (FLOP/cycle)')
+  ax.set_title('%s: %d lanes, VLEN %s' % (config, nr_lanes,
+                                           read_config(config).get('vlen', '?')))
+  ax.grid(True, which='both', ls=':')
+  ax.legend(loc='lower right', fontsize=8)
+  fig.savefig(path, dpi=150, bbox_inches='tight')
+  plt.close(fig)
+
+def write_csv(path, rows):
+  with open(path, 'w', newline='') as f:
+    w = csv.DictWriter(f, fieldnames=FIELDS)
+    w.writeheader()
+    w.writerows(rows)
+
+# Print the points whose cycles changed by more than the threshold, and
+# return how many got slower
+def compare(rows, baseline, threshold):
+  with open(baseline) as f:
+    old = {(r['config'], r['kernel'], int(r['size'])): int(r['cycles'])
+           for r in csv.DictReader(f)}
+  slower = 0
+  print("%-12s  %-12s  %6s  %10s  %10s  %7s" %
+        ('config', 'kernel', 'size', 'baseline', 'cycles', 'change'))
+  for r in rows:
+    key = (r['config'], r['kernel'], r['size'])
+    if key not in old or not old[key] or not r['cycles']:
+      continue
+    change = (r['cycles'] - old[key]) / old[key]
+    if abs(change) <= threshold:
+      continue
+    slower += change > 0
+    print("%-12s  %-12s  %6d  %10d  %10d  %+6.1f%%" %
+          (key + (old[key], r['cycles'], 100 * change)))
+  return slower
+
+parser = argparse.ArgumentParser(description='''
+Run the benchmark registry over a set of configurations and sizes, and draw
+their rooflines.
+''')
+parser.add_argument('-c', '--configs', nargs='+',
+                    default=sorted(os.path.basename(c)[:-3] for c in
+                                   glob.glob(os.path.join(root, 'config', '*.mk'))),
+                    help='Configurations, from config/ (default: all)')
+parser.add_argument('-p', '--points', default='all',
+                    help='Points, as for make bench-points (default: all)')
+parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count(),
+                    help='Parallel simulations (default: host cores)')
+parser.add_argument('-o', '--outdir', default=os.path.join(root, 'roofline-sweep'),
+                    help='Output directory (default: roofline-sweep)')
+parser.add_argument('-b', '--baseline',
+                    help='CSV of a previous sweep to compare the cycles with')
+parser.add_argument('-t', '--threshold', type=float, default=0.05,
+                    help='Relative change to report (default: 0.05)')
+args = parser.parse_args()
+
+points = expand_points(args.points)
+os.makedirs(args.outdir, exist_ok=True)
+
+# The apps share their build directory, so build one configuration at a time
+jobs = []
+for config in args.configs:
+  outdir = os.path.join(args.outdir, config)
+  os.makedirs(os.path.join(outdir, 'points'), exist_ok=True)
+  buildpath = build(config, outdir)
+  jobs += [(config, buildpath, outdir, k, n) for k, n in points]
+
+print("Simulating %d points on %d jobs" % (len(jobs), args.jobs))
+with concurrent.futures.ThreadPoolExecutor(max_workers=args.jobs) as pool:
+  rows = list(pool.map(lambda j: simulate(*j), jobs))
+
+write_csv(os.path.join(args.outdir, 'results.csv'), rows)
+for config in args.configs:
+  config_rows = [r for r in rows if r['config'] == config]
+  write_csv(os.path.join(args.outdir, config, 'results.csv'), config_rows)
+  plot(config, int(read_config(config)['nr_lanes']), config_rows,
+       os.path.join(args.outdir, config, 'roofline.png'))
+
+failed = [r for r in rows if r['check'] != 'ok']
+for r in failed:
+  print("Error. %s %s:%d: %s" % (r['config'], r['kernel'], r['size'], r['check']))
+
+slower = compare(rows, args.baseline, args.threshold) if args.baseline else 0
+print("%d points, %d failed, %d slower. Results in %s." %
+      (len(rows), len(failed), slower, args.outdir))
+sys.exit(1 if failed or slower else 0)
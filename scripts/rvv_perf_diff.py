@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+# Copyright 2026 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Compare the tables printed by the rvv-perf app in two simulation logs, e.g.
+# of two configurations or RTL revisions. Rows are matched by instruction,
+# SEW, LMUL and vector-length point, and the ones whose throughput or
+# latency changed by more than the threshold are printed.
+# Exit with 1 if any of them got slower.
+
+import argparse
+import sys
+
+def parse(path):
+  rows = {}
+  with open(path) as f:
+    for line in f:
+      # Simulation logs can prefix the UART output
+      fields = line.split()
+      for i in range(len(fields) - 7):
+        if fields[i + 4] in ('lane', 'max'):
+          cls, insn, sew, lmul, point, vl, thr, lat = fields[i:i + 8]
+          try:
+            rows[(insn, int(sew), int(lmul), point)] = (
+                cls, int(vl), float(thr), None if lat == '-' else float(lat))
+          except ValueError:
+            pass
+          break
+  return rows
+
+def change(old, new):
+  if old is None or new is None or old == 0:
+    return 0.0
+  return (new - old) / old
+
+parser = argparse.ArgumentParser(description='''
+Compare two rvv-perf tables.
+''')
+parser.add_argument('old', help='Reference log')
+parser.add_argument('new', help='Log to compare')
+parser.add_argument('-t', '--threshold', type=float, default=0.05,
+                    help='Relative change to report (default: 0.05)')
+args = parser.parse_args()
+
+old = parse(args.old)
+new = parse(args.new)
+if not old or not new:
+  print("Error. No rvv-perf table found.")
+  sys.exit(2)
+
+slower = 0
+print("%-9s  %-18s  %3s  %4s  %-5s  %7s  %7s  %7s  %7s" %
+      ('class', 'insn', 'sew', 'lmul', 'point', 'thr', 'new', 'lat', 'new'))
+for key in sorted(old.keys() & new.keys()):
+  cls, _, thr0, lat0 = old[key]
+  _, _, thr1, lat1 = new[key]
+  dt = change(thr0, thr1)
+  dl = change(lat0, lat1)
+  if abs(dt) <= args.threshold and abs(dl) <= args.threshold:
+    continue
+  slower += dt > args.threshold or dl > args.threshold
+  fmt = lambda x: '-' if x is None else '%.2f' % x
+  print("%-9s  %-18s  %3d  %4d  %-5s  %7s  %7s  %7s  %7s" %
+        ((cls,) + key + (fmt(thr0), fmt(thr1), fmt(lat0), fmt(lat1))))
+
+for key in sorted(old.keys() - new.keys()):
+  print("Only in %s: %s e%d m%d %s" % ((args.old,) + key))
+for key in sorted(new.keys() - old.keys()):
+  print("Only in %s: %s e%d m%d %s" % ((args.new,) + key))
+
+print("%d rows compared, %d slower." % (len(old.keys() & new.keys()), slower))
+sys.exit(1 if slower else 0)